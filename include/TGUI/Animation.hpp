@@ -30,6 +30,7 @@
 #include <TGUI/Duration.hpp>
 #include <functional>
 #include <memory>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -67,85 +68,173 @@ namespace tgui
     };
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Curve that determines how fast an animation progresses over time
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class EasingType
+    {
+        Linear,     //!< Constant speed from start to end
+        EaseIn,     //!< Starts slowly and accelerates until the end
+        EaseOut,    //!< Starts fast and decelerates until the end
+        EaseInOut   //!< Accelerates until halfway and decelerates afterwards
+    };
+
+
     namespace priv
     {
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        class TGUI_API Animation
+        /// @internal
+        /// @brief Plays the move, resize and fade animations of widgets
+        ///
+        /// The animations are stored per type in separate arrays. All animations of the same type are advanced in a single loop
+        /// and only then are the new positions, sizes and opacities written to the widgets.
+        /// Each container has an engine for the animations of its child widgets, a widget without parent plays its own animations.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API AnimationEngine
         {
         public:
 
-            // Move constructor has to be explicitly declared since this class has a destructor
-            Animation(const Animation&) = default;
-            Animation(Animation&&) = default;
-            Animation& operator=(const Animation&) = default;
-            Animation& operator=(Animation&&) = default;
-            virtual ~Animation() = default;
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Starts an animation that moves the widget from the start position to the end position
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void addMoveAnimation(Widget* widget, Vector2f start, Layout2d end, Duration duration, EasingType easing, std::function<void()> finishedCallback = nullptr);
 
-            TGUI_NODISCARD AnimationType getType() const;
 
-            virtual bool update(Duration elapsedTime) = 0;
-            virtual void finish();
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Starts an animation that changes the size of the widget from the start size to the end size
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void addResizeAnimation(Widget* widget, Vector2f start, Layout2d end, Duration duration, EasingType easing, std::function<void()> finishedCallback = nullptr);
 
-        protected:
-            Animation(AnimationType type, std::shared_ptr<Widget> widget, Duration duration, std::function<void()> finishedCallback);
 
-        protected:
-            AnimationType m_type;
-            std::shared_ptr<Widget> m_widget;
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Starts an animation that changes the inherited opacity of the widget from the start to the end opacity
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void addFadeAnimation(Widget* widget, float start, float end, Duration duration, EasingType easing, std::function<void()> finishedCallback = nullptr);
 
-            Duration m_totalDuration;
-            Duration m_elapsedTime;
 
-            std::function<void()> m_finishedCallback;
-        };
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Advances the animations
+            ///
+            /// @param elapsedTime  Time passed since the last update
+            /// @param owner        Widget that owns the engine, its animations are even played when the widget is invisible
+            /// @param widget       Widget of which the animations should be played, or nullptr to play the animations of all widgets
+            ///
+            /// @return True if any animation was played
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool update(Duration elapsedTime, const Widget* owner, const Widget* widget = nullptr);
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        class TGUI_API MoveAnimation : public Animation
-        {
-        public:
-            MoveAnimation(std::shared_ptr<Widget> widget, Vector2f start, Layout2d end, Duration duration, std::function<void()> finishedCallback = nullptr);
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Sets whether the owner is updating the time of all its child widgets
+            ///
+            /// The container plays the animations of all its children at once, after which the widgets shouldn't play their own
+            /// animations when their time is updated. When updating the time of a single widget, only its animations are played.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void setBatchUpdateActive(bool active);
 
-            bool update(Duration elapsedTime) override;
 
-            void finish() override;
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns whether the owner is updating the time of all its child widgets
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            TGUI_NODISCARD bool isBatchUpdateActive() const;
 
-        private:
-            Vector2f m_startPos;
-            Layout2d m_endPos;
-        };
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Immediately finishes the animations of a given type that are playing on the widget
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void finishAnimations(const Widget* widget, AnimationType type);
 
-        class TGUI_API ResizeAnimation : public Animation
-        {
-        public:
-            ResizeAnimation(std::shared_ptr<Widget> widget, Vector2f start, Layout2d end, Duration duration, std::function<void()> finishedCallback = nullptr);
 
-            bool update(Duration elapsedTime) override;
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Immediately finishes all animations that are playing on the widget
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void finishAllAnimations(const Widget* widget);
 
-            void finish() override;
 
-        private:
-            Vector2f m_startSize;
-            Layout2d m_endSize;
-        };
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Stops all animations of the widget without finishing them
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void removeAnimations(const Widget* widget);
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        class TGUI_API FadeAnimation : public Animation
-        {
-        public:
-            FadeAnimation(std::shared_ptr<Widget> widget, float start, float end, Duration duration, std::function<void()> finishedCallback = nullptr);
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Transfers the animations of the widget to another engine, e.g. because the widget got a new parent
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void moveAnimations(const Widget* widget, AnimationEngine& target);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns whether an animation is playing on the widget
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            TGUI_NODISCARD bool hasAnimations(const Widget* widget) const;
 
-            bool update(Duration elapsedTime) override;
 
-            void finish() override;
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns whether no animations are playing at all
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            TGUI_NODISCARD bool empty() const;
 
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns whether the next call to update would advance any animation
+            ///
+            /// @param owner  Widget that owns the engine, its animations are even played when the widget is invisible
+            ///
+            /// Animations of other widgets are paused while those widgets are invisible.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            TGUI_NODISCARD bool hasPlayingAnimations(const Widget* owner) const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the progress of an animation after applying the easing curve
+            ///
+            /// @param easing    Easing curve to apply
+            /// @param progress  Fraction of the animation duration that has passed, between 0 and 1
+            ///
+            /// @return Fraction of the distance between the start and end value that has been covered
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            TGUI_NODISCARD static float applyEasing(EasingType easing, float progress);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            // Animations of a single type, stored as structure of arrays. The opacity animations only use the x values.
+            // Stopped animations have a nullptr as widget while the engine is being updated and are removed afterwards.
+            struct Tracks
+            {
+                std::vector<Widget*> widgets;
+                std::vector<Duration> elapsedTimes;
+                std::vector<Duration> durations;
+                std::vector<EasingType> easings;
+                std::vector<float> startX;
+                std::vector<float> startY;
+                std::vector<float> endX;
+                std::vector<float> endY;
+                std::vector<float> valueX;
+                std::vector<float> valueY;
+                std::vector<Layout2d> endLayouts;
+                std::vector<std::function<void()>> finishedCallbacks;
+            };
+
+            struct UpdateDepthGuard;
+
+            void addTrack(AnimationType type, Widget* widget, Vector2f start, Vector2f end, Layout2d endLayout,
+                          Duration duration, EasingType easing, std::function<void()> finishedCallback);
+            void finishTrack(AnimationType type, std::size_t index);
+            void removeTrack(AnimationType type, std::size_t index);
+            void removeStoppedTracks();
+
+            TGUI_NODISCARD Tracks& getTracks(AnimationType type);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         private:
-            float m_startOpacity;
-            float m_endOpacity;
+
+            Tracks m_tracks[3]; // Indexed by AnimationType
+            unsigned int m_updateDepth = 0;
+            bool m_stoppedTracksPending = false;
+            bool m_batchUpdateActive = false;
         };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
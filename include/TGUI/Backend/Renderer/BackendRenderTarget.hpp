@@ -115,6 +115,16 @@ namespace tgui
         virtual void removeClippingLayer();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the part of the gui that is currently visible
+        ///
+        /// @return Intersection of the view and all clipping layers, in the same coordinates as the view
+        ///
+        /// Anything that is drawn outside this rectangle will be clipped.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD FloatRect getClipRect() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws borders inside a provided rectangle
         ///
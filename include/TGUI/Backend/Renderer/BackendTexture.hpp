@@ -29,6 +29,7 @@
 #include <TGUI/Font.hpp>
 #include <TGUI/String.hpp>
 #include <memory>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -50,11 +51,15 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the texture from an array of 32-bits RGBA pixels
         ///
-        /// @param size   Width and height of the image to create
-        /// @param pixels Moved pointer to array of size.x*size.y*4 bytes with RGBA pixels, or nullptr to create an empty texture
-        /// @param smooth Should the smooth filter be enabled or not?
+        /// @param size       Width and height of the image to create
+        /// @param pixels     Moved pointer to array of size.x*size.y*4 bytes with RGBA pixels, or nullptr to create an empty texture
+        /// @param smooth     Should the smooth filter be enabled or not?
+        /// @param keepPixels Should the RGBA pixels remain accessible via getPixels after the texture has been loaded?
+        ///
+        /// Unless keepPixels is true, the pixels are freed after uploading them and only a compact transparency mask
+        /// (1 bit per pixel or run-length encoded, whichever is smaller) is kept to answer isTransparentPixel.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        bool load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels, bool smooth);
+        bool load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels, bool smooth, bool keepPixels = false);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -92,6 +97,38 @@ namespace tgui
         TGUI_NODISCARD bool isSmooth() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether mipmaps should be generated for the texture
+        ///
+        /// @param mipmapped  True if the texture should be mipmapped, false to only store the full resolution image
+        ///
+        /// Mipmaps improve the quality and performance of drawing the texture at a size that is much smaller than the image.
+        /// They require about a third more video memory. When the texture is reloaded, the mipmaps are regenerated.
+        ///
+        /// Backends that don't support mipmaps will ignore this call and isMipmapped will keep returning false.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setMipmapped(bool mipmapped);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the texture is mipmapped
+        ///
+        /// @return True if mipmaps are generated for the texture, false if only the full resolution image is stored
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isMipmapped() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether mipmaps were actually generated for the texture
+        ///
+        /// @return True if the texture is mipmapped and the backend supports mipmaps for a texture of this size
+        ///
+        /// This differs from isMipmapped when the backend can't generate mipmaps for some textures (e.g. textures that don't
+        /// have a power-of-two size on OpenGL ES 2.0). The memory usage reported by getGpuMemoryUsage is based on this value.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual bool hasMipmaps() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Checks if a certain pixel is transparent
         ///
@@ -106,16 +143,64 @@ namespace tgui
         /// @brief Returns a pointer to the pixels (read-only)
         ///
         /// @return Pointer to getSize().x * getSize().y * 4 bytes of RGBA pixels, or nullptr if the pixel data isn't stored.
+        ///
+        /// The pixels are only stored when the texture was loaded with the keepPixels parameter set to true.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD const std::uint8_t* getPixels() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of RAM that is used to store the pixels and transparency mask of this texture
+        ///
+        /// @return Amount of bytes used by the CPU-side copy of the image (excludes the memory used by the GPU)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getPixelMemoryUsage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of video memory that is used by this texture
+        ///
+        /// @return Amount of bytes needed to store the texture on the GPU, including its mipmaps if they were generated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getGpuMemoryUsage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Builds the transparency mask from the alpha channel of the RGBA pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void createTransparencyMask(const std::uint8_t* pixels);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the stored pixels and the transparency mask
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearPixelData();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        enum class TransparencyMaskType : std::uint8_t
+        {
+            None,           //!< No mask is available, isTransparentPixel will use the pixels if they are stored
+            Opaque,         //!< All pixels are opaque
+            Transparent,    //!< All pixels are transparent
+            Bits,           //!< One bit per pixel, stored in m_transparencyBits
+            RunLength       //!< Every row stores the x positions where the transparency changes, starting from opaque
+        };
+
         Vector2u m_imageSize;
         std::unique_ptr<std::uint8_t[]> m_pixels;
         bool m_isSmooth = true;
+        bool m_isMipmapped = false;
+
+        TransparencyMaskType m_transparencyMaskType = TransparencyMaskType::None;
+        std::vector<std::uint8_t> m_transparencyBits;
+        std::vector<std::uint32_t> m_transparencyRowOffsets; // Index in m_transparencyRuns of the first run of each row
+        std::vector<std::uint16_t> m_transparencyRuns;
     };
 }
 
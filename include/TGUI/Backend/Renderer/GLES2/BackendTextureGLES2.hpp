@@ -65,6 +65,27 @@ namespace tgui
         void setSmooth(bool smooth) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether mipmaps should be generated for the texture
+        ///
+        /// @param mipmapped  True if the texture should be mipmapped, false to only store the full resolution image
+        ///
+        /// If the texture was already loaded then it is recreated with a different amount of mipmap levels.
+        ///
+        /// OpenGL ES 2.0 only supports mipmaps for textures of which the width and height are a power of two.
+        /// Mipmaps will not be generated for other textures, even when isMipmapped returns true.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMipmapped(bool mipmapped) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether mipmaps were actually generated for the texture
+        ///
+        /// @return True if the texture is mipmapped and either OpenGL ES 3 is used or the size of the texture is a power of two
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool hasMipmaps() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the id of the OpenGL texture
         /// @return Texture id
@@ -72,6 +93,15 @@ namespace tgui
         TGUI_NODISCARD unsigned int getInternalTexture() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Uploads the pixels to the GPU, either in the existing texture or in a newly created one, and regenerates the mipmaps
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void uploadPixels(const std::uint8_t* pixels, bool reuseTexture);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -79,6 +79,12 @@ namespace tgui
     namespace priv
     {
         void checkAndLogErrorOpenGL(const char* file, unsigned int line, const char* expression);
+
+        // Returns the GL_TEXTURE_MIN_FILTER value to use for a texture with the given settings
+        TGUI_NODISCARD GLint getTextureMinFilterOpenGL(bool smooth, bool mipmapped);
+
+        // Returns the amount of mipmap levels that a full mipmap chain of a texture with the given size consists of
+        TGUI_NODISCARD GLsizei getMipmapLevelCountOpenGL(unsigned int width, unsigned int height);
     }
 }
 
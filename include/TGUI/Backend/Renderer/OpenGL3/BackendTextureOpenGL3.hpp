@@ -65,6 +65,16 @@ namespace tgui
         void setSmooth(bool smooth) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether mipmaps should be generated for the texture
+        ///
+        /// @param mipmapped  True if the texture should be mipmapped, false to only store the full resolution image
+        ///
+        /// If the texture was already loaded then it is recreated with a different amount of mipmap levels.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMipmapped(bool mipmapped) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the id of the OpenGL texture
         /// @return Texture id
@@ -72,6 +82,15 @@ namespace tgui
         TGUI_NODISCARD unsigned int getInternalTexture() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Uploads the pixels to the GPU, either in the existing texture or in a newly created one, and regenerates the mipmaps
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void uploadPixels(const std::uint8_t* pixels, bool reuseTexture);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
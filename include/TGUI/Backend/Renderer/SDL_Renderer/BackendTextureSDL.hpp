@@ -76,6 +76,14 @@ namespace tgui
         void setSmooth(bool smooth) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Does nothing, SDL_Renderer doesn't support mipmapped textures
+        ///
+        /// @param mipmapped  Ignored parameter, isMipmapped will always return false
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMipmapped(bool mipmapped) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns a pointer to the internal SDL_Texture
         /// @return Pointer to internal texture
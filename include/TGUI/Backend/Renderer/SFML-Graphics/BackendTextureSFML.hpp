@@ -67,6 +67,17 @@ namespace tgui
         void setSmooth(bool smooth) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether mipmaps should be generated for the texture
+        ///
+        /// @param mipmapped  True if the texture should be mipmapped, false to only store the full resolution image
+        ///
+        /// Mipmaps are generated with sf::Texture::generateMipmap. If the graphics driver doesn't support this then
+        /// isMipmapped will keep returning false.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMipmapped(bool mipmapped) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns a reference to the internal SFML texture
         /// @return Reference to internal texture
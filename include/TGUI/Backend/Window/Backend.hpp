@@ -219,6 +219,15 @@ namespace tgui
         virtual void closeVirtualKeyboard();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Wakes up the main loop of the gui when it is waiting for events
+        ///
+        /// This function can be called from any thread. It is called when a signal or event is posted, so that the main loop
+        /// won't keep waiting for input before handling it. If this function isn't overriden then calling it does nothing.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void wakeUpEventLoop();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Checks the state for one of the modifier keys
         ///
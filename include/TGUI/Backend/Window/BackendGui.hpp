@@ -32,6 +32,7 @@
 #include <TGUI/Event.hpp>
 #include <TGUI/Cursor.hpp>
 #include <chrono>
+#include <cstdint>
 #include <stack>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -150,6 +151,9 @@ namespace tgui
         ///
         /// @return Has the event been consumed?
         ///         When this function returns false, then the event was ignored by all widgets.
+        ///         Events that are queued because input events are coalesced always return false.
+        ///
+        /// @see setInputEventsCoalesced
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool handleEvent(Event event);
 
@@ -549,6 +553,114 @@ namespace tgui
         void setDrawingUpdatesTime(bool drawUpdatesTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether changes to widgets that other layouts depend on are propagated immediately or in batch
+        ///
+        /// @param deferred  False if layouts are updated as soon as a widget they depend on changes (default),
+        ///                  true if dependent widgets are only repositioned and resized when flushLayout() is called
+        ///
+        /// When layout updates are deferred, a change to the position or size of a widget only marks the widgets that depend on it.
+        /// The gui calls flushLayout() before handling an event and before drawing, which updates each of these widgets once,
+        /// in dependency order, even when many widgets were changed in between. Until the layout is flushed, widgets with a
+        /// relative layout may thus not have been moved or resized yet and the onPositionChange and onSizeChange signals
+        /// of these widgets are only triggered while flushing.
+        ///
+        /// Resizing the window always updates the layouts in batch, regardless of this setting.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLayoutUpdatesDeferred(bool deferred);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether changes to widgets that other layouts depend on are only propagated when flushing the layout
+        ///
+        /// @return Are layout updates deferred until flushLayout() is called?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool getLayoutUpdatesDeferred() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the position and size of all widgets whose layouts changed while layout updates were deferred
+        ///
+        /// Widgets are updated in dependency order, so that a widget is only repositioned or resized after all the widgets
+        /// that its layouts refer to were updated.
+        ///
+        /// @see setLayoutUpdatesDeferred
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushLayout();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Remembers that a layout of the widget changed while layout updates are deferred
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleLayoutUpdate(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether mouse move and mouse wheel events are merged before they are passed to the widgets
+        ///
+        /// @param coalesced  False if handleEvent immediately passes every event to the widgets (default),
+        ///                   true if mouse move and mouse wheel events are queued until flushInputEvents() is called
+        ///
+        /// When input events are coalesced, a mouse move event replaces the mouse move event that was queued right before it
+        /// and scrolling the mouse wheel at the same position is added to the queued mouse wheel event. The queue is processed
+        /// when handleEvent receives any other type of event, when flushInputEvents() is called and before drawing.
+        /// A burst of events from a high-frequency mouse or touch screen thus only requires searching the widget below the
+        /// mouse once per frame instead of once per event.
+        ///
+        /// Since queued events are only processed later, handleEvent returns false for them.
+        /// When enabled, mainLoop() flushes the queue once per iteration, after all pending events were handled.
+        ///
+        /// @see setRawMouseInput
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setInputEventsCoalesced(bool coalesced);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether mouse move and mouse wheel events are merged before they are passed to the widgets
+        ///
+        /// @return Are mouse move and mouse wheel events queued until flushInputEvents() is called?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool getInputEventsCoalesced() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether intermediate mouse positions are kept when input events are coalesced
+        ///
+        /// @param raw  True to pass every mouse move event to the widgets (e.g. to draw smooth lines on a Canvas),
+        ///             false to only pass the last position of consecutive mouse move events (default)
+        ///
+        /// Mouse wheel events are still merged when raw mouse input is enabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRawMouseInput(bool raw);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether intermediate mouse positions are kept when input events are coalesced
+        ///
+        /// @return Is every mouse move event passed to the widgets?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool getRawMouseInput() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Passes the mouse move and mouse wheel events that were queued while coalescing input events to the widgets
+        ///
+        /// @return Has any of the queued events been consumed?
+        ///
+        /// @see setInputEventsCoalesced
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool flushInputEvents();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of events that were merged into another event instead of being processed separately
+        ///
+        /// @return Number of mouse move and mouse wheel events for which no search for the widget below the mouse was needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::uint64_t getCoalescedInputEventCount() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Updates the internal clock (for timers, animations and blinking edit cursors)
         ///
@@ -569,6 +681,17 @@ namespace tgui
         bool updateTime(Duration elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long the gui can wait for events before updateTime() has to be called again
+        ///
+        /// @return Time until a timer expires, an animation or blinking caret has to be updated, a tool tip should appear or
+        ///         a posted signal has to be emitted. An empty object is returned when nothing changes until an event occurs.
+        ///
+        /// This function is used by mainLoop() to sleep until the next event or until the gui changes, whichever comes first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Optional<Duration> getTimeUntilNextUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Converts the pixel coordinate to a position within the view
@@ -587,6 +710,10 @@ namespace tgui
         /// This function is only intended in cases where your program only needs to respond to gui events.
         /// For multimedia applications, games, or other programs where you want a high framerate or do a lot of processing
         /// in the main loop, you should use your own main loop.
+        ///
+        /// The main loop sleeps until an event arrives or until the gui has to be updated (see getTimeUntilNextUpdate), so an
+        /// idle gui uses almost no CPU. Custom widgets that change in their updateTime function should therefore also override
+        /// Widget::getTimeUntilNextUpdate.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void mainLoop(Color clearColor = {240, 240, 240}) = 0;
 
@@ -601,6 +728,12 @@ namespace tgui
         virtual void updateContainerSize();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes the event to the widgets, without queueing it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool processEvent(const Event& event);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -627,8 +760,15 @@ namespace tgui
         FloatRect m_lastView;
 
         bool m_drawUpdatesTime = true;
+        bool m_layoutUpdatesDeferred = false;
+        std::vector<std::weak_ptr<Widget>> m_pendingLayoutWidgets;
         bool m_tabKeyUsageEnabled = true;
 
+        bool m_inputEventsCoalesced = false;
+        bool m_rawMouseInput = false;
+        std::vector<Event> m_queuedInputEvents;
+        std::uint64_t m_coalescedInputEventCount = 0;
+
         Cursor::Type m_requestedMouseCursor = Cursor::Type::Arrow;
         std::stack<Cursor::Type> m_overrideMouseCursors;
 
@@ -122,6 +122,14 @@ namespace tgui
         TGUI_NODISCARD String getClipboard() const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Posts an empty event to wake up the main loop of the gui when it is waiting for events
+        ///
+        /// This function can be called from any thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wakeUpEventLoop() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
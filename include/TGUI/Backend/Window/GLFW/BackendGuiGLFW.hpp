@@ -228,10 +228,18 @@ namespace tgui
         void updateContainerSize() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called by the callbacks that are installed by mainLoop before the gui handles the event. The clock is updated before
+        // handling the first event after a wait, so that e.g. the double click timeout is correct after a long wait.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mainLoopEventReceived();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         GLFWwindow* m_window = nullptr;
+        bool m_mainLoopEventReceived = false; // Reset by mainLoop before waiting for events
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -105,6 +105,14 @@ namespace tgui
         void closeVirtualKeyboard() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Pushes an event to wake up the main loop of the gui when it is waiting for events
+        ///
+        /// This function can be called from any thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wakeUpEventLoop() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Checks the state for one of the modifier keys
         ///
@@ -32,8 +32,8 @@
 #include <TGUI/Outline.hpp>
 
 #include <unordered_map>
+#include <functional>
 #include <memory>
-#include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -96,6 +96,8 @@ namespace dev
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // Topic and callback ids are handles that are never 0 and that don't become valid again after being destroyed.
+    // Apart from postEvent, the functions may only be called from the thread that handles the widgets.
     class TGUI_API MessageBroker
     {
     public:
@@ -110,13 +112,14 @@ namespace dev
 
         static void sendEvent(std::uint64_t topicId);
 
-    private:
-        static std::unordered_map<std::uint64_t, std::set<std::uint64_t>> m_topicIdToCallbackIds;
-        static std::unordered_map<std::uint64_t, std::uint64_t> m_callbackIdToTopicId;
-        static std::unordered_map<std::uint64_t, std::function<void()>> m_listeners; // CallbackId -> Func
+        // Can be called from any thread. The subscribers are called later on the gui thread, by dispatchPostedEvents.
+        static void postEvent(std::uint64_t topicId);
+
+        // Called by the gui when updating the time. Returns true when at least one subscriber was called.
+        static bool dispatchPostedEvents();
 
-        // All topic and callback ids are unique and non-overlapping
-        static std::uint64_t m_lastId;
+        // Returns whether dispatchPostedEvents has events to dispatch
+        TGUI_NODISCARD static bool hasPostedEvents();
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
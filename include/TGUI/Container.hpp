@@ -386,6 +386,74 @@ namespace tgui
         TGUI_NODISCARD virtual Widget::Ptr getWidgetAtPosition(Vector2f pos) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Enables or disables the spatial index that is used to find the child widget below the mouse
+        ///
+        /// @param enabled  Should the bounds of the child widgets be stored in a uniform grid?
+        /// @param cellSize Width and height of a single cell in the grid
+        ///
+        /// Without the index, every child widget has to be checked each time the mouse moves. Containers with thousands of
+        /// children can enable the index to only check the children that overlap with the grid cell below the mouse.
+        /// When drawing the container, only the children in the grid cells that are visible will be considered.
+        /// Children that are rotated or scaled are not stored in the grid and are always checked.
+        ///
+        /// The index assumes that a child widget can only be found inside its bounding rectangle (the union of its size and
+        /// its full size). It should not be used for widgets that accept the mouse outside their bounds, such as the borders
+        /// of a resizable ChildWindow.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexEnabled(bool enabled, float cellSize = 128);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the spatial index is used to find the child widget below the mouse
+        ///
+        /// @return Is the spatial index enabled?
+        ///
+        /// @see setSpatialIndexEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isSpatialIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts a batch of changes during which the container won't rearrange its child widgets
+        ///
+        /// Layout containers such as HorizontalLayout and Grid reposition all their children every time a widget is added,
+        /// removed or resized. When filling such a container with many widgets, the work can be postponed by surrounding
+        /// the changes with beginUpdate and endUpdate, so that the children are only arranged once.
+        ///
+        /// Calls can be nested, the children are rearranged when the last endUpdate is called.
+        ///
+        /// @code
+        /// layout->beginUpdate();
+        /// for (unsigned int i = 0; i < 1000; ++i)
+        ///     layout->add(tgui::Button::create(tgui::String(i)));
+        /// layout->endUpdate();
+        /// @endcode
+        ///
+        /// @warning The positions and sizes of the children that are managed by the container are not up-to-date until
+        ///          endUpdate is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends a batch of changes that was started with beginUpdate
+        ///
+        /// If this ends the outermost batch and changes were made in the meantime, the child widgets are rearranged.
+        ///
+        /// @see beginUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a batch of changes that was started with beginUpdate is still in progress
+        ///
+        /// @return Is beginUpdate called more often than endUpdate?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isUpdating() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget in this container
         ///
@@ -477,6 +545,13 @@ namespace tgui
         void childWidgetFocused(const Widget::Ptr& child);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when the position, size, origin, scale or rotation of one of the child widgets changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetBoundsChanged(Widget* child);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -549,6 +624,13 @@ namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns how long it takes before updateTime has to be called again for the widget to change
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Optional<Duration> getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called when the widget is added to a container. You should not call this function yourself.
@@ -641,6 +723,43 @@ namespace tgui
         void widgetAdded(const Widget::Ptr& widgetPtr);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the child widget in m_widgets, or m_widgets.size() when it isn't a child of this container.
+        // The index cached in the widget is used when it is still correct, otherwise the cache of all children is refreshed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t findWidgetIndex(const Widget* widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the cached index of the child widgets in the range [first, last) after they were moved inside m_widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgetIndices(std::size_t first, std::size_t last);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Map from widget name to the named widgets in the tree, only stored in the root container and built on first use
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct NameIndex;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the name index of the root container of this widget tree, or nullptr if it wasn't built yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD NameIndex* getRootNameIndex() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Destroys the name index of the root container, it will be rebuilt the next time a widget is searched by name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateRootNameIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the name index of the root container when a widget inside this container is renamed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetNameChanged(Widget* widget, const String& oldName);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Turns texture and font filenames into paths relative to the form file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -653,6 +772,26 @@ namespace tgui
         void loadWidgetsImpl(const std::unique_ptr<DataIO::Node>& rootNode, bool replaceExisting);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Repositions the child widgets, for containers that arrange their children
+        ///
+        /// This function should not be called directly by derived classes, they should call requestWidgetsUpdate instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void updateWidgets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls updateWidgets, or postpones the call until endUpdate when a batch of changes is in progress
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestWidgetsUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Uniform grid of child widget bounds, only created when the spatial index is enabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct SpatialIndex;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -668,8 +807,17 @@ namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        std::unique_ptr<SpatialIndex> m_spatialIndex;
+
+        mutable std::unique_ptr<NameIndex> m_nameIndex;
+
+        // Nesting depth of beginUpdate calls and whether updateWidgets still has to be called when the batch ends
+        unsigned int m_updateDepth = 0;
+        bool m_widgetsUpdatePending = false;
+
 
         friend class SubwidgetContainer; // Needs access to save and load functions
+        friend class Widget; // Informs the container when a child widget is renamed
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
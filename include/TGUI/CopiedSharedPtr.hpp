@@ -47,8 +47,12 @@ namespace tgui
         {
         }
 
+        CopiedSharedPtr(std::nullptr_t) noexcept
+        {
+        }
+
         CopiedSharedPtr(const CopiedSharedPtr& other) noexcept
-            : m_WidgetPtr{std::make_shared<WidgetType>(*other.m_WidgetPtr)}
+            : m_WidgetPtr{other.m_WidgetPtr ? std::make_shared<WidgetType>(*other.m_WidgetPtr) : nullptr}
         {
         }
 
@@ -60,7 +64,7 @@ namespace tgui
         CopiedSharedPtr& operator=(const CopiedSharedPtr& other) noexcept
         {
             if (&other != this)
-                m_WidgetPtr = std::make_shared<WidgetType>(*other.m_WidgetPtr);
+                m_WidgetPtr = other.m_WidgetPtr ? std::make_shared<WidgetType>(*other.m_WidgetPtr) : nullptr;
 
             return *this;
         }
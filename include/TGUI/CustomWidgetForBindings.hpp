@@ -184,6 +184,13 @@ namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns how long it takes before updateTime has to be called again for the widget to change
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Optional<Duration> getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
@@ -298,6 +305,7 @@ namespace tgui
         std::function<Vector2f()>                       implGetAbsolutePosition;
         std::function<Vector2f()>                       implGetWidgetOffset;
         std::function<bool(Duration)>                   implUpdateTimeFunction;
+        std::function<Optional<Duration>()>             implGetTimeUntilNextUpdate;
         std::function<bool(Vector2f)>                   implMouseOnWidget;
         std::function<void(Vector2f)>                   implLeftMousePressed;
         std::function<void(Vector2f)>                   implLeftMouseReleased;
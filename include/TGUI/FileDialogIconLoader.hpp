@@ -68,6 +68,14 @@ namespace tgui
         TGUI_NODISCARD virtual bool update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a background thread is still running, in which case update() has to keep being called
+        ///
+        /// @return Is the icon loader waiting for a thread to finish?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual bool isLoading() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether this icon loader does something or whether its functions are no-ops
         ///
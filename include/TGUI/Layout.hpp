@@ -30,8 +30,10 @@
 #include <TGUI/Vector2.hpp>
 #include <type_traits>
 #include <functional>
+#include <unordered_set>
 #include <memory>
 #include <string>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -216,6 +218,46 @@ namespace tgui
         void recalculateValue();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Recalculates the values of the topmost layouts of the given layouts
+        ///
+        /// This is used by widgets to update all layouts that depend on them. Each topmost layout is only recalculated once,
+        /// even when several of its operands are bound to the widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void recalculateLayouts(const std::unordered_set<Layout*>& layouts);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the topmost layout of which this layout is an operand, or the layout itself if it has no parent
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Layout* getRootLayout();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the widget whose position or size is determined by this layout (or the layout it is part of)
+        ///
+        /// @return Connected widget, or nullptr if the layout isn't connected to a widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Widget* getConnectedWidget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns whether the value changed while layout updates were deferred and the widget wasn't informed yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isUpdatePending() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Informs the connected widget about a value change that was deferred
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyPendingUpdate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// Returns a pointer to the left operand (or nullptr if this layout does not store an operation on two operands)
@@ -233,6 +275,23 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        // Single step in the calculation of a layout. Constants and bound values are pushed on a stack,
+        // while the other operations replace the two values on top of the stack with their result.
+        struct Instruction
+        {
+            Operation operation;
+            float value; // Value to push when the operation is Value or BindingString
+            const Widget* widget; // Widget to read from when the operation is a binding
+            Layout* node; // Operand that stores the result, or nullptr if the result isn't stored in an operand
+        };
+
+        // Flattened form of a layout and all its operands in postfix order, only the topmost layout has a program
+        struct Program
+        {
+            std::vector<Instruction> instructions;
+            std::vector<float> stack;
+        };
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // If a widget is bound, inform it that the layout no longer binds it
@@ -247,10 +306,35 @@ namespace tgui
         void resetPointers();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the value of this layout from the values of its operands or from the bound widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float calculateValue() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Throws away the compiled program of the topmost layout, it will be compiled again when the value is recalculated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateProgram();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the instructions to calculate the value of the layout to the program, operands come before their operation
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void compileInstructions(std::vector<Instruction>& instructions);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Evaluates the compiled program (and compiles it first if needed) to find the value of the topmost layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float evaluateProgram();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Check whether sublayouts contain a string that refers to a widget which should be bound.
+        // Returns whether any of the layouts now refers to a different widget or property than before.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingStringRecursive(Widget* widget, bool xAxis);
+        TGUI_NODISCARD bool parseBindingStringRecursive(Widget* widget, bool xAxis);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -270,6 +354,10 @@ namespace tgui
         Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
         String m_boundString; // String referring to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
         std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
+        Widget* m_connectedWidget = nullptr; // Widget that is informed via m_connectedWidgetCallback
+        std::unique_ptr<Program> m_program = nullptr; // Compiled program in case this is the topmost layout and it isn't a constant
+        bool m_updatePending = false; // Was the callback postponed because the gui defers layout updates?
+        bool m_recalculationQueued = false; // Used by recalculateLayouts to only recalculate each topmost layout once
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
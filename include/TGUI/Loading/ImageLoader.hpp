@@ -64,6 +64,40 @@ namespace tgui
         /// @return RGBA array of pixels of loaded image (4 * imageSize.x * imageSize.y bytes), or nullptr if loading failed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static std::unique_ptr<std::uint8_t[]> loadFromMemory(const std::uint8_t* data, std::size_t dataSize, Vector2u& imageSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads an image from a file and reduces its resolution when it is much larger than needed
+        ///
+        /// @param filename     The file to load
+        /// @param maximumSize  Size at which the image will be displayed
+        /// @param imageSize    Output parameter that will contain the width and height of the image if loaded successfully
+        ///
+        /// @return RGBA array of pixels of loaded image (4 * imageSize.x * imageSize.y bytes), or nullptr if loading failed
+        ///
+        /// @see loadFromMemory(const std::uint8_t*, std::size_t, Vector2u, Vector2u&)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::unique_ptr<std::uint8_t[]> loadFromFile(const String& filename, Vector2u maximumSize, Vector2u& imageSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads an image from memory and reduces its resolution when it is much larger than needed
+        ///
+        /// @param data         Pointer to the file in memory
+        /// @param dataSize     Amount of bytes of the file in memory
+        /// @param maximumSize  Size at which the image will be displayed
+        /// @param imageSize    Output parameter that will contain the width and height of the image if loaded successfully
+        ///
+        /// @return RGBA array of pixels of loaded image (4 * imageSize.x * imageSize.y bytes), or nullptr if loading failed
+        ///
+        /// The image is halved in size (by averaging blocks of 2x2 pixels) for as long as it remains at least as large as
+        /// maximumSize. The returned image is thus never smaller than maximumSize (unless the file itself is smaller), and
+        /// less than twice as large in at least one direction. This keeps the quality when drawing the image scaled down,
+        /// while storing far fewer pixels for e.g. thumbnails of large photos.
+        ///
+        /// The returned pixels can be passed to Texture::loadFromPixelData to upload only the reduced image to the GPU.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::unique_ptr<std::uint8_t[]> loadFromMemory(const std::uint8_t* data, std::size_t dataSize, Vector2u maximumSize, Vector2u& imageSize);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
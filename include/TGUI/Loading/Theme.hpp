@@ -276,6 +276,28 @@ namespace tgui
         TGUI_NODISCARD static std::map<String, String> getRendererInheritedGlobalProperties(const String& widgetType);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts a value from the theme loader into the object that is stored in the renderers
+        ///
+        /// @param property  Name of the renderer property or global property
+        /// @param value     Serialized value of the property
+        ///
+        /// @return Deserialized value if the type of the property is known, the serialized string otherwise
+        ///
+        /// Identical values are only deserialized once per theme, all renderers receive a copy of the same object.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD ObjectConverter resolveValue(const String& property, const String& value);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a renderer from the properties that were loaded by the theme loader
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<RendererData> createRenderer(const std::map<String, String>& properties);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -287,6 +309,7 @@ namespace tgui
 
         std::map<String, std::shared_ptr<RendererData>> m_renderers; //!< Maps ids to renderer datas
         std::map<String, ObjectConverter> m_globalProperties; //!< Maps id to value
+        std::map<std::pair<ObjectConverter::Type, String>, ObjectConverter> m_resolvedValues; //!< Deserialized values, shared by all renderers
         String m_primary;
     };
 
@@ -0,0 +1,88 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_PIXEL_KERNELS_HPP
+#define TGUI_PIXEL_KERNELS_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Class that is internally used to process arrays of pixels
+    ///
+    /// The functions are vectorized with SSE2 or NEON when the library is compiled for a CPU that supports them.
+    /// On x86 CPUs the AVX2 instructions are also used when they are detected at runtime.
+    /// A scalar implementation is used on other CPUs and for the pixels that remain after processing blocks of pixels.
+    /// All implementations give identical results.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API PixelKernels
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts 24-bit RGB pixels to 32-bit RGBA pixels that are fully opaque
+        ///
+        /// @param rgbPixels   Array of pixelCount*3 bytes with RGB pixels
+        /// @param rgbaPixels  Array of pixelCount*4 bytes in which the RGBA pixels will be written
+        /// @param pixelCount  Amount of pixels to convert
+        ///
+        /// The arrays are not allowed to overlap.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void convertRgbToRgba(const std::uint8_t* rgbPixels, std::uint8_t* rgbaPixels, std::size_t pixelCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a mask with one bit per pixel which indicates whether the pixel is fully transparent
+        ///
+        /// @param pixels      Array of pixelCount*4 bytes with RGBA pixels
+        /// @param pixelCount  Amount of pixels in the array
+        /// @param mask        Array of (pixelCount+7)/8 bytes in which the bits are written (least significant bit first)
+        ///
+        /// @return Amount of pixels in the array with an alpha value of 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t extractTransparencyMask(const std::uint8_t* pixels, std::size_t pixelCount, std::uint8_t* mask);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the name of the instructions that are used by the functions in this class
+        ///
+        /// @return "AVX2", "SSE2", "NEON" or "Scalar"
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static const char* getInstructionSet();
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PIXEL_KERNELS_HPP
@@ -34,7 +34,8 @@
 #define TGUI_RENDERER_PROPERTY_OUTLINE(CLASS, NAME) \
     tgui::Outline CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        static const tgui::RendererPropertyId propertyId = tgui::RendererPropertyRegistry::getId(U"" #NAME); \
+        const auto it = m_data->propertyValuePairs.find(propertyId); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getOutline(); \
         else \
@@ -42,7 +43,8 @@
     } \
     void CLASS::set##NAME(const tgui::Outline& outline) \
     { \
-        setProperty(tgui::String(#NAME), {outline}); \
+        static const tgui::RendererPropertyId propertyId = tgui::RendererPropertyRegistry::getId(U"" #NAME); \
+        setProperty(propertyId, {outline}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,7 +52,8 @@
 #define TGUI_RENDERER_PROPERTY_COLOR(CLASS, NAME, DEFAULT) \
     tgui::Color CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        static const tgui::RendererPropertyId propertyId = tgui::RendererPropertyRegistry::getId(U"" #NAME); \
+        const auto it = m_data->propertyValuePairs.find(propertyId); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getColor(); \
         else \
@@ -58,7 +61,8 @@
     } \
     void CLASS::set##NAME(tgui::Color color) \
     { \
-        setProperty(tgui::String(#NAME), {color}); \
+        static const tgui::RendererPropertyId propertyId = tgui::RendererPropertyRegistry::getId(U"" #NAME); \
+        setProperty(propertyId, {color}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,7 +70,8 @@
 #define TGUI_RENDERER_PROPERTY_TEXT_STYLE(CLASS, NAME, DEFAULT) \
     tgui::TextStyles CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        static const tgui::RendererPropertyId propertyId = tgui::RendererPropertyRegistry::getId(U"" #NAME); \
+        const auto it = m_data->propertyValuePairs.find(propertyId); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getTextStyle(); \
         else \
@@ -74,7 +79,8 @@
     } \
     void CLASS::set##NAME(tgui::TextStyles style) \
     { \
-        setProperty(tgui::String(#NAME), ObjectConverter{style}); \
+        static const tgui::RendererPropertyId propertyId = tgui::RendererPropertyRegistry::getId(U"" #NAME); \
+        setProperty(propertyId, ObjectConverter{style}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,7 +88,8 @@
 #define TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     float CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        static const tgui::RendererPropertyId propertyId = tgui::RendererPropertyRegistry::getId(U"" #NAME); \
+        const auto it = m_data->propertyValuePairs.find(propertyId); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getNumber(); \
         else \
@@ -93,7 +100,8 @@
     TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     void CLASS::set##NAME(float number) \
     { \
-        setProperty(tgui::String(#NAME), ObjectConverter{number}); \
+        static const tgui::RendererPropertyId propertyId = tgui::RendererPropertyRegistry::getId(U"" #NAME); \
+        setProperty(propertyId, ObjectConverter{number}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,7 +109,8 @@
 #define TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     bool CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        static const tgui::RendererPropertyId propertyId = tgui::RendererPropertyRegistry::getId(U"" #NAME); \
+        const auto it = m_data->propertyValuePairs.find(propertyId); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getBool(); \
         else \
@@ -112,7 +121,8 @@
     TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     void CLASS::set##NAME(bool flag) \
     { \
-        setProperty(tgui::String(#NAME), ObjectConverter{flag}); \
+        static const tgui::RendererPropertyId propertyId = tgui::RendererPropertyRegistry::getId(U"" #NAME); \
+        setProperty(propertyId, ObjectConverter{flag}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -120,18 +130,20 @@
 #define TGUI_RENDERER_PROPERTY_TEXTURE(CLASS, NAME) \
     const tgui::Texture& CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        static const tgui::RendererPropertyId propertyId = tgui::RendererPropertyRegistry::getId(U"" #NAME); \
+        const auto it = m_data->propertyValuePairs.find(propertyId); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getTexture(); \
         else \
         { \
-            m_data->propertyValuePairs[tgui::String(#NAME)] = {tgui::Texture{}}; \
-            return m_data->propertyValuePairs[tgui::String(#NAME)].getTexture(); \
+            m_data->propertyValuePairs[propertyId] = {tgui::Texture{}}; \
+            return m_data->propertyValuePairs[propertyId].getTexture(); \
         } \
     } \
     void CLASS::set##NAME(const tgui::Texture& texture) \
     { \
-        setProperty(tgui::String(#NAME), {texture}); \
+        static const tgui::RendererPropertyId propertyId = tgui::RendererPropertyRegistry::getId(U"" #NAME); \
+        setProperty(propertyId, {texture}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,22 +151,24 @@
 #define TGUI_RENDERER_PROPERTY_RENDERER_WITH_DEFAULT(CLASS, NAME, RENDERER, DEFAULT) \
     std::shared_ptr<tgui::RendererData> CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        static const tgui::RendererPropertyId propertyId = tgui::RendererPropertyRegistry::getId(U"" #NAME); \
+        const auto it = m_data->propertyValuePairs.find(propertyId); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getRenderer(); \
         else \
         { \
             const auto& renderer = tgui::Theme::getDefault()->getRendererNoThrow(RENDERER); \
-            m_data->propertyValuePairs[tgui::String(#NAME)] = {renderer ? renderer : (DEFAULT)}; \
+            m_data->propertyValuePairs[propertyId] = {renderer ? renderer : (DEFAULT)}; \
             return renderer; \
         } \
     } \
     void CLASS::set##NAME(std::shared_ptr<tgui::RendererData> renderer) \
     { \
+        static const tgui::RendererPropertyId propertyId = tgui::RendererPropertyRegistry::getId(U"" #NAME); \
         if (renderer) \
-            setProperty(tgui::String(#NAME), {std::move(renderer)}); \
+            setProperty(propertyId, {std::move(renderer)}); \
         else \
-            setProperty(tgui::String(#NAME), {RendererData::create()}); \
+            setProperty(propertyId, {RendererData::create()}); \
     }
 
 #define TGUI_RENDERER_PROPERTY_RENDERER(CLASS, NAME, RENDERER) \
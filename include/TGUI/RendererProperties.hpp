@@ -0,0 +1,637 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_RENDERER_PROPERTIES_HPP
+#define TGUI_RENDERER_PROPERTIES_HPP
+
+
+#include <TGUI/ObjectConverter.hpp>
+#include <cstdint>
+#include <type_traits>
+#include <iterator>
+#include <memory>
+#include <vector>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Small integer that identifies an interned renderer property name
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    using RendererPropertyId = std::uint16_t;
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Ids of the renderer properties that are used by the widgets inside TGUI
+    ///
+    /// These ids are fixed at compile time and are assigned in alphabetical order, so sorting properties on their id results
+    /// in the same order as sorting them on their name. Other property names are given an id when they are first registered.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    namespace RendererProperty
+    {
+        enum : RendererPropertyId
+        {
+            ArrowBackgroundColor,
+            ArrowBackgroundColorDisabled,
+            ArrowBackgroundColorHover,
+            ArrowColor,
+            ArrowColorDisabled,
+            ArrowColorHover,
+            ArrowsOnNavigationButtonsVisible,
+            BackButton,
+            BackgroundColor,
+            BackgroundColorChecked,
+            BackgroundColorCheckedDisabled,
+            BackgroundColorCheckedHover,
+            BackgroundColorDisabled,
+            BackgroundColorDown,
+            BackgroundColorDownDisabled,
+            BackgroundColorDownFocused,
+            BackgroundColorDownHover,
+            BackgroundColorFocused,
+            BackgroundColorHover,
+            BorderBelowTitleBar,
+            BorderBetweenArrows,
+            BorderColor,
+            BorderColorChecked,
+            BorderColorCheckedDisabled,
+            BorderColorCheckedFocused,
+            BorderColorCheckedHover,
+            BorderColorDisabled,
+            BorderColorDown,
+            BorderColorDownDisabled,
+            BorderColorDownFocused,
+            BorderColorDownHover,
+            BorderColorFocused,
+            BorderColorHover,
+            Borders,
+            Button,
+            CaretColor,
+            CaretColorFocused,
+            CaretColorHover,
+            CaretWidth,
+            CheckColor,
+            CheckColorDisabled,
+            CheckColorHover,
+            CloseButton,
+            Color,
+            DefaultTextColor,
+            DefaultTextStyle,
+            DistanceToSide,
+            EditBox,
+            FileTypeComboBox,
+            FilenameLabel,
+            FillColor,
+            Font,
+            ForwardButton,
+            GridLinesColor,
+            HeaderBackgroundColor,
+            HeaderTextColor,
+            ImageRotation,
+            Label,
+            ListBox,
+            ListView,
+            MaximizeButton,
+            MinimizeButton,
+            MinimumResizableBorderWidth,
+            Opacity,
+            OpacityDisabled,
+            Padding,
+            PaddingBetweenButtons,
+            RoundedBorderRadius,
+            Scrollbar,
+            ScrollbarWidth,
+            SelectedBackgroundColor,
+            SelectedBackgroundColorHover,
+            SelectedBorderColor,
+            SelectedBorderColorHover,
+            SelectedTextBackgroundColor,
+            SelectedTextColor,
+            SelectedTextColorHover,
+            SelectedTextStyle,
+            SelectedTrackColor,
+            SelectedTrackColorHover,
+            SeparatorColor,
+            SeparatorSidePadding,
+            SeparatorThickness,
+            SeparatorVerticalPadding,
+            ShowTextOnTitleButtons,
+            Slider,
+            SpaceBetweenWidgets,
+            TextColor,
+            TextColorChecked,
+            TextColorCheckedDisabled,
+            TextColorCheckedHover,
+            TextColorDisabled,
+            TextColorDown,
+            TextColorDownDisabled,
+            TextColorDownFocused,
+            TextColorDownHover,
+            TextColorFilled,
+            TextColorFocused,
+            TextColorHover,
+            TextDistanceRatio,
+            TextOutlineColor,
+            TextOutlineThickness,
+            TextSize,
+            TextStyle,
+            TextStyleChecked,
+            TextStyleDisabled,
+            TextStyleDown,
+            TextStyleDownDisabled,
+            TextStyleDownFocused,
+            TextStyleDownHover,
+            TextStyleFocused,
+            TextStyleHover,
+            Texture,
+            TextureArrow,
+            TextureArrowDisabled,
+            TextureArrowDown,
+            TextureArrowDownHover,
+            TextureArrowHover,
+            TextureArrowUp,
+            TextureArrowUpHover,
+            TextureBackground,
+            TextureBackgroundDisabled,
+            TextureBranchCollapsed,
+            TextureBranchExpanded,
+            TextureChecked,
+            TextureCheckedDisabled,
+            TextureCheckedFocused,
+            TextureCheckedHover,
+            TextureDisabled,
+            TextureDisabledTab,
+            TextureDown,
+            TextureDownDisabled,
+            TextureDownFocused,
+            TextureDownHover,
+            TextureFill,
+            TextureFocused,
+            TextureForeground,
+            TextureHeaderBackground,
+            TextureHover,
+            TextureItemBackground,
+            TextureLeaf,
+            TextureSelectedItemBackground,
+            TextureSelectedTab,
+            TextureSelectedTabHover,
+            TextureSelectedTrack,
+            TextureSelectedTrackHover,
+            TextureTab,
+            TextureTabHover,
+            TextureThumb,
+            TextureThumbHover,
+            TextureTitleBar,
+            TextureTrack,
+            TextureTrackHover,
+            TextureUnchecked,
+            TextureUncheckedDisabled,
+            TextureUncheckedFocused,
+            TextureUncheckedHover,
+            ThumbColor,
+            ThumbColorHover,
+            ThumbWithinTrack,
+            TitleBarColor,
+            TitleBarHeight,
+            TitleColor,
+            TrackColor,
+            TrackColorHover,
+            TransparentTexture,
+            UpButton,
+            BuiltinCount //!< Amount of properties with an id that is fixed at compile time
+        };
+    }
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Maps renderer property names to small integer ids
+    ///
+    /// Every property name is only stored once and the ids remain valid for the lifetime of the program.
+    /// The functions can be called from any thread.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RendererPropertyRegistry
+    {
+    public:
+
+        static constexpr RendererPropertyId InvalidId = 0xFFFF; //!< Id returned by findId for names that were never registered
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of a property, registering the name when it wasn't known yet
+        ///
+        /// @param name  Name of the property
+        ///
+        /// @return Id of the property
+        ///
+        /// @throw Exception when too many different property names have been registered
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static RendererPropertyId getId(const String& name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of a property without registering it
+        ///
+        /// @param name  Name of the property
+        ///
+        /// @return Id of the property, or InvalidId if the name was never registered
+        ///
+        /// Looking up the string that was returned by getName doesn't require hashing the name when the property is one of
+        /// the properties from the RendererProperty enum.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static RendererPropertyId findId(const String& name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the name of a property
+        ///
+        /// @param id  Id of the property, as returned by getId
+        ///
+        /// @return Name of the property. The reference remains valid until the program ends.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static const String& getName(RendererPropertyId id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the type of the values that the widgets expect for a property
+        ///
+        /// @param id  Id of the property, or InvalidId
+        ///
+        /// @return Type of the property, or Type::None if the type isn't known (e.g. for properties registered at runtime)
+        ///
+        /// Themes use this to deserialize their values only once, instead of letting every renderer parse the same string.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static ObjectConverter::Type getType(RendererPropertyId id);
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Property-value pairs of a renderer, stored in a flat array that is sorted on property id
+    ///
+    /// The interface resembles the one of std::map<String, ObjectConverter>, but lookups are done by binary searching in a
+    /// contiguous array of ids instead of comparing strings. Iterating over the pairs happens in the order of the ids.
+    ///
+    /// References to values remain valid when other properties are added or removed, just like they were with std::map.
+    /// The name inside a pair should never be modified.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RendererPropertyMap
+    {
+    public:
+
+        using value_type = std::pair<String, ObjectConverter>;
+
+        /// @internal
+        template <typename ValueType, typename BaseIterator>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = typename std::remove_const<ValueType>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = ValueType*;
+            using reference = ValueType&;
+
+            Iterator() = default;
+
+            explicit Iterator(BaseIterator it) :
+                m_it{it}
+            {
+            }
+
+            template <typename OtherValueType, typename OtherBaseIterator>
+            Iterator(const Iterator<OtherValueType, OtherBaseIterator>& other) :
+                m_it{other.getBase()}
+            {
+            }
+
+            TGUI_NODISCARD reference operator*() const
+            {
+                return **m_it;
+            }
+
+            TGUI_NODISCARD pointer operator->() const
+            {
+                return m_it->get();
+            }
+
+            Iterator& operator++()
+            {
+                ++m_it;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator result = *this;
+                ++m_it;
+                return result;
+            }
+
+            Iterator& operator--()
+            {
+                --m_it;
+                return *this;
+            }
+
+            Iterator operator--(int)
+            {
+                Iterator result = *this;
+                --m_it;
+                return result;
+            }
+
+            template <typename OtherValueType, typename OtherBaseIterator>
+            TGUI_NODISCARD bool operator==(const Iterator<OtherValueType, OtherBaseIterator>& other) const
+            {
+                return m_it == other.getBase();
+            }
+
+            template <typename OtherValueType, typename OtherBaseIterator>
+            TGUI_NODISCARD bool operator!=(const Iterator<OtherValueType, OtherBaseIterator>& other) const
+            {
+                return m_it != other.getBase();
+            }
+
+            TGUI_NODISCARD BaseIterator getBase() const
+            {
+                return m_it;
+            }
+
+        private:
+            BaseIterator m_it;
+        };
+
+        using iterator = Iterator<value_type, std::vector<std::unique_ptr<value_type>>::iterator>;
+        using const_iterator = Iterator<const value_type, std::vector<std::unique_ptr<value_type>>::const_iterator>;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyMap() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the map from property-value pairs
+        ///
+        /// @param pairs  Properties to store
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyMap(const std::map<String, ObjectConverter>& pairs);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyMap(const RendererPropertyMap& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyMap(RendererPropertyMap&&) noexcept = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyMap& operator=(const RendererPropertyMap& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyMap& operator=(RendererPropertyMap&&) noexcept = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts the pairs to a std::map, for code that was written when renderers still stored their properties in it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD operator std::map<String, ObjectConverter>() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property, inserting an empty value when the property didn't exist yet
+        ///
+        /// @param id  Id of the property
+        ///
+        /// @return Reference to the stored value
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator[](RendererPropertyId id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property, inserting an empty value when the property didn't exist yet
+        ///
+        /// @param property  Name of the property
+        ///
+        /// @return Reference to the stored value
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator[](const String& property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Searches for a property
+        ///
+        /// @param id  Id of the property
+        ///
+        /// @return Iterator to the pair, or end() when the property isn't stored
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD iterator find(RendererPropertyId id);
+        TGUI_NODISCARD const_iterator find(RendererPropertyId id) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Searches for a property
+        ///
+        /// @param property  Name of the property
+        ///
+        /// @return Iterator to the pair, or end() when the property isn't stored
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD iterator find(const String& property);
+        TGUI_NODISCARD const_iterator find(const String& property) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns 1 when the property is stored and 0 when it isn't
+        ///
+        /// @param property  Name of the property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t count(const String& property) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a property
+        ///
+        /// @param it  Iterator to the pair to remove
+        ///
+        /// @return Iterator to the pair that followed the removed one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator erase(const_iterator it);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a property
+        ///
+        /// @param property  Name of the property
+        ///
+        /// @return Amount of removed properties, which is either 0 or 1
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t erase(const String& property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of stored properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t size() const
+        {
+            return m_ids.size();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether no properties are stored
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool empty() const
+        {
+            return m_ids.empty();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the ids of the stored properties, in the same order as the pairs are iterated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const std::vector<RendererPropertyId>& getIds() const
+        {
+            return m_ids;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an iterator to the first pair
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD iterator begin()
+        {
+            return iterator{m_pairs.begin()};
+        }
+
+        TGUI_NODISCARD const_iterator begin() const
+        {
+            return const_iterator{m_pairs.cbegin()};
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an iterator past the last pair
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD iterator end()
+        {
+            return iterator{m_pairs.end()};
+        }
+
+        TGUI_NODISCARD const_iterator end() const
+        {
+            return const_iterator{m_pairs.cend()};
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Returns the index at which the id is stored or should be inserted
+        TGUI_NODISCARD std::size_t lowerBound(RendererPropertyId id) const;
+
+        std::vector<RendererPropertyId> m_ids; // Sorted, the index of an id is also the index of its pair
+        std::vector<std::unique_ptr<value_type>> m_pairs;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Set of renderer properties, stored as a bitmask indexed by property id
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RendererPropertyMask
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a property to the set
+        ///
+        /// @param id  Id of the property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void set(RendererPropertyId id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether a property is part of the set
+        ///
+        /// @param id  Id of the property
+        ///
+        /// @return Is the property in the set?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool test(RendererPropertyId id) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the set doesn't contain any properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool empty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all properties from the set
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the ids of the properties in the set, sorted from low to high
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::vector<RendererPropertyId> getIds() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds all properties from another set to this set
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyMask& operator|=(const RendererPropertyMask& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::vector<std::uint64_t> m_bits; // Only grows as far as the highest id that was added
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RENDERER_PROPERTIES_HPP
@@ -28,7 +28,7 @@
 
 
 #include <TGUI/Config.hpp>
-#include <TGUI/ObjectConverter.hpp>
+#include <TGUI/RendererProperties.hpp>
 #include <TGUI/Loading/DataIO.hpp>
 #include <unordered_set>
 #include <map>
@@ -54,7 +54,7 @@ namespace tgui
         /// @internal
         TGUI_NODISCARD static std::shared_ptr<RendererData> createFromDataIONode(const DataIO::Node* rendererNode);
 
-        std::map<String, ObjectConverter> propertyValuePairs;
+        RendererPropertyMap propertyValuePairs;
         std::unordered_set<Widget*> observers;
         Theme* connectedTheme = nullptr;
         bool themePropertiesInherited = false;
@@ -207,6 +207,17 @@ namespace tgui
         void setProperty(const String& property, ObjectConverter&& value);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes a property of the renderer
+        ///
+        /// @param id     Id of the property, as returned by RendererPropertyRegistry::getId
+        /// @param value  The new value that you like to assign to the property
+        ///
+        /// @throw Exception for unknown properties or when value was of a wrong type
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setProperty(RendererPropertyId id, ObjectConverter&& value);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves the value of a certain property
         ///
@@ -225,7 +236,7 @@ namespace tgui
         /// @return Property-value pairs of the renderer
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD const std::map<String, ObjectConverter>& getPropertyValuePairs() const;
+        TGUI_NODISCARD const RendererPropertyMap& getPropertyValuePairs() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -274,11 +285,63 @@ namespace tgui
         TGUI_NODISCARD std::shared_ptr<RendererData> clone() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts a batch of renderer changes, during which widgets aren't informed yet about changed properties
+        ///
+        /// Every property that is set on a renderer while the batch is in progress is collected per widget. When the batch
+        /// ends, each widget is informed about all its changed properties at once, so that expensive recalculations (e.g.
+        /// positioning the text of a label) only happen once per widget instead of once per property.
+        ///
+        /// Calls can be nested, the widgets are informed when the last endBatchUpdate is called.
+        ///
+        /// @code
+        /// tgui::WidgetRenderer::beginBatchUpdate();
+        /// buttonRenderer->setTextColor(tgui::Color::White);
+        /// buttonRenderer->setBackgroundColor(tgui::Color::Black);
+        /// buttonRenderer->setBorders({2});
+        /// tgui::WidgetRenderer::endBatchUpdate();
+        /// @endcode
+        ///
+        /// Calling setRenderer on a widget or reloading a theme doesn't need a batch, the widget is already informed about
+        /// all properties of the new renderer at once.
+        ///
+        /// @warning Widgets don't reflect the changed properties until endBatchUpdate is called. Setting a property that
+        ///          a widget doesn't have will only throw an exception in endBatchUpdate.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void beginBatchUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends a batch of renderer changes that was started with beginBatchUpdate
+        ///
+        /// If this ends the outermost batch, all widgets whose renderer changed are informed about their changed properties.
+        ///
+        /// @throw Exception when a widget didn't have one of the properties that was changed. Other widgets are still informed.
+        ///        The properties that were rejected get back the value that they had before the batch.
+        ///
+        /// @see beginBatchUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void endBatchUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a batch of renderer changes that was started with beginBatchUpdate is still in progress
+        ///
+        /// @return Is beginBatchUpdate called more often than endBatchUpdate?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isBatchUpdateActive();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         std::shared_ptr<RendererData> m_data = RendererData::create();
 
+        // Forgets the changes that were collected for a widget during a batch update, called when the widget is destroyed
+        static void removePendingChanges(const Widget* widget);
+
+        friend class Widget; // Widget calls removePendingChanges
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
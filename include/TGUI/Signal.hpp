@@ -40,7 +40,6 @@
 #include <typeindex>
 #include <memory>
 #include <vector>
-#include <deque>
 
 #undef MessageBox  // windows.h defines MessageBox when NOMB isn't defined before including windows.h
 
@@ -59,22 +58,21 @@ namespace tgui
     public:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Default destructor
+        /// @brief Destructor
+        ///
+        /// Emits that were posted with postEmit and that haven't been dispatched yet are discarded.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual ~Signal() = default;
+        virtual ~Signal();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         ///
-        /// @param name             Name of the signal
-        /// @param extraParameters  Amount of extra parameters to reserve space for
+        /// @param name  Name of the signal, which has to remain valid as long as the signal exists (e.g. a string literal)
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal(String&& name, std::size_t extraParameters = 0) :
-            m_name{std::move(name)}
+        Signal(const char* name) :
+            m_name{name}
         {
-            if (1 + extraParameters > m_parameters.size())
-                m_parameters.resize(1 + extraParameters);
         }
 
 
@@ -128,17 +126,14 @@ namespace tgui
         template <typename Func, typename... BoundArgs, typename std::enable_if_t<std::is_convertible<Func, std::function<void(const BoundArgs&...)>>::value>* = nullptr>
         unsigned int connect(const Func& func, const BoundArgs&... args)
         {
-            const auto id = ++m_lastSignalId;
 #if defined(__cpp_if_constexpr) && (__cpp_if_constexpr >= 201606L)
             if constexpr(sizeof...(BoundArgs) == 0)
-                m_handlers[id] = func;
+                return addHandler(func);
             else
 #endif
             {
-                m_handlers[id] = [=]{ invokeFunc(func, args...); };
+                return addHandler([=]{ invokeFunc(func, args...); });
             }
-
-            return id;
         }
 
 
@@ -154,7 +149,7 @@ namespace tgui
         unsigned int connectEx(const Func& func, const BoundArgs&... args)
         {
             // The name is copied so that the lambda does not depend on the 'this' pointer
-            return connect([func, name=m_name, args...](){ invokeFunc(func, args..., getWidget(), name); });
+            return connect([func, name=getName(), args...](){ invokeFunc(func, args..., getWidget(), name); });
         }
 
 
@@ -184,6 +179,36 @@ namespace tgui
         bool emit(const Widget* widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the signal later on the gui thread. This function can be called from any thread.
+        ///
+        /// @param widget  The sender of the signal
+        ///
+        /// The signal is emitted the next time the gui updates its time (which is done while drawing by default), or when
+        /// dispatchPostedEmits() is called. The emit is cancelled when the signal is destroyed before this happens.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void postEmit(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits all signals that were queued with postEmit
+        ///
+        /// @return True when at least one signal handler was called
+        ///
+        /// This function is called by the gui in updateTime(), you only need to call it yourself if you don't use a gui.
+        /// It must be called from the thread that handles the widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool dispatchPostedEmits();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether there are emits that were queued with postEmit and that haven't been dispatched yet
+        ///
+        /// @return Does dispatchPostedEmits() have something to do?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool hasPostedEmits();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the name given to the signal
         ///
@@ -232,13 +257,39 @@ namespace tgui
         static std::shared_ptr<Widget> getWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stores the function that has to be called when the signal is emitted and returns its unique id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int addHandler(std::function<void()> func);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls all connected signal handlers, which can access the given parameters with dereferenceParam
+        ///
+        /// The parameters only have to remain valid during this call. The first parameter has to point to the sending widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool emitWithParameters(const void* const* parameters);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Queues a function that emits this signal, to be called on the gui thread by dispatchPostedEmits
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void postEmitFunc(std::function<bool()> emitFunc);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a parameter of the signal that is currently being emitted on this thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static const void* getParameter(std::size_t paramIndex);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Turns the void* parameters back into its original type right before calling the callback function
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         template <typename Type>
         TGUI_NODISCARD static const std::decay_t<Type>& dereferenceParam(std::size_t paramIndex)
         {
-            return *static_cast<const std::decay_t<Type>*>(m_parameters[paramIndex]);
+            return *static_cast<const std::decay_t<Type>*>(getParameter(paramIndex));
         }
 
 
@@ -267,12 +318,29 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // The connected functions. Functions are never moved or destroyed while the signal is being emitted, as the function
+        // that is currently executing could be the one that is being disconnected. Such changes are applied afterwards.
+        struct HandlerList
+        {
+            struct Handler
+            {
+                unsigned int id; // 0 when disconnected while emitting
+                std::function<void()> func;
+            };
+
+            std::vector<Handler> handlers;
+            std::vector<Handler> handlersConnectedWhileEmitting;
+            unsigned int emitDepth = 0;
+            bool handlersDisconnectedWhileEmitting = false;
+        };
+
+        struct EmitDepthGuard;
+
         bool m_enabled = true;
-        String m_name;
-        std::unordered_map<unsigned int, std::function<void()>> m_handlers;
+        const char* m_name;
+        std::shared_ptr<HandlerList> m_handlers; // Only created when a function is connected
 
         static unsigned int m_lastSignalId;
-        static std::deque<const void*> m_parameters;
     };
 
 
@@ -290,8 +358,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalTyped(String&& name) :
-            Signal{std::move(name), 1}
+        SignalTyped(const char* name) :
+            Signal{name}
         {
         }
 
@@ -351,11 +419,25 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, T param)
         {
-            if (m_handlers.empty())
+            if (!m_handlers)
                 return false;
 
-            m_parameters[1] = static_cast<const void*>(&param);
-            return Signal::emit(widget);
+            const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&param)};
+            return emitWithParameters(parameters);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the signal later on the gui thread. This function can be called from any thread.
+        ///
+        /// @param widget  Widget that is triggering the signal
+        /// @param param   Parameter that will be passed to callback function if it has an unbound parameter
+        ///
+        /// @see Signal::postEmit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void postEmit(const Widget* widget, T param)
+        {
+            postEmitFunc([this, widget, value=std::decay_t<T>{param}]{ return emit(widget, value); });
         }
     };
 
@@ -374,8 +456,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalTyped2(String&& name) :
-            Signal{std::move(name), 2}
+        SignalTyped2(const char* name) :
+            Signal{name}
         {
         }
 
@@ -436,12 +518,26 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, T1 param1, T2 param2)
         {
-            if (m_handlers.empty())
+            if (!m_handlers)
                 return false;
 
-            m_parameters[1] = static_cast<const void*>(&param1);
-            m_parameters[2] = static_cast<const void*>(&param2);
-            return Signal::emit(widget);
+            const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&param1), static_cast<const void*>(&param2)};
+            return emitWithParameters(parameters);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the signal later on the gui thread. This function can be called from any thread.
+        ///
+        /// @param widget  Widget that is triggering the signal
+        /// @param param1  First parameter that will be passed to callback function if it has two unbound parameters
+        /// @param param2  Second parameter that will be passed to callback function if it has two unbound parameters
+        ///
+        /// @see Signal::postEmit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void postEmit(const Widget* widget, T1 param1, T2 param2)
+        {
+            postEmitFunc([this, widget, value1=std::decay_t<T1>{param1}, value2=std::decay_t<T2>{param2}]{ return emit(widget, value1, value2); });
         }
     };
 
@@ -469,8 +565,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalChildWindow(String&& name) :
-            Signal{std::move(name), 1}
+        SignalChildWindow(const char* name) :
+            Signal{name}
         {
         }
 
@@ -530,6 +626,16 @@ namespace tgui
         bool emit(ChildWindow* param);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the signal later on the gui thread. This function can be called from any thread.
+        ///
+        /// @param param  Widget triggering the signal, will be passed to callback function if it has an unbound parameter
+        ///
+        /// @see Signal::postEmit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void postEmit(ChildWindow* param);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -558,8 +664,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalItem(String&& name) :
-            Signal{std::move(name), 3}
+        SignalItem(const char* name) :
+            Signal{name}
         {
         }
 
@@ -652,6 +758,19 @@ namespace tgui
         bool emit(const Widget* widget, int index, const String& item, const String& id);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the signal later on the gui thread. This function can be called from any thread.
+        ///
+        /// @param widget Widget that is triggering the signal
+        /// @param index  Index of the item, or -1 if there is no item
+        /// @param item   Text of the item, or an empty string if there is no item
+        /// @param id     Id of the item, or an empty string if there is no item
+        ///
+        /// @see Signal::postEmit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void postEmit(const Widget* widget, int index, const String& item, const String& id);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -671,8 +790,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalFileDialogPaths(String&& name) :
-            Signal{std::move(name), 3}
+        SignalFileDialogPaths(const char* name) :
+            Signal{name}
         {
         }
 
@@ -755,6 +874,17 @@ namespace tgui
         /// @return True when a callback function was executed, false when there weren't any connected callback functions
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const std::vector<Filesystem::Path>& paths);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the signal later on the gui thread. This function can be called from any thread.
+        ///
+        /// @param widget Widget that is triggering the signal
+        /// @param paths  List of paths to selected files
+        ///
+        /// @see Signal::postEmit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void postEmit(const Widget* widget, const std::vector<Filesystem::Path>& paths);
     };
 
 
@@ -773,8 +903,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalShowEffect(String&& name) :
-            Signal{std::move(name), 2}
+        SignalShowEffect(const char* name) :
+            Signal{name}
         {
         }
 
@@ -866,6 +996,18 @@ namespace tgui
         bool emit(const Widget* widget, ShowEffectType type, bool visible);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the signal later on the gui thread. This function can be called from any thread.
+        ///
+        /// @param widget  Widget that is triggering the signal
+        /// @param type    Type of the animation
+        /// @param visible True when the widget became visible, false if the widget is now hidden
+        ///
+        /// @see Signal::postEmit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void postEmit(const Widget* widget, ShowEffectType type, bool visible);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -883,8 +1025,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalAnimationType(String&& name) :
-            Signal{std::move(name), 1}
+        SignalAnimationType(const char* name) :
+            Signal{name}
         {
         }
 
@@ -945,6 +1087,17 @@ namespace tgui
         bool emit(const Widget* widget, AnimationType type);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the signal later on the gui thread. This function can be called from any thread.
+        ///
+        /// @param widget  Widget that is triggering the signal
+        /// @param type    Type of the animation
+        ///
+        /// @see Signal::postEmit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void postEmit(const Widget* widget, AnimationType type);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -963,8 +1116,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalItemHierarchy(String&& name) :
-            Signal{std::move(name), 2}
+        SignalItemHierarchy(const char* name) :
+            Signal{name}
         {
         }
 
@@ -1041,6 +1194,18 @@ namespace tgui
         bool emit(const Widget* widget, const String& item, const std::vector<String>& fullItem);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the signal later on the gui thread. This function can be called from any thread.
+        ///
+        /// @param widget   Widget that is triggering the signal
+        /// @param item     Text of the leaf item
+        /// @param fullItem Hierarchy from root to leaf
+        ///
+        /// @see Signal::postEmit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void postEmit(const Widget* widget, const String& item, const std::vector<String>& fullItem);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
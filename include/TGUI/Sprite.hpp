@@ -32,6 +32,7 @@
 #include <TGUI/Color.hpp>
 #include <TGUI/RenderStates.hpp>
 #include <vector>
+#include <array>
 #include <memory>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -86,6 +87,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Sprite(Sprite&&) noexcept;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~Sprite();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Overload of copy assignment operator
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -248,24 +254,31 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// Returns the internal vertices for drawing.
+        /// Returns the internal vertices for drawing. The amount of vertices is returned by getVertexCount.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD const std::vector<Vertex>& getVertices() const
+        TGUI_NODISCARD const Vertex* getVertices() const
         {
-            return m_vertices;
+            return m_vertices.data();
         }
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// Returns the internal vertices for drawing.
+        /// Returns the amount of internal vertices for drawing.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD const std::vector<unsigned int>& getIndices() const
+        TGUI_NODISCARD std::size_t getVertexCount() const
         {
-            return m_indices;
+            return m_vertexCount;
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns the internal indices for drawing. All sprites with the same scaling type share the same indices.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const std::vector<unsigned int>& getIndices() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -275,14 +288,20 @@ namespace tgui
         void updateVertices();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the memory used by the rasterized svg from the memory statistics of the texture data
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void releaseSvgRasterMemory();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         Vector2f    m_size;
         Texture     m_texture;
         std::shared_ptr<BackendTexture> m_svgTexture;
-        std::vector<Vertex> m_vertices;
-        std::vector<unsigned int> m_indices;
+        std::array<Vertex, 16> m_vertices;
+        std::size_t m_vertexCount = 0;
 
         FloatRect   m_visibleRect;
 
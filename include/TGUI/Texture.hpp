@@ -263,6 +263,26 @@ namespace tgui
         TGUI_NODISCARD bool isSmooth() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether mipmaps should be generated for the texture
+        ///
+        /// @param mipmapped  True if the texture should be mipmapped, false to only store the full resolution image
+        ///
+        /// Mipmaps improve the quality and performance of drawing the texture at a much smaller size than the image,
+        /// at the cost of about a third more video memory. Note that the setting applies to the image, so it affects
+        /// all textures that were loaded from the same image. Some backends (e.g. SDL_Renderer) don't support mipmaps.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMipmapped(bool mipmapped);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the texture is mipmapped
+        ///
+        /// @return True if mipmaps are generated for the texture, false if only the full resolution image is stored
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isMipmapped() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets the global color of the texture
         ///
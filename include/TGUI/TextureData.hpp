@@ -36,6 +36,7 @@
 
 #include <memory>
 #include <string>
+#include <list>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -49,6 +50,9 @@ namespace tgui
         // Either svgImage or backendTexture MUST have a value
         Optional<SvgImage> svgImage;
         std::shared_ptr<BackendTexture> backendTexture;
+
+        // Bytes used by the textures on which sprites rasterized the svg image (only used when svgImage has a value)
+        std::size_t svgRasterMemory = 0;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -60,6 +64,8 @@ namespace tgui
         String  filename;
         bool smooth = true;
         unsigned int users = 0;
+        std::size_t memoryUsage = 0; // Bytes of GPU and CPU memory used by the image, counted towards the memory budget
+        std::list<TextureDataHolder*>::iterator unusedImagesIt; // Position in the list of unused images, only valid when users is 0
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,7 +31,8 @@
 #include <TGUI/TextureData.hpp>
 #include <memory>
 #include <list>
-#include <map>
+#include <unordered_map>
+#include <unordered_set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -39,6 +40,21 @@ namespace tgui
 {
     class Texture;
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Memory statistics of the images that are stored in the texture manager
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API TextureMemoryStatistics
+    {
+        std::size_t cachedImages = 0;       //!< Amount of images stored in the texture manager
+        std::size_t unusedImages = 0;       //!< Amount of cached images that are no longer used by any texture
+        std::size_t gpuMemory = 0;          //!< Bytes used by the images on the GPU
+        std::size_t pixelMemory = 0;        //!< Bytes used in RAM for pixel copies and transparency masks
+        std::size_t pixelMemorySaved = 0;   //!< Bytes saved in RAM by storing transparency masks instead of pixel copies
+        std::size_t svgRasterMemory = 0;    //!< Bytes used by the textures on which svg images were rasterized
+        std::size_t unusedMemory = 0;       //!< Bytes used by images that are only kept in the cache
+        std::size_t memoryBudget = 0;       //!< Memory budget set with TextureManager::setMemoryBudget
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     class TGUI_API TextureManager
@@ -73,12 +89,72 @@ namespace tgui
         ///
         /// @param textureDataToRemove  The texture data that should be removed
         ///
-        /// When no other texture is using the same image then the image will be removed from memory.
+        /// When no other texture is using the same image then the image will be removed from memory, unless the memory budget
+        /// allows keeping it in the cache.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void removeTexture(const std::shared_ptr<TextureData>& textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how much memory the cached images may use before unused images are removed
+        ///
+        /// @param bytes  Maximum amount of GPU and CPU memory for the images in the texture manager
+        ///
+        /// Images that are no longer used by any texture are kept in the cache until the total memory used by all images
+        /// exceeds the budget, at which point the least recently used unused images are removed. Images that are still in use
+        /// are never removed, so the budget can be exceeded when all images are used.
+        ///
+        /// The budget is 0 by default, which means that images are removed as soon as the last texture using them is destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setMemoryBudget(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much memory the cached images may use before unused images are removed
+        ///
+        /// @return Maximum amount of GPU and CPU memory for the images in the texture manager
+        ///
+        /// @see setMemoryBudget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getMemoryBudget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much memory is used by the images in the texture manager
+        ///
+        /// @return Statistics about the cached images
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static TextureMemoryStatistics getMemoryStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of RAM used by the pixel data and transparency masks of all cached textures
+        ///
+        /// @return Amount of bytes of CPU memory used by the textures in the texture manager
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getPixelMemoryUsage();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much RAM was saved by storing transparency masks instead of the RGBA pixels of the cached textures
+        ///
+        /// @return Amount of bytes that would additionally be needed if all cached textures kept a copy of their pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getPixelMemorySaved();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Recalculates the memory used by an image after its texture was changed (e.g. when mipmaps were generated)
+        ///
+        /// @param textureData  The texture data of which the memory usage may have changed
+        ///
+        /// Nothing happens if the texture data wasn't loaded by the texture manager.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void updateMemoryUsage(const std::shared_ptr<TextureData>& textureData);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Returns how many textures are stored in the texture manager
@@ -93,7 +169,49 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        static std::map<String, std::list<TextureDataHolder>> m_imageMap;
+        // Images are identified by their interned filename and whether they are smoothed
+        struct ImageKey
+        {
+            const String* filename;
+            bool smooth;
+
+            TGUI_NODISCARD bool operator==(const ImageKey& other) const
+            {
+                return (filename == other.filename) && (smooth == other.smooth);
+            }
+        };
+
+        struct ImageKeyHash
+        {
+            TGUI_NODISCARD std::size_t operator()(const ImageKey& key) const
+            {
+                return std::hash<const String*>{}(key.filename) ^ static_cast<std::size_t>(key.smooth);
+            }
+        };
+
+        struct FilenameHash
+        {
+            TGUI_NODISCARD std::size_t operator()(const String& filename) const
+            {
+                return std::hash<std::u32string>{}(filename.toUtf32());
+            }
+        };
+
+        // Removes an image from the cache. If the image was unused then it must already be removed from the list of unused images.
+        static void removeImage(std::unordered_map<ImageKey, TextureDataHolder, ImageKeyHash>::iterator imageIt);
+
+        // Removes the least recently used unused images until the memory budget is no longer exceeded
+        static void enforceMemoryBudget();
+
+        // Removes the image in front of the list of unused images
+        static void removeLeastRecentlyUsedImage();
+
+        static std::unordered_set<String, FilenameHash> m_filenames;
+        static std::unordered_map<ImageKey, TextureDataHolder, ImageKeyHash> m_imageMap;
+        static std::unordered_map<const TextureData*, ImageKey> m_imageKeys;
+        static std::list<TextureDataHolder*> m_unusedImages; // Least recently used image is in front
+        static std::size_t m_memoryBudget;
+        static std::size_t m_memoryUsage;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
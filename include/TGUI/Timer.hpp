@@ -157,6 +157,9 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Returns the duration until the next moment a callback function has to be send.
+        ///
+        /// This function is cheap to call, the timer that expires first is always kept at the front of the active timers.
+        ///
         /// @return Time until next time expires or empty object if there are no timers
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static Optional<Duration> getNextScheduledTime();
@@ -181,14 +184,31 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        static std::vector<std::shared_ptr<Timer>> m_activeTimers;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the timer at the given index in m_activeTimers to the correct place after its deadline changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void updateHeapPosition(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places the timer at the given index in m_activeTimers and updates its m_heapIndex
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void placeInHeap(std::shared_ptr<Timer> timer, std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        static std::vector<std::shared_ptr<Timer>> m_activeTimers; // Binary min-heap ordered on m_deadline
+        static Duration m_currentTime; // Total time passed in all calls to updateTime
 
         bool m_repeats = false;
         bool m_enabled = false;
         Duration m_interval;
         std::function<void()> m_callback;
 
-        Duration m_remainingDuration;
+        Duration m_deadline; // Value of m_currentTime at which the timer expires
+        std::size_t m_heapIndex = 0; // Index of the timer in m_activeTimers (only valid while the timer is enabled)
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -37,7 +37,9 @@
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// @brief Defines a transform matrix
+    /// @brief Defines an affine transform matrix
+    ///
+    /// Only the top two rows of the 3x3 matrix are stored, the bottom row is always (0, 0, 1).
     // Based on sf::Transform from SFML
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API Transform
@@ -61,19 +63,37 @@ namespace tgui
         /// @param a10  Element (1, 0) of the 3x3 matrix
         /// @param a11  Element (1, 1) of the 3x3 matrix
         /// @param a12  Element (1, 2) of the 3x3 matrix
-        /// @param a20  Element (2, 0) of the 3x3 matrix
-        /// @param a21  Element (2, 1) of the 3x3 matrix
-        /// @param a22  Element (2, 2) of the 3x3 matrix
+        /// @param a20  Element (2, 0) of the 3x3 matrix, must be 0
+        /// @param a21  Element (2, 1) of the 3x3 matrix, must be 0
+        /// @param a22  Element (2, 2) of the 3x3 matrix, must be 1
+        ///
+        /// Only affine transforms are supported, the bottom row of the matrix is ignored.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Transform(float a00, float a01, float a02,
                   float a10, float a11, float a12,
                   float a20, float a21, float a22);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Construct an affine transform from the top two rows of a 3x3 matrix
+        ///
+        /// @param a00  Element (0, 0) of the 3x3 matrix
+        /// @param a01  Element (0, 1) of the 3x3 matrix
+        /// @param a02  Element (0, 2) of the 3x3 matrix
+        /// @param a10  Element (1, 0) of the 3x3 matrix
+        /// @param a11  Element (1, 1) of the 3x3 matrix
+        /// @param a12  Element (1, 2) of the 3x3 matrix
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Transform(float a00, float a01, float a02,
+                  float a10, float a11, float a12);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructs a transform from a 4x4 matrix
         ///
         /// @param matrix  4x4 transform matrix, similar to what getMatrix returns
+        ///
+        /// Only the elements that describe a 2D affine transform are used.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Transform(const std::array<float, 16>& matrix);
 
@@ -88,9 +108,22 @@ namespace tgui
         /// glLoadMatrixf(transform.getMatrix().data());
         /// @endcode
         ///
+        /// The 4x4 matrix is constructed when calling this function, it is meant to pass the transform to a backend.
+        ///
         /// @return 4x4 transform matrix
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD const std::array<float, 16>& getMatrix() const;
+        TGUI_NODISCARD std::array<float, 16> getMatrix() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Return the elements of the affine transform
+        ///
+        /// @return Array containing {a00, a10, a01, a11, a02, a12}, i.e. the columns of the top two rows of the 3x3 matrix
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const std::array<float, 6>& getAffineMatrix() const
+        {
+            return m_matrix;
+        }
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -113,6 +146,18 @@ namespace tgui
         TGUI_NODISCARD Vector2f transformPoint(const Vector2f& point) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Transform multiple 2D points at once
+        ///
+        /// @param points  Array of points to transform
+        /// @param result  Array in which the transformed points are stored, may be the same as the points parameter
+        /// @param count   Amount of points in both arrays
+        ///
+        /// This gives the same results as calling transformPoint on each point, but processes multiple points at a time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void transformPoints(const Vector2f* points, Vector2f* result, std::size_t count) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Transform a rectangle
         ///
@@ -200,7 +245,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        std::array<float, 16> m_matrix; //!< 4x4 matrix defining the transformation
+        std::array<float, 6> m_matrix; //!< Columns of the 2x3 matrix defining the transformation
     };
 }
 
@@ -54,6 +54,8 @@
 #endif
 
 #include <unordered_set>
+#include <algorithm>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -65,7 +67,7 @@ namespace tgui
     enum class ShowEffectType;
     namespace priv
     {
-        class Animation;
+        class AnimationEngine;
     }
 
 
@@ -482,6 +484,7 @@ namespace tgui
         ///
         /// @param type     Type of the animation
         /// @param duration Duration of the animation
+        /// @param easing   Curve that determines how fast the animation progresses over time
         ///
         /// @see hideWithEffect
         ///
@@ -490,7 +493,7 @@ namespace tgui
         /// widget->showWithEffect(tgui::ShowEffectType::SlideFromLeft, std::chrono::milliseconds(500));
         /// @endcode
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void showWithEffect(ShowEffectType type, Duration duration);
+        void showWithEffect(ShowEffectType type, Duration duration, EasingType easing = EasingType::Linear);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -503,6 +506,7 @@ namespace tgui
         ///
         /// @param type     Type of the animation
         /// @param duration Duration of the animation
+        /// @param easing   Curve that determines how fast the animation progresses over time
         ///
         /// @see showWithEffect
         ///
@@ -511,7 +515,7 @@ namespace tgui
         /// widget->hideWithEffect(tgui::ShowEffectType::SlideToRight, std::chrono::milliseconds(500));
         /// @endcode
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void hideWithEffect(ShowEffectType type, Duration duration);
+        void hideWithEffect(ShowEffectType type, Duration duration, EasingType easing = EasingType::Linear);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -519,8 +523,9 @@ namespace tgui
         ///
         /// @param position  Final position of the widget
         /// @param duration  How long before the widget reaches its final position
+        /// @param easing    Curve that determines how fast the widget moves at each moment during the animation
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void moveWithAnimation(Layout2d position, Duration duration);
+        void moveWithAnimation(Layout2d position, Duration duration, EasingType easing = EasingType::Linear);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -528,8 +533,9 @@ namespace tgui
         ///
         /// @param size      Final size of the widget
         /// @param duration  How long before the widget reaches its final size
+        /// @param easing    Curve that determines how fast the widget grows or shrinks at each moment during the animation
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void resizeWithAnimation(Layout2d size, Duration duration);
+        void resizeWithAnimation(Layout2d size, Duration duration, EasingType easing = EasingType::Linear);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -668,7 +674,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setUserData(Any userData)
         {
-            m_userData = std::move(userData);
+            getRarelyUsedData().userData = std::move(userData);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -679,7 +685,10 @@ namespace tgui
         template <typename DataType>
         TGUI_NODISCARD DataType getUserData() const
         {
-            return AnyCast<DataType>(m_userData);
+            if (m_rarelyUsedData)
+                return AnyCast<DataType>(m_rarelyUsedData->userData);
+            else
+                return AnyCast<DataType>(Any{});
         }
 
 
@@ -689,7 +698,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD bool hasUserData() const
         {
-            return m_userData.has_value();
+            return m_rarelyUsedData && m_rarelyUsedData->userData.has_value();
         }
 
 
@@ -887,6 +896,18 @@ namespace tgui
         virtual bool updateTime(Duration elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns how long it takes before updateTime has to be called again for the widget to change
+        ///
+        /// @return Time until the next change, or an empty object if nothing changes until the widget receives an event
+        ///
+        /// The gui uses this to decide how long its main loop can wait for events. Widgets that change over time in their
+        /// updateTime function must override this function, otherwise they only get updated when an event occurs.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual Optional<Duration> getTimeUntilNextUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
@@ -1017,6 +1038,27 @@ namespace tgui
         void unbindSizeLayout(Layout* layout);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether the position or size layout of the widget changed while the gui was deferring layout updates
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isLayoutUpdatePending() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Updates the position and size of the widget if their layouts changed while layout updates were deferred
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyPendingLayoutUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Adds the widgets that have a position or size layout which depends on the position or size of this widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void getLayoutDependents(std::vector<Widget*>& dependents) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -1066,6 +1108,14 @@ namespace tgui
         void rendererChangedCallback(const String& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Callback function which is called when multiple renderer properties changed at once and which calls the
+        ///        virtual rendererPropertiesChanged function
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rendererChangedCallback(const RendererPropertyMask& properties);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Called when the text size is changed (either by setTextSize or via the renderer) or when font scale changes
@@ -1080,6 +1130,50 @@ namespace tgui
         using LoadingRenderersMap = std::map<String, std::shared_ptr<RendererData>>;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Members of the widget that only few widgets use
+        ///
+        /// These members are stored outside of the widget so that they only take up memory in widgets that actually use them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct RarelyUsedData
+        {
+            Widget::Ptr toolTip;
+            Any userData;
+            Optional<Vector2f> rotationOrigin;
+            Optional<Vector2f> scaleOrigin;
+
+            // Layouts that need to recalculate their value when the position or size of this widget changes
+            std::unordered_set<Layout*> boundPositionLayouts;
+            std::unordered_set<Layout*> boundSizeLayouts;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the rarely used members of the widget, they are allocated on the first call
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RarelyUsedData& getRarelyUsedData();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copies the rarely used members that a copied widget takes over from the original widget
+        ///
+        /// The tool tip is cloned and the rotation and scale origins are copied. Bound layouts and user data aren't copied.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void copyRarelyUsedData(const Widget& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates the layouts that depend on the position of this widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateBoundPositionLayouts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates the layouts that depend on the size of this widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateBoundSizeLayouts();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
@@ -1088,6 +1182,49 @@ namespace tgui
         virtual void rendererChanged(const String& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function called when multiple properties of the renderer are changed at once
+        ///
+        /// @param properties  Properties that were changed
+        ///
+        /// The default implementation calls rendererChanged for each property, ordered by property id. Functions that were
+        /// passed to updateAfterRendererChange during those calls are executed afterwards, each of them only once.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void rendererPropertiesChanged(const RendererPropertyMask& properties);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls a member function that recalculates something that depends on the renderer properties
+        ///
+        /// @param function  Member function of the widget without parameters
+        ///
+        /// When called from rendererChanged while rendererPropertiesChanged is processing multiple properties, the function is
+        /// postponed until all properties have been processed, so that it is only executed once. It is executed immediately
+        /// when only a single property changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename WidgetType>
+        void updateAfterRendererChange(void (WidgetType::*function)())
+        {
+            if (!m_pendingRendererUpdates)
+            {
+                (static_cast<WidgetType*>(this)->*function)();
+                return;
+            }
+
+            const auto widgetFunction = static_cast<void (Widget::*)()>(function);
+            if (std::find(m_pendingRendererUpdates->begin(), m_pendingRendererUpdates->end(), widgetFunction) == m_pendingRendererUpdates->end())
+                m_pendingRendererUpdates->push_back(widgetFunction);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls setSize with the current size, to recalculate the parts of the widget that depend on the size
+        ///
+        /// This function exists so that it can be passed to updateAfterRendererChange.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reapplySize();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1112,6 +1249,13 @@ namespace tgui
         virtual void mouseLeftWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the engine that plays the animations of this widget, which is the engine of the parent if there is a parent.
+        // When the engine doesn't exist yet, it is only created if createIfMissing is true and nullptr is returned otherwise.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        priv::AnimationEngine* getAnimationEngine(bool createIfMissing);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -1150,8 +1294,6 @@ namespace tgui
         unsigned int m_textSize = 0; // This may be overwritten by the renderer, m_textSizeCached contains the actual text size
 
         Vector2f m_origin;
-        Optional<Vector2f> m_rotationOrigin;
-        Optional<Vector2f> m_scaleOrigin;
         Vector2f m_scaleFactors = {1, 1};
         float m_rotationDeg = 0;
 
@@ -1160,10 +1302,6 @@ namespace tgui
         Vector2f m_prevPosition;
         Vector2f m_prevSize;
 
-        // Layouts that need to recalculate their value when the position or size of this widget changes
-        std::unordered_set<Layout*> m_boundPositionLayouts;
-        std::unordered_set<Layout*> m_boundSizeLayouts;
-
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Stores the flag indicating whether this widget is enabled
@@ -1183,6 +1321,9 @@ namespace tgui
         Container* m_parent = nullptr;
         BackendGui* m_parentGui = nullptr;
 
+        // Last known index of this widget in the widget list of its parent, the parent checks whether it is still correct
+        std::size_t m_indexInParent = 0;
+
         // Is the mouse on top of the widget? Did the mouse go down on the widget?
         bool m_mouseHover = false;
         bool m_mouseDown = false;
@@ -1202,14 +1343,11 @@ namespace tgui
         // This is set to true for widgets that store other widgets inside them
         bool m_containerWidget = false;
 
-        // The tool tip connected to the widget
-        Widget::Ptr m_toolTip = nullptr;
-
         // Renderer of the widget
         aurora::CopiedPtr<WidgetRenderer> m_renderer = nullptr;
 
-        // Show animations
-        std::vector<std::unique_ptr<priv::Animation>> m_showAnimations;
+        // Animations of the child widgets, as well as of the widget itself when it doesn't have a parent
+        std::unique_ptr<priv::AnimationEngine> m_animations;
 
         // Renderer properties that can be passed from containers to their children
         Font m_inheritedFont;
@@ -1221,9 +1359,14 @@ namespace tgui
         bool m_transparentTextureCached = false;
         unsigned int m_textSizeCached = 0;
 
-        Any m_userData;
         Cursor::Type m_mouseCursor = Cursor::Type::Arrow;
 
+        // Updates that were postponed with updateAfterRendererChange, only set while rendererPropertiesChanged is running
+        std::vector<void (Widget::*)()>* m_pendingRendererUpdates = nullptr;
+
+        // Data that most widgets never use, it is only allocated once one of its members is needed (see getRarelyUsedData)
+        std::unique_ptr<RarelyUsedData> m_rarelyUsedData;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container; // Container accesses save and load functions
@@ -0,0 +1,410 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus's Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_FLEX_LAYOUT_HPP
+#define TGUI_FLEX_LAYOUT_HPP
+
+#include <TGUI/Widgets/BoxLayout.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Container that arranges its children in rows or columns based on the flexible box model
+    ///
+    /// Every child has a preferred size, which is the size of the widget when it was added to the layout (or the size it was
+    /// given afterwards). Along the main axis, children start at their basis (the preferred size unless a basis was set) and
+    /// then grow or shrink to fill the available space. When wrapping is enabled, children that don't fit are moved to a new
+    /// line. The space between children and lines is set with the SpaceBetweenWidgets property of the renderer.
+    ///
+    /// All children are arranged in a single pass over the widgets. Preferred sizes are cached, only children that are resized
+    /// from outside the layout are measured again.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API FlexLayout : public BoxLayout
+    {
+    public:
+
+        using Ptr = std::shared_ptr<FlexLayout>; //!< Shared widget pointer
+        using ConstPtr = std::shared_ptr<const FlexLayout>; //!< Shared constant widget pointer
+
+        static constexpr const char StaticWidgetType[] = "FlexLayout"; //!< Type name of the widget
+
+
+        /// @brief Axis along which the children are placed
+        enum class Direction
+        {
+            Row,   //!< Children are placed from left to right
+            Column //!< Children are placed from top to bottom
+        };
+
+        /// @brief How the free space on the main axis is distributed when the children don't grow to fill the line
+        enum class JustifyContent
+        {
+            Start,        //!< Children are packed at the start of the line
+            End,          //!< Children are packed at the end of the line
+            Center,       //!< Children are packed in the center of the line
+            SpaceBetween, //!< Free space is divided between the children, the first and last child touch the sides
+            SpaceAround,  //!< Every child gets the same space on both sides
+            SpaceEvenly   //!< The space between the children and the sides is the same everywhere
+        };
+
+        /// @brief How the children are positioned on the cross axis within their line
+        enum class AlignItems
+        {
+            Start,  //!< Children are placed at the start of the line
+            End,    //!< Children are placed at the end of the line
+            Center, //!< Children are centered within the line
+            Stretch //!< Children are resized to fill the line
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Constructor
+        /// @param typeName     Type of the widget
+        /// @param initRenderer Should the renderer be initialized? Should be true unless a derived class initializes it.
+        /// @see create
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FlexLayout(const char* typeName = StaticWidgetType, bool initRenderer = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FlexLayout(const FlexLayout& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FlexLayout(FlexLayout&& other) noexcept;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~FlexLayout() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of copy assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FlexLayout& operator= (const FlexLayout& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FlexLayout& operator= (FlexLayout&& other) noexcept;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new flex layout widget
+        ///
+        /// @param size  Size of the layout
+        ///
+        /// @return The new flex layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static FlexLayout::Ptr create(const Layout2d& size = {"100%", "100%"});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes a copy of another layout
+        ///
+        /// @param layout  The other layout
+        ///
+        /// @return The new layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static FlexLayout::Ptr copy(const FlexLayout::ConstPtr& layout);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inserts a widget to the layout
+        ///
+        /// @param index       Index of the widget in the container
+        /// @param widget      Pointer to the widget you would like to add
+        /// @param widgetName  An identifier to access to the widget later
+        ///
+        /// The current size of the widget becomes its preferred size. The widget doesn't grow and may shrink.
+        ///
+        /// If the index is too high, the widget will simply be added at the end of the list.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(std::size_t index, const Widget::Ptr& widget, const String& widgetName = "") override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a single widget that was added to the container
+        ///
+        /// @param index  Index in the layout of the widget to remove
+        ///
+        /// @return False if the index was too high
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool remove(std::size_t index) override;
+        using BoxLayout::remove;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets that were added to the container
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeAllWidgets() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the axis along which the children are placed
+        ///
+        /// @param direction  Should the children be placed in a row or in a column?
+        ///
+        /// By default, children are placed in a row.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDirection(Direction direction);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the axis along which the children are placed
+        ///
+        /// @return Are the children placed in a row or in a column?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Direction getDirection() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether children that don't fit on the line are moved to a new line
+        ///
+        /// @param wrap  Should the children be spread over multiple lines?
+        ///
+        /// When wrapping is disabled (default), all children are placed on a single line that fills the layout and they shrink
+        /// when they don't fit. When wrapping is enabled, each line is as high (or wide for columns) as its largest child.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWrap(bool wrap);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether children that don't fit on the line are moved to a new line
+        ///
+        /// @return Are the children spread over multiple lines?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool getWrap() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how the free space on the main axis is distributed
+        ///
+        /// @param justify  How the children are spread over the line when they don't fill it
+        ///
+        /// By default, children are packed at the start of the line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setJustifyContent(JustifyContent justify);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how the free space on the main axis is distributed
+        ///
+        /// @return How the children are spread over the line when they don't fill it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD JustifyContent getJustifyContent() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how the children are positioned on the cross axis
+        ///
+        /// @param align  Alignment of the children within their line
+        ///
+        /// By default, children are stretched to fill their line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAlignItems(AlignItems align);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how the children are positioned on the cross axis
+        ///
+        /// @return Alignment of the children within their line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD AlignItems getAlignItems() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how much of the free space on the line a child takes
+        ///
+        /// @param widget  Child widget of the layout
+        /// @param grow    Share of the free space, relative to the grow factors of the other children on the line
+        ///
+        /// @return False if the widget wasn't found in the layout
+        ///
+        /// The default grow factor is 0, which means that the child keeps its basis size when there is space left.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setItemGrow(const Widget::Ptr& widget, float grow);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much of the free space on the line a child takes
+        ///
+        /// @param widget  Child widget of the layout
+        ///
+        /// @return Grow factor of the child, or 0 if the widget wasn't found in the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getItemGrow(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how much a child shrinks when the children don't fit on the line
+        ///
+        /// @param widget  Child widget of the layout
+        /// @param shrink  Shrink factor, which is weighted by the basis of the child
+        ///
+        /// @return False if the widget wasn't found in the layout
+        ///
+        /// The default shrink factor is 1. Children with a shrink factor of 0 never become smaller than their basis.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setItemShrink(const Widget::Ptr& widget, float shrink);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much a child shrinks when the children don't fit on the line
+        ///
+        /// @param widget  Child widget of the layout
+        ///
+        /// @return Shrink factor of the child, or 0 if the widget wasn't found in the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getItemShrink(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of a child on the main axis before it grows or shrinks
+        ///
+        /// @param widget  Child widget of the layout
+        /// @param basis   Initial width (or height for columns) of the child, or a negative value to use its preferred size
+        ///
+        /// @return False if the widget wasn't found in the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setItemBasis(const Widget::Ptr& widget, float basis);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of a child on the main axis before it grows or shrinks
+        ///
+        /// @param widget  Child widget of the layout
+        ///
+        /// @return Basis of the child, or a negative value if the preferred size of the child is used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getItemBasis(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the cached preferred size of a child
+        ///
+        /// @param widget  Child widget of the layout
+        ///
+        /// @return Size of the child before it was arranged by the layout, or (0,0) if the widget wasn't found in the layout
+        ///
+        /// The preferred size is measured when the widget is added and whenever the widget is resized by something else than
+        /// the layout itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Vector2f getItemPreferredSize(const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // @brief Repositions and resize the widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgets() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the widget as a tree node in order to save it to a file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::unique_ptr<DataIO::Node> save(SavingRenderersMap& renderers) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the widget from a tree of nodes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes a copy of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Widget::Ptr clone() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Connects to the onSizeChange signal of the child to update its preferred size when it is resized by someone else
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void connectItem(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Disconnects the onSizeChange handlers from all children
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void disconnectItems();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when a child was resized
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void itemSizeChanged(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Flex properties of a child, stored at the same index as the widget in m_widgets
+        struct Item
+        {
+            float grow = 0;
+            float shrink = 1;
+            float basis = -1;
+            Vector2f preferredSize;
+            float mainSize = 0; // Only used while arranging the widgets
+            unsigned int sizeChangeConnection = 0;
+        };
+
+        std::vector<Item> m_items;
+
+        Direction      m_direction = Direction::Row;
+        bool           m_wrap = false;
+        JustifyContent m_justifyContent = JustifyContent::Start;
+        AlignItems     m_alignItems = AlignItems::Stretch;
+
+        // Set while updateWidgets resizes the children, to not mistake those changes for new preferred sizes
+        bool m_arrangingWidgets = false;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FLEX_LAYOUT_HPP
@@ -365,7 +365,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the position and size of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateWidgets();
+        void updateWidgets() override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
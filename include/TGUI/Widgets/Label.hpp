@@ -411,6 +411,19 @@ namespace tgui
         void updateTextPiecePositions(float maxWidth);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Shows or hides the scrollbar based on the auto-size and scrollbar policy. The scrollbar is only created when the
+        // label could actually display it, most labels never need one.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScrollbarVisibility();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the scrollbar if it didn't exist yet and returns it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ScrollbarChildWidget& getScrollbarWidget();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -441,10 +454,10 @@ namespace tgui
         // Will be set to true after the first click, but gets reset to false when the second click does not occur soon after
         bool m_possibleDoubleClick = false;
 
-        CopiedSharedPtr<ScrollbarChildWidget> m_scrollbar;
+        CopiedSharedPtr<ScrollbarChildWidget> m_scrollbar = nullptr; // Only created when needed, check before using it
         Scrollbar::Policy  m_scrollbarPolicy = Scrollbar::Policy::Automatic;
 
-        Sprite    m_spriteBackground;
+        aurora::CopiedPtr<Sprite> m_spriteBackground; // Only created when the renderer has a background texture
 
         // Cached renderer properties
         Borders   m_bordersCached;
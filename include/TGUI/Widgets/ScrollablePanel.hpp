@@ -32,6 +32,7 @@
 #include <TGUI/Renderers/ScrollablePanelRenderer.hpp>
 
 #include <chrono>
+#include <functional>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -47,6 +48,10 @@ namespace tgui
         using Ptr = std::shared_ptr<ScrollablePanel>; //!< Shared widget pointer
         using ConstPtr = std::shared_ptr<const ScrollablePanel>; //!< Shared constant widget pointer
 
+        using VirtualItemHeightFunc = std::function<float(std::size_t index)>; //!< Returns the height of a virtual item
+        using VirtualItemCreateFunc = std::function<Widget::Ptr()>; //!< Creates a widget to display virtual items
+        using VirtualItemBindFunc = std::function<void(const Widget::Ptr& widget, std::size_t index)>; //!< Shows an item in a widget
+
         static constexpr const char StaticWidgetType[] = "ScrollablePanel"; //!< Type name of the widget
 
 
@@ -299,6 +304,120 @@ namespace tgui
         TGUI_NODISCARD unsigned int getHorizontalScrollbarValue() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Turns the panel into a virtualized list that only creates widgets for the items that are visible
+        ///
+        /// @param count       Amount of items in the list
+        /// @param heightFunc  Function that returns the height of the item at the given index
+        /// @param createFunc  Function that creates a new widget that can be used to display an item
+        /// @param bindFunc    Function that changes the contents of a widget to show the item at the given index
+        ///
+        /// The items are placed below each other and get the width of the panel. Only the items that are visible, plus a few
+        /// items above and below them (see setVirtualOverscan), have a widget. When scrolling, widgets of items that are no
+        /// longer visible are removed from the panel and kept in a pool, to be reused for items that become visible.
+        /// The create function is only called when the pool is empty, the bind function is called every time a widget is
+        /// reused for a different item.
+        ///
+        /// The heights of all items are requested once and stored, call refreshVirtualItems when they change.
+        ///
+        /// Any widgets that were added to the panel are removed. While the panel is virtualized, the content size is
+        /// determined by the items and widgets added with the add function won't influence the scrollbars.
+        ///
+        /// @code
+        /// panel->setVirtualItems(10000,
+        ///     [](std::size_t){ return 30.f; },
+        ///     []{ return tgui::Label::create(); },
+        ///     [](const tgui::Widget::Ptr& widget, std::size_t index){ widget->cast<tgui::Label>()->setText(tgui::String(index)); });
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualItems(std::size_t count, const VirtualItemHeightFunc& heightFunc, const VirtualItemCreateFunc& createFunc,
+                             const VirtualItemBindFunc& bindFunc);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops using the panel as a virtualized list
+        ///
+        /// All widgets that were created for the virtual items are removed from the panel.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeVirtualItems();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the panel is used as a virtualized list
+        ///
+        /// @return Was setVirtualItems called?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isVirtualized() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of items in the virtualized list
+        ///
+        /// @param count  New amount of items
+        ///
+        /// Only the heights of the new items are requested. Items that were visible before keep their widget without being
+        /// bound again, call refreshVirtualItems if their contents changed.
+        ///
+        /// This function has no effect when the panel isn't virtualized.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualItemCount(std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items in the virtualized list
+        ///
+        /// @return Amount of items, or 0 when the panel isn't virtualized
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getVirtualItemCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Requests the heights of all items again and binds all visible widgets again to their item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void refreshVirtualItems();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of items above and below the visible area that also have a widget
+        ///
+        /// @param itemCount  Amount of extra items on each side of the visible area
+        ///
+        /// Creating widgets for items that aren't visible yet avoids having to bind them while scrolling slowly.
+        /// The default overscan is 2 items.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualOverscan(unsigned int itemCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items above and below the visible area that also have a widget
+        ///
+        /// @return Amount of extra items on each side of the visible area
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getVirtualOverscan() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the widget that currently displays an item of the virtualized list
+        ///
+        /// @param index  Index of the item
+        ///
+        /// @return Widget bound to the item, or nullptr if the item is too far from the visible area to have a widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Widget::Ptr getVirtualItemWidget(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the vertical position of an item in the virtualized list
+        ///
+        /// @param index  Index of the item
+        ///
+        /// @return Distance between the top of the content and the top of the item
+        ///
+        /// This value can be passed to setVerticalScrollbarValue to scroll an item into view.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getVirtualItemPosition(std::size_t index) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the leaf child widget that is located at the given position
         ///
@@ -415,6 +534,36 @@ namespace tgui
         void disconnectAllChildWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Connect to the vertical scrollbar to update the virtual items while scrolling
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void connectVerticalScrollbar();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Takes over the virtual item callbacks from another panel and creates new widgets for the visible items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void copyVirtualItems(const ScrollablePanel& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Requests the heights of the virtual items starting at the given index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVirtualItemOffsets(std::size_t firstIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Width given to the widgets of the virtual items, which depends on whether the vertical scrollbar is shown
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getVirtualItemWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that exactly the items near the visible area have a widget, recycling widgets of items that scrolled away
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVirtualItems(bool rebindAll);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -435,6 +584,23 @@ namespace tgui
         std::unordered_map<Widget::Ptr, unsigned int> m_connectedPositionCallbacks;
         std::unordered_map<Widget::Ptr, unsigned int> m_connectedSizeCallbacks;
 
+        // State of the panel when it is used as a virtualized list
+        struct VirtualItems
+        {
+            std::size_t count = 0;
+            VirtualItemHeightFunc heightFunc;
+            VirtualItemCreateFunc createFunc;
+            VirtualItemBindFunc bindFunc;
+            std::vector<float> offsets; // Top of each item, followed by the total height
+            std::vector<Widget::Ptr> activeWidgets; // Widgets of the items starting at firstActiveIndex
+            std::vector<Widget::Ptr> newActiveWidgets; // Reused while updating to avoid allocations
+            std::vector<Widget::Ptr> pool; // Widgets that were removed from the panel and can be bound to another item
+            std::size_t firstActiveIndex = 0;
+        };
+
+        std::unique_ptr<VirtualItems> m_virtualItems;
+        unsigned int m_virtualOverscan = 2;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
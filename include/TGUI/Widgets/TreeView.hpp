@@ -441,6 +441,12 @@ namespace tgui
         unsigned int updateVisibleNodes(std::vector<std::shared_ptr<Node>>& nodes, Node* selectedNode, float textPadding, unsigned int pos);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the text colors of all items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemColors();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the text colors of the selected and hovered items
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,8 @@
 #include <TGUI/Animation.hpp>
 #include <TGUI/Widget.hpp>
 
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -34,123 +36,416 @@ namespace tgui
     {
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        AnimationType Animation::getType() const
+        // Widgets can start and stop animations from inside the callbacks and signal handlers that are triggered by the engine.
+        // As long as the engine is calling such code, stopped animations are only marked and new ones are only appended.
+        struct AnimationEngine::UpdateDepthGuard
+        {
+            explicit UpdateDepthGuard(AnimationEngine& animationEngine) :
+                engine(animationEngine)
+            {
+                ++engine.m_updateDepth;
+            }
+
+            ~UpdateDepthGuard()
+            {
+                if ((--engine.m_updateDepth == 0) && engine.m_stoppedTracksPending)
+                    engine.removeStoppedTracks();
+            }
+
+            UpdateDepthGuard(const UpdateDepthGuard&) = delete;
+            UpdateDepthGuard& operator=(const UpdateDepthGuard&) = delete;
+
+            AnimationEngine& engine;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void AnimationEngine::addMoveAnimation(Widget* widget, Vector2f start, Layout2d end, Duration duration, EasingType easing, std::function<void()> finishedCallback)
         {
-            return m_type;
+            const Vector2f endValue = end.getValue();
+            addTrack(AnimationType::Move, widget, start, endValue, std::move(end), duration, easing, std::move(finishedCallback));
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void Animation::finish()
+        void AnimationEngine::addResizeAnimation(Widget* widget, Vector2f start, Layout2d end, Duration duration, EasingType easing, std::function<void()> finishedCallback)
         {
-            if (m_finishedCallback != nullptr)
-                m_finishedCallback();
+            const Vector2f endValue = end.getValue();
+            addTrack(AnimationType::Resize, widget, start, endValue, std::move(end), duration, easing, std::move(finishedCallback));
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        Animation::Animation(AnimationType type, Widget::Ptr widget, Duration duration, std::function<void()> finishedCallback) :
-            m_type            {type},
-            m_widget          {std::move(widget)},
-            m_totalDuration   {duration},
-            m_finishedCallback{std::move(finishedCallback)}
+        void AnimationEngine::addFadeAnimation(Widget* widget, float start, float end, Duration duration, EasingType easing, std::function<void()> finishedCallback)
         {
+            start = std::max(0.f, std::min(1.f, start));
+            end = std::max(0.f, std::min(1.f, end));
+            addTrack(AnimationType::Opacity, widget, {start, 0}, {end, 0}, {}, duration, easing, std::move(finishedCallback));
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        MoveAnimation::MoveAnimation(Widget::Ptr widget, Vector2f start, Layout2d end, Duration duration, std::function<void()> finishedCallback) :
-            Animation {AnimationType::Move, std::move(widget), duration, std::move(finishedCallback)},
-            m_startPos{start},
-            m_endPos  {std::move(end)}
+        bool AnimationEngine::update(Duration elapsedTime, const Widget* owner, const Widget* widget)
         {
+            if (empty() || (m_updateDepth > 0))
+                return false;
+
+            if (widget && !hasAnimations(widget))
+                return false;
+
+            const UpdateDepthGuard updateDepthGuard{*this};
+
+            // Only the animations that exist now are played, animations started during the update are played the next time
+            bool trackAdvanced = false;
+            std::size_t trackCounts[3];
+            for (unsigned int type = 0; type < 3; ++type)
+            {
+                Tracks& tracks = m_tracks[type];
+                const std::size_t count = tracks.widgets.size();
+                trackCounts[type] = count;
+
+                // The end value of a move or resize animation can be a layout that depends on other widgets
+                if (type != static_cast<unsigned int>(AnimationType::Opacity))
+                {
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        const Vector2f endValue = tracks.endLayouts[i].getValue();
+                        tracks.endX[i] = endValue.x;
+                        tracks.endY[i] = endValue.y;
+                    }
+                }
+
+                // Advance the animations of all visible widgets. Invisible widgets aren't updated by their parent either.
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    if (widget)
+                    {
+                        if (tracks.widgets[i] != widget)
+                            continue;
+                    }
+                    else if ((tracks.widgets[i] != owner) && (!tracks.widgets[i] || !tracks.widgets[i]->isVisible()))
+                        continue;
+
+                    trackAdvanced = true;
+                    tracks.elapsedTimes[i] += elapsedTime;
+                    const float progress = (tracks.elapsedTimes[i] < tracks.durations[i]) ? (tracks.elapsedTimes[i] / tracks.durations[i]) : 1.f;
+                    const float easedProgress = applyEasing(tracks.easings[i], progress);
+                    tracks.valueX[i] = tracks.startX[i] + easedProgress * (tracks.endX[i] - tracks.startX[i]);
+                    tracks.valueY[i] = tracks.startY[i] + easedProgress * (tracks.endY[i] - tracks.startY[i]);
+                }
+            }
+
+            // Write the new values to the widgets that are still animating
+            for (unsigned int type = 0; type < 3; ++type)
+            {
+                Tracks& tracks = m_tracks[type];
+                for (std::size_t i = 0; i < trackCounts[type]; ++i)
+                {
+                    // The widget is checked each time, as the changes to earlier widgets could have stopped the animation
+                    Widget* const trackWidget = tracks.widgets[i];
+                    if (!trackWidget || (widget && (trackWidget != widget)) || (tracks.elapsedTimes[i] >= tracks.durations[i])
+                     || (!widget && (trackWidget != owner) && !trackWidget->isVisible()))
+                        continue;
+
+                    if (type == static_cast<unsigned int>(AnimationType::Move))
+                        trackWidget->setPosition({tracks.valueX[i], tracks.valueY[i]});
+                    else if (type == static_cast<unsigned int>(AnimationType::Resize))
+                        trackWidget->setSize({tracks.valueX[i], tracks.valueY[i]});
+                    else
+                        trackWidget->setInheritedOpacity(tracks.valueX[i]);
+                }
+            }
+
+            // Finish the animations that reached their end
+            for (unsigned int type = 0; type < 3; ++type)
+            {
+                Tracks& tracks = m_tracks[type];
+                for (std::size_t i = 0; i < trackCounts[type]; ++i)
+                {
+                    if (tracks.widgets[i] && (!widget || (tracks.widgets[i] == widget)) && (tracks.elapsedTimes[i] >= tracks.durations[i]))
+                        finishTrack(static_cast<AnimationType>(type), i);
+                }
+            }
+
+            return trackAdvanced;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void AnimationEngine::setBatchUpdateActive(bool active)
+        {
+            m_batchUpdateActive = active;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        bool MoveAnimation::update(Duration elapsedTime)
+        bool AnimationEngine::isBatchUpdateActive() const
         {
-            m_elapsedTime += elapsedTime;
-            if (m_elapsedTime >= m_totalDuration)
+            return m_batchUpdateActive;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void AnimationEngine::finishAnimations(const Widget* widget, AnimationType type)
+        {
+            const UpdateDepthGuard updateDepthGuard{*this};
+
+            // Animations that are started by the finished callbacks aren't finished immediately
+            Tracks& tracks = getTracks(type);
+            const std::size_t count = tracks.widgets.size();
+            for (std::size_t i = 0; i < count; ++i)
             {
-                finish();
-                return true;
+                if (tracks.widgets[i] == widget)
+                    finishTrack(type, i);
             }
+        }
 
-            m_widget->setPosition(m_startPos + ((m_elapsedTime / m_totalDuration) * (m_endPos.getValue() - m_startPos)));
-            return false;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void AnimationEngine::finishAllAnimations(const Widget* widget)
+        {
+            if (!hasAnimations(widget))
+                return;
+
+            finishAnimations(widget, AnimationType::Move);
+            finishAnimations(widget, AnimationType::Resize);
+            finishAnimations(widget, AnimationType::Opacity);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void MoveAnimation::finish()
+        void AnimationEngine::removeAnimations(const Widget* widget)
         {
-            m_widget->setPosition(m_endPos);
-            Animation::finish();
+            for (unsigned int type = 0; type < 3; ++type)
+            {
+                Tracks& tracks = m_tracks[type];
+                for (std::size_t i = tracks.widgets.size(); i > 0; --i)
+                {
+                    if (tracks.widgets[i-1] == widget)
+                        removeTrack(static_cast<AnimationType>(type), i-1);
+                }
+            }
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        ResizeAnimation::ResizeAnimation(Widget::Ptr widget, Vector2f start, Layout2d end, Duration duration, std::function<void()> finishedCallback) :
-            Animation  {AnimationType::Resize, std::move(widget), duration, std::move(finishedCallback)},
-            m_startSize{start},
-            m_endSize  {std::move(end)}
+        void AnimationEngine::moveAnimations(const Widget* widget, AnimationEngine& target)
         {
+            if (&target == this)
+                return;
+
+            for (unsigned int type = 0; type < 3; ++type)
+            {
+                Tracks& tracks = m_tracks[type];
+                for (std::size_t i = 0; i < tracks.widgets.size(); ++i)
+                {
+                    if (tracks.widgets[i] != widget)
+                        continue;
+
+                    target.addTrack(static_cast<AnimationType>(type), tracks.widgets[i], {tracks.startX[i], tracks.startY[i]},
+                                    {tracks.endX[i], tracks.endY[i]}, tracks.endLayouts[i], tracks.durations[i],
+                                    tracks.easings[i], std::move(tracks.finishedCallbacks[i]));
+
+                    Tracks& targetTracks = target.m_tracks[type];
+                    targetTracks.elapsedTimes.back() = tracks.elapsedTimes[i];
+                }
+            }
+
+            removeAnimations(widget);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        bool ResizeAnimation::update(Duration elapsedTime)
+        bool AnimationEngine::hasAnimations(const Widget* widget) const
         {
-            m_elapsedTime += elapsedTime;
-            if (m_elapsedTime >= m_totalDuration)
+            for (const auto& tracks : m_tracks)
             {
-                finish();
-                return true;
+                if (std::find(tracks.widgets.begin(), tracks.widgets.end(), widget) != tracks.widgets.end())
+                    return true;
             }
 
-            m_widget->setSize(m_startSize + ((m_elapsedTime / m_totalDuration) * (m_endSize.getValue() - m_startSize)));
             return false;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void ResizeAnimation::finish()
+        bool AnimationEngine::empty() const
         {
-            m_widget->setSize(m_endSize);
-            Animation::finish();
+            return m_tracks[0].widgets.empty() && m_tracks[1].widgets.empty() && m_tracks[2].widgets.empty();
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        FadeAnimation::FadeAnimation(Widget::Ptr widget, float start, float end, Duration duration, std::function<void()> finishedCallback) :
-            Animation     {AnimationType::Opacity, std::move(widget), duration, std::move(finishedCallback)},
-            m_startOpacity{std::max(0.f, std::min(1.f, start))},
-            m_endOpacity  {std::max(0.f, std::min(1.f, end))}
+        bool AnimationEngine::hasPlayingAnimations(const Widget* owner) const
         {
+            for (const auto& tracks : m_tracks)
+            {
+                for (const Widget* widget : tracks.widgets)
+                {
+                    if ((widget == owner) || (widget && widget->isVisible()))
+                        return true;
+                }
+            }
+
+            return false;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        bool FadeAnimation::update(Duration elapsedTime)
+        float AnimationEngine::applyEasing(EasingType easing, float progress)
         {
-            m_elapsedTime += elapsedTime;
-            if (m_elapsedTime >= m_totalDuration)
+            switch (easing)
             {
-                finish();
-                return true;
+                case EasingType::Linear:
+                    return progress;
+                case EasingType::EaseIn:
+                    return progress * progress * progress;
+                case EasingType::EaseOut:
+                {
+                    const float inverse = 1 - progress;
+                    return 1 - (inverse * inverse * inverse);
+                }
+                case EasingType::EaseInOut:
+                {
+                    if (progress < 0.5f)
+                        return 4 * progress * progress * progress;
+
+                    const float inverse = 2 - (2 * progress);
+                    return 1 - (inverse * inverse * inverse / 2);
+                }
             }
 
-            m_widget->setInheritedOpacity(m_startOpacity + ((m_elapsedTime / m_totalDuration) * (m_endOpacity - m_startOpacity)));
-            return false;
+            TGUI_ASSERT(false, "Unhandled easing type");
+            return progress;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void AnimationEngine::addTrack(AnimationType type, Widget* widget, Vector2f start, Vector2f end, Layout2d endLayout,
+                                       Duration duration, EasingType easing, std::function<void()> finishedCallback)
+        {
+            Tracks& tracks = getTracks(type);
+            tracks.widgets.push_back(widget);
+            tracks.elapsedTimes.push_back(Duration{});
+            tracks.durations.push_back(duration);
+            tracks.easings.push_back(easing);
+            tracks.startX.push_back(start.x);
+            tracks.startY.push_back(start.y);
+            tracks.endX.push_back(end.x);
+            tracks.endY.push_back(end.y);
+            tracks.valueX.push_back(start.x);
+            tracks.valueY.push_back(start.y);
+            tracks.endLayouts.push_back(std::move(endLayout));
+            tracks.finishedCallbacks.push_back(std::move(finishedCallback));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void AnimationEngine::finishTrack(AnimationType type, std::size_t index)
+        {
+            TGUI_ASSERT(m_updateDepth > 0, "AnimationEngine::finishTrack can only be called while the engine is locked");
+
+            // The track is removed before calling any code, so that it can't be finished a second time.
+            // The arrays can grow while the callback is executed, so the values have to be copied.
+            Tracks& tracks = getTracks(type);
+            Widget* const widget = tracks.widgets[index];
+            const float endOpacity = tracks.endX[index];
+            const Layout2d endLayout = std::move(tracks.endLayouts[index]);
+            const std::function<void()> finishedCallback = std::move(tracks.finishedCallbacks[index]);
+            removeTrack(type, index);
+
+            if (type == AnimationType::Move)
+                widget->setPosition(endLayout);
+            else if (type == AnimationType::Resize)
+                widget->setSize(endLayout);
+            else
+                widget->setInheritedOpacity(endOpacity);
+
+            if (finishedCallback)
+                finishedCallback();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void AnimationEngine::removeTrack(AnimationType type, std::size_t index)
+        {
+            Tracks& tracks = getTracks(type);
+            if (m_updateDepth > 0)
+            {
+                tracks.widgets[index] = nullptr;
+                tracks.finishedCallbacks[index] = nullptr;
+                m_stoppedTracksPending = true;
+                return;
+            }
+
+            const auto offset = static_cast<std::ptrdiff_t>(index);
+            tracks.widgets.erase(tracks.widgets.begin() + offset);
+            tracks.elapsedTimes.erase(tracks.elapsedTimes.begin() + offset);
+            tracks.durations.erase(tracks.durations.begin() + offset);
+            tracks.easings.erase(tracks.easings.begin() + offset);
+            tracks.startX.erase(tracks.startX.begin() + offset);
+            tracks.startY.erase(tracks.startY.begin() + offset);
+            tracks.endX.erase(tracks.endX.begin() + offset);
+            tracks.endY.erase(tracks.endY.begin() + offset);
+            tracks.valueX.erase(tracks.valueX.begin() + offset);
+            tracks.valueY.erase(tracks.valueY.begin() + offset);
+            tracks.endLayouts.erase(tracks.endLayouts.begin() + offset);
+            tracks.finishedCallbacks.erase(tracks.finishedCallbacks.begin() + offset);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void AnimationEngine::removeStoppedTracks()
+        {
+            m_stoppedTracksPending = false;
+            for (auto& tracks : m_tracks)
+            {
+                // Move the remaining animations to the front while keeping them in the same order
+                std::size_t newCount = 0;
+                for (std::size_t i = 0; i < tracks.widgets.size(); ++i)
+                {
+                    if (!tracks.widgets[i])
+                        continue;
+
+                    if (newCount != i)
+                    {
+                        tracks.widgets[newCount] = tracks.widgets[i];
+                        tracks.elapsedTimes[newCount] = tracks.elapsedTimes[i];
+                        tracks.durations[newCount] = tracks.durations[i];
+                        tracks.easings[newCount] = tracks.easings[i];
+                        tracks.startX[newCount] = tracks.startX[i];
+                        tracks.startY[newCount] = tracks.startY[i];
+                        tracks.endX[newCount] = tracks.endX[i];
+                        tracks.endY[newCount] = tracks.endY[i];
+                        tracks.valueX[newCount] = tracks.valueX[i];
+                        tracks.valueY[newCount] = tracks.valueY[i];
+                        tracks.endLayouts[newCount] = std::move(tracks.endLayouts[i]);
+                        tracks.finishedCallbacks[newCount] = std::move(tracks.finishedCallbacks[i]);
+                    }
+
+                    ++newCount;
+                }
+
+                tracks.widgets.resize(newCount);
+                tracks.elapsedTimes.resize(newCount);
+                tracks.durations.resize(newCount);
+                tracks.easings.resize(newCount);
+                tracks.startX.resize(newCount);
+                tracks.startY.resize(newCount);
+                tracks.endX.resize(newCount);
+                tracks.endY.resize(newCount);
+                tracks.valueX.resize(newCount);
+                tracks.valueY.resize(newCount);
+                tracks.endLayouts.resize(newCount);
+                tracks.finishedCallbacks.resize(newCount);
+            }
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void FadeAnimation::finish()
+        AnimationEngine::Tracks& AnimationEngine::getTracks(AnimationType type)
         {
-            m_widget->setInheritedOpacity(m_endOpacity);
-            Animation::finish();
+            return m_tracks[static_cast<unsigned int>(type)];
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
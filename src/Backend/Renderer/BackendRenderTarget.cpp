@@ -186,7 +186,7 @@ namespace tgui
     void BackendRenderTarget::drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget)
     {
         // If the widget lies outside of the clip rect then we can skip drawing it
-        const FloatRect& clipRect = m_clipLayers.empty() ? m_viewRect : m_clipLayers.back().first;
+        const FloatRect clipRect = getClipRect();
         const Vector2f widgetBottomRight{states.transform.transformPoint(widget->getWidgetOffset() + widget->getFullSize())};
         const Vector2f widgetTopLeft = states.transform.transformPoint(widget->getWidgetOffset());
         if ((widgetTopLeft.x > clipRect.left + clipRect.width) || (widgetTopLeft.y > clipRect.top + clipRect.height)
@@ -207,10 +207,10 @@ namespace tgui
         TGUI_ASSERT(m_targetSize.x > 0 && m_targetSize.y > 0, "Target size must be valid in BackendRenderTarget::addClippingLayer");
 
         /// TODO: We currently can't clip rotated objects (except for 90°, 180° or 270° rotations)
-        const std::array<float, 16>& transformMatrix = states.transform.getMatrix();
-        if (((std::abs(transformMatrix[1]) > 0.00001f) || (std::abs(transformMatrix[4]) > 0.00001f)) // 0° or 180°
-         && ((std::abs(transformMatrix[1] - 1) > 0.00001f) || (std::abs(transformMatrix[4] + 1) > 0.00001f)) // 90°
-         && ((std::abs(transformMatrix[1] + 1) > 0.00001f) || (std::abs(transformMatrix[4] - 1) > 0.00001f))) // -90°
+        const std::array<float, 6>& transformMatrix = states.transform.getAffineMatrix();
+        if (((std::abs(transformMatrix[1]) > 0.00001f) || (std::abs(transformMatrix[2]) > 0.00001f)) // 0° or 180°
+         && ((std::abs(transformMatrix[1] - 1) > 0.00001f) || (std::abs(transformMatrix[2] + 1) > 0.00001f)) // 90°
+         && ((std::abs(transformMatrix[1] + 1) > 0.00001f) || (std::abs(transformMatrix[2] - 1) > 0.00001f))) // -90°
         {
             if (!m_clipLayers.empty())
                 m_clipLayers.push_back(m_clipLayers.back());
@@ -222,7 +222,7 @@ namespace tgui
         const Vector2f bottomRight{states.transform.transformPoint(rect.getPosition() + rect.getSize())};
         const Vector2f topLeft = states.transform.transformPoint(rect.getPosition());
 
-        const FloatRect oldClipRect = m_clipLayers.empty() ? m_viewRect : m_clipLayers.back().first;
+        const FloatRect oldClipRect = getClipRect();
         const float clipLeft = std::max(topLeft.x, oldClipRect.left);
         const float clipTop = std::max(topLeft.y, oldClipRect.top);
         const float clipRight = std::min(bottomRight.x, oldClipRect.left + oldClipRect.width);
@@ -262,6 +262,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    FloatRect BackendRenderTarget::getClipRect() const
+    {
+        return m_clipLayers.empty() ? m_viewRect : m_clipLayers.back().first;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTarget::drawBorders(const RenderStates& states, const Borders& borders, Vector2f size, Color color)
     {
         //////////////////////
@@ -345,9 +352,8 @@ namespace tgui
         else
             backendTexture = sprite.getTexture().getData()->backendTexture;
 
-        const auto& vertices = sprite.getVertices();
         const auto& indices = sprite.getIndices();
-        drawVertexArray(transformedStates, vertices.data(), vertices.size(), indices.data(), indices.size(), backendTexture);
+        drawVertexArray(transformedStates, sprite.getVertices(), sprite.getVertexCount(), indices.data(), indices.size(), backendTexture);
 
         if (clippingRequired)
             removeClippingLayer();
@@ -286,6 +286,11 @@ namespace tgui
         if (m_characterSize == 0)
             return;
 
+        // Each character adds at most one quad, so reserve the memory at once instead of letting the vectors grow
+        m_vertices->reserve(6 * m_string.length());
+        if (m_outlineVertices)
+            m_outlineVertices->reserve(6 * m_string.length());
+
         const Vertex::Color vertexFillColor(m_fillColor);
         const Vertex::Color vertexOutlineColor(m_outlineColor);
 
@@ -24,21 +24,40 @@
 
 
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
+#include <TGUI/PixelKernels.hpp>
+
+#include <algorithm>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        TGUI_NODISCARD unsigned int countSetBits(unsigned int value)
+        {
+            unsigned int count = 0;
+            for (; value != 0; value &= value - 1)
+                ++count;
+            return count;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool BackendTexture::load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels, bool smooth)
+    bool BackendTexture::load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels, bool smooth, bool keepPixels)
     {
         TGUI_ASSERT(pixels, "load in BackendTexture doesn't accept a nullptr for pixels, use loadTextureOnly instead");
 
         if (!loadTextureOnly(size, pixels.get(), smooth))
             return false;
 
-        m_pixels = std::move(pixels);
+        if (keepPixels)
+            m_pixels = std::move(pixels);
+        else
+            createTransparencyMask(pixels.get());
+
         return true;
     }
 
@@ -48,7 +67,7 @@ namespace tgui
     {
         TGUI_ASSERT((size.x > 0) && (size.y > 0), "load and loadTextureOnly functions in BackendTexture needs a valid size");
 
-        m_pixels = nullptr;
+        clearPixelData();
         m_imageSize = size;
         m_isSmooth = smooth;
         return true;
@@ -77,15 +96,61 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool BackendTexture::isTransparentPixel(Vector2u pixel) const
+    void BackendTexture::setMipmapped(bool mipmapped)
     {
-        if (!m_pixels)
-            return false;
+        m_isMipmapped = mipmapped;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::isMipmapped() const
+    {
+        return m_isMipmapped;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::hasMipmaps() const
+    {
+        return m_isMipmapped;
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::isTransparentPixel(Vector2u pixel) const
+    {
         TGUI_ASSERT((pixel.x < m_imageSize.x) && (pixel.y < m_imageSize.y), "Pixel out of range in BackendTexture::isTransparentPixel");
 
-        const auto pixelOffset = (pixel.y * m_imageSize.x + pixel.x) * 4;
-        return (m_pixels[pixelOffset + 3] == 0);
+        switch (m_transparencyMaskType)
+        {
+        case TransparencyMaskType::None:
+        {
+            if (!m_pixels)
+                return false;
+
+            const auto pixelOffset = (pixel.y * m_imageSize.x + pixel.x) * 4;
+            return (m_pixels[pixelOffset + 3] == 0);
+        }
+        case TransparencyMaskType::Opaque:
+            return false;
+        case TransparencyMaskType::Transparent:
+            return true;
+        case TransparencyMaskType::Bits:
+        {
+            const std::size_t index = static_cast<std::size_t>(pixel.y) * m_imageSize.x + pixel.x;
+            return (m_transparencyBits[index / 8] & (1 << (index % 8))) != 0;
+        }
+        case TransparencyMaskType::RunLength:
+        {
+            // The pixel is transparent when an odd amount of transitions occur before or at its position
+            const auto rowBegin = m_transparencyRuns.begin() + m_transparencyRowOffsets[pixel.y];
+            const auto rowEnd = m_transparencyRuns.begin() + m_transparencyRowOffsets[pixel.y + 1];
+            const auto transitions = std::upper_bound(rowBegin, rowEnd, static_cast<std::uint16_t>(pixel.x)) - rowBegin;
+            return (transitions % 2) != 0;
+        }
+        }
+
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -96,6 +161,134 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendTexture::getPixelMemoryUsage() const
+    {
+        std::size_t bytes = m_transparencyBits.capacity()
+                          + (m_transparencyRowOffsets.capacity() * sizeof(std::uint32_t))
+                          + (m_transparencyRuns.capacity() * sizeof(std::uint16_t));
+        if (m_pixels)
+            bytes += static_cast<std::size_t>(m_imageSize.x) * m_imageSize.y * 4;
+
+        return bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendTexture::getGpuMemoryUsage() const
+    {
+        const std::size_t baseLevelSize = static_cast<std::size_t>(m_imageSize.x) * m_imageSize.y * 4;
+        if (!hasMipmaps())
+            return baseLevelSize;
+
+        // Every mipmap level is a quarter of the size of the previous level
+        std::size_t totalSize = baseLevelSize;
+        Vector2u levelSize = m_imageSize;
+        while ((levelSize.x > 1) || (levelSize.y > 1))
+        {
+            levelSize = {std::max(1u, levelSize.x / 2), std::max(1u, levelSize.y / 2)};
+            totalSize += static_cast<std::size_t>(levelSize.x) * levelSize.y * 4;
+        }
+        return totalSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::createTransparencyMask(const std::uint8_t* pixels)
+    {
+        m_transparencyBits.clear();
+        m_transparencyRowOffsets.clear();
+        m_transparencyRuns.clear();
+
+        // Extract one bit per pixel, which also tells us how many pixels are transparent
+        const std::size_t pixelCount = static_cast<std::size_t>(m_imageSize.x) * m_imageSize.y;
+        const std::size_t bitsSize = (pixelCount + 7) / 8;
+        std::vector<std::uint8_t> bits(bitsSize);
+        const std::size_t transparentPixelCount = PixelKernels::extractTransparencyMask(pixels, pixelCount, bits.data());
+        if (transparentPixelCount == 0)
+        {
+            m_transparencyMaskType = TransparencyMaskType::Opaque;
+            return;
+        }
+        if (transparentPixelCount == pixelCount)
+        {
+            m_transparencyMaskType = TransparencyMaskType::Transparent;
+            return;
+        }
+
+        const auto getBit = [&bits](std::size_t index){ return ((bits[index / 8] >> (index % 8)) & 1) != 0; };
+
+        // Count the amount of times the transparency changes within a row, in order to decide which mask representation
+        // uses the least memory. Each bit is compared with the previous one, 8 pixels at a time. The first pixel of each
+        // row has to be compared with an opaque pixel instead, which is corrected for afterwards.
+        std::size_t transitionCount = 0;
+        unsigned int previousBit = 0;
+        for (const std::uint8_t byte : bits)
+        {
+            transitionCount += countSetBits((byte ^ ((byte << 1) | previousBit)) & 0xFFu);
+            previousBit = static_cast<unsigned int>(byte >> 7);
+        }
+
+        // The unused bits at the end of the mask are 0, so there is a transition after the last pixel if it is transparent
+        if (((pixelCount % 8) != 0) && getBit(pixelCount - 1))
+            --transitionCount;
+
+        for (std::size_t rowStart = m_imageSize.x; rowStart < pixelCount; rowStart += m_imageSize.x)
+        {
+            if (!getBit(rowStart - 1))
+                continue;
+
+            if (getBit(rowStart))
+                ++transitionCount;
+            else
+                --transitionCount;
+        }
+
+        const std::size_t runLengthSize = ((m_imageSize.y + 1) * sizeof(std::uint32_t)) + (transitionCount * sizeof(std::uint16_t));
+        if ((m_imageSize.x <= std::numeric_limits<std::uint16_t>::max()) && (runLengthSize < bitsSize))
+        {
+            m_transparencyMaskType = TransparencyMaskType::RunLength;
+            m_transparencyRowOffsets.reserve(m_imageSize.y + 1);
+            m_transparencyRuns.reserve(transitionCount);
+
+            std::size_t index = 0;
+            for (unsigned int y = 0; y < m_imageSize.y; ++y)
+            {
+                m_transparencyRowOffsets.push_back(static_cast<std::uint32_t>(m_transparencyRuns.size()));
+
+                bool transparent = false;
+                for (unsigned int x = 0; x < m_imageSize.x; ++x, ++index)
+                {
+                    const bool pixelTransparent = getBit(index);
+                    if (pixelTransparent != transparent)
+                    {
+                        m_transparencyRuns.push_back(static_cast<std::uint16_t>(x));
+                        transparent = pixelTransparent;
+                    }
+                }
+            }
+
+            m_transparencyRowOffsets.push_back(static_cast<std::uint32_t>(m_transparencyRuns.size()));
+        }
+        else
+        {
+            m_transparencyMaskType = TransparencyMaskType::Bits;
+            m_transparencyBits = std::move(bits);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::clearPixelData()
+    {
+        m_pixels = nullptr;
+        m_transparencyMaskType = TransparencyMaskType::None;
+        m_transparencyBits = {};
+        m_transparencyRowOffsets = {};
+        m_transparencyRuns = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,8 @@
 #include <TGUI/Backend/Renderer/OpenGL.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
 
+#include <vector>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -51,6 +53,71 @@ namespace tgui
 
         BackendTexture::loadTextureOnly(size, pixels, smooth);
 
+        uploadPixels(pixels, reuseTexture);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextureGLES2::setSmooth(bool smooth)
+    {
+        if (m_isSmooth == smooth)
+            return;
+
+        BackendTexture::setSmooth(smooth);
+
+        if (!m_textureId)
+            return;
+
+        GLint oldBoundTexture;
+        TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
+
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, priv::getTextureMinFilterOpenGL(m_isSmooth, hasMipmaps())));
+
+        // Restore the texture that was bound when this function was called
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextureGLES2::setMipmapped(bool mipmapped)
+    {
+        if (m_isMipmapped == mipmapped)
+            return;
+
+        if (!m_textureId)
+        {
+            BackendTexture::setMipmapped(mipmapped);
+            return;
+        }
+
+        // The amount of mipmap levels is fixed when the texture storage is created, so we need to create a new texture
+        // with the contents of the current one. OpenGL ES can't read textures directly, so the texture is attached
+        // to a temporary framebuffer from which the pixels are read back.
+        std::vector<std::uint8_t> pixels(static_cast<std::size_t>(m_imageSize.x) * m_imageSize.y * 4);
+
+        GLint oldFramebuffer;
+        TGUI_GL_CHECK(glGetIntegerv(GL_FRAMEBUFFER_BINDING, &oldFramebuffer));
+
+        GLuint framebuffer;
+        TGUI_GL_CHECK(glGenFramebuffers(1, &framebuffer));
+        TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, framebuffer));
+        TGUI_GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_textureId, 0));
+        TGUI_GL_CHECK(glReadPixels(0, 0, static_cast<GLsizei>(m_imageSize.x), static_cast<GLsizei>(m_imageSize.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels.data()));
+
+        TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(oldFramebuffer)));
+        TGUI_GL_CHECK(glDeleteFramebuffers(1, &framebuffer));
+
+        BackendTexture::setMipmapped(mipmapped);
+        uploadPixels(pixels.data(), false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextureGLES2::uploadPixels(const std::uint8_t* pixels, bool reuseTexture)
+    {
         if (!reuseTexture)
         {
             if (m_textureId != 0)
@@ -64,58 +131,57 @@ namespace tgui
 
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
 
+        const bool mipmapped = hasMipmaps();
+        const auto width = static_cast<GLsizei>(m_imageSize.x);
+        const auto height = static_cast<GLsizei>(m_imageSize.y);
         if (reuseTexture)
         {
             if (pixels)
-                TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+                TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
         }
         else
         {
-            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
-            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, priv::getTextureMinFilterOpenGL(m_isSmooth, mipmapped)));
 
             TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
             TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
 
             if (TGUI_GLAD_GL_ES_VERSION_3_0)
             {
-                TGUI_GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y)));
+                const GLsizei levels = mipmapped ? priv::getMipmapLevelCountOpenGL(m_imageSize.x, m_imageSize.y) : 1;
+                TGUI_GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, levels, GL_RGBA8, width, height));
                 if (pixels)
-                    TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+                    TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
             }
             else
             {
                 // GLES 2.0 doesn't support GL_RGBA8
-                TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+                TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
             }
         }
 
+        // The smaller levels are calculated on the GPU from the full resolution image
+        if (mipmapped && pixels)
+            TGUI_GL_CHECK(glGenerateMipmap(GL_TEXTURE_2D));
+
         // Restore the texture that was bound when this function was called
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
-        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BackendTextureGLES2::setSmooth(bool smooth)
+    bool BackendTextureGLES2::hasMipmaps() const
     {
-        if (m_isSmooth == smooth)
-            return;
-
-        BackendTexture::setSmooth(smooth);
+        if (!m_isMipmapped)
+            return false;
 
-        if (!m_textureId)
-            return;
+        if (TGUI_GLAD_GL_ES_VERSION_3_0)
+            return true;
 
-        GLint oldBoundTexture;
-        TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
-
-        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
-        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
-        TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
-
-        // Restore the texture that was bound when this function was called
-        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
+        // OpenGL ES 2.0 only supports mipmaps when the size is a power of two
+        const auto isPowerOfTwo = [](unsigned int value){ return (value != 0) && ((value & (value - 1)) == 0); };
+        return isPowerOfTwo(m_imageSize.x) && isPowerOfTwo(m_imageSize.y);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
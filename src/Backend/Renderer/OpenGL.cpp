@@ -69,6 +69,30 @@ namespace tgui
         {
         }
 #endif
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        GLint getTextureMinFilterOpenGL(bool smooth, bool mipmapped)
+        {
+            if (mipmapped)
+                return smooth ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_NEAREST;
+            else
+                return smooth ? GL_LINEAR : GL_NEAREST;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        GLsizei getMipmapLevelCountOpenGL(unsigned int width, unsigned int height)
+        {
+            GLsizei levels = 1;
+            unsigned int largestSide = (width > height) ? width : height;
+            while (largestSide > 1)
+            {
+                largestSide /= 2;
+                ++levels;
+            }
+            return levels;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -131,6 +131,12 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendTextureSDL::setMipmapped(bool)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     SDL_Texture* BackendTextureSDL::getInternalTexture() const
     {
         return m_texture;
@@ -144,7 +150,7 @@ namespace tgui
             SDL_DestroyTexture(m_texture);
 
         m_texture = texture;
-        m_pixels = nullptr;
+        clearPixelData();
 
         int width;
         int height;
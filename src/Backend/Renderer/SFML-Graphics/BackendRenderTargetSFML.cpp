@@ -115,7 +115,7 @@ namespace tgui
         sfStates.shader = sprite.getTexture().getShader();
 
         const Vector2f textureSize = texture ? Vector2f{texture->getSize()} : Vector2f{1,1};
-        const std::vector<Vertex>& vertices = sprite.getVertices();
+        const Vertex* vertices = sprite.getVertices();
         const std::vector<unsigned int>& indices = sprite.getIndices();
         std::vector<Vertex> triangleVertices(indices.size());
         for (unsigned int i = 0; i < indices.size(); ++i)
@@ -208,13 +208,13 @@ namespace tgui
 
     sf::RenderStates BackendRenderTargetSFML::convertRenderStates(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture)
     {
-        const std::array<float, 16>& transformMatrix = states.transform.getMatrix();
+        const std::array<float, 6>& transformMatrix = states.transform.getAffineMatrix();
 
         sf::RenderStates statesSFML;
         statesSFML.transform = sf::Transform(
-            transformMatrix[0], transformMatrix[4], transformMatrix[12],
-            transformMatrix[1], transformMatrix[5], transformMatrix[13],
-            transformMatrix[3], transformMatrix[7], transformMatrix[15]);
+            transformMatrix[0], transformMatrix[2], transformMatrix[4],
+            transformMatrix[1], transformMatrix[3], transformMatrix[5],
+            0, 0, 1);
 
         if (texture)
         {
@@ -55,8 +55,14 @@ namespace tgui
         }
 
         if (pixels)
+        {
             m_texture.update(pixels);
 
+            // Updating the texture invalidated the mipmaps
+            if (m_isMipmapped)
+                m_isMipmapped = m_texture.generateMipmap();
+        }
+
         return true;
     }
 
@@ -70,6 +76,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendTextureSFML::setMipmapped(bool mipmapped)
+    {
+        if (m_isMipmapped == mipmapped)
+            return;
+
+        if (mipmapped)
+        {
+            if (m_texture.getSize().x > 0)
+                m_isMipmapped = m_texture.generateMipmap();
+            else
+                m_isMipmapped = true; // Mipmaps will be generated when the texture gets loaded
+        }
+        else
+        {
+            // SFML can't remove the mipmaps from a texture, but a copy of the texture won't have them
+            sf::Texture texture{m_texture};
+            m_texture.swap(texture);
+            m_isMipmapped = false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     sf::Texture& BackendTextureSFML::getInternalTexture()
     {
         return m_texture;
@@ -88,9 +117,10 @@ namespace tgui
     {
         m_texture = texture;
 
-        m_pixels = nullptr;
+        clearPixelData();
         m_imageSize = {texture.getSize().x, texture.getSize().y};
         m_isSmooth = texture.isSmooth();
+        m_isMipmapped = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
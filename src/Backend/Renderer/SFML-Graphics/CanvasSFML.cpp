@@ -195,18 +195,18 @@ namespace tgui
         if (!sprite.getTexture().getData())
             return;
 
-        const std::vector<Vertex>& vertices = sprite.getVertices();
+        const Vertex* vertices = sprite.getVertices();
         const std::vector<unsigned int>& indices = sprite.getIndices();
         std::vector<Vertex> triangleVertices(indices.size());
         for (std::size_t i = 0; i < indices.size(); ++i)
             triangleVertices[i] = vertices[indices[i]];
 
         sf::RenderStates statesSFML;
-        const std::array<float, 16>& transformMatrix = states.transform.getMatrix();
+        const std::array<float, 6>& transformMatrix = states.transform.getAffineMatrix();
         statesSFML.transform = sf::Transform(
-            transformMatrix[0], transformMatrix[4], transformMatrix[12],
-            transformMatrix[1], transformMatrix[5], transformMatrix[13],
-            transformMatrix[3], transformMatrix[7], transformMatrix[15]);
+            transformMatrix[0], transformMatrix[2], transformMatrix[4],
+            transformMatrix[1], transformMatrix[3], transformMatrix[5],
+            0, 0, 1);
 
         TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSFML>(sprite.getTexture().getData()->backendTexture),
                     "CanvasSFML::draw requires sprite to have a backend texture of type BackendTextureSFML");
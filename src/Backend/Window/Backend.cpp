@@ -149,6 +149,12 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Backend::wakeUpEventLoop()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Backend::setClipboard(const String& contents)
     {
         m_clipboardContents = contents;
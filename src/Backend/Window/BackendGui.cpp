@@ -27,6 +27,8 @@
 #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Timer.hpp>
+#include <TGUI/Signal.hpp>
+#include <TGUI/Components.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -103,6 +105,46 @@ namespace tgui
 
     bool BackendGui::handleEvent(Event event)
     {
+        if (m_inputEventsCoalesced)
+        {
+            if ((event.type == Event::Type::MouseMoved) || (event.type == Event::Type::MouseWheelScrolled))
+            {
+                if (!m_queuedInputEvents.empty() && (m_queuedInputEvents.back().type == event.type))
+                {
+                    Event& queuedEvent = m_queuedInputEvents.back();
+                    if ((event.type == Event::Type::MouseMoved) && !m_rawMouseInput)
+                    {
+                        queuedEvent = event;
+                        ++m_coalescedInputEventCount;
+                        return false;
+                    }
+                    else if ((event.type == Event::Type::MouseWheelScrolled)
+                          && (queuedEvent.mouseWheel.x == event.mouseWheel.x) && (queuedEvent.mouseWheel.y == event.mouseWheel.y))
+                    {
+                        queuedEvent.mouseWheel.delta += event.mouseWheel.delta;
+                        ++m_coalescedInputEventCount;
+                        return false;
+                    }
+                }
+
+                m_queuedInputEvents.push_back(event);
+                return false;
+            }
+
+            // Events have to reach the widgets in the order in which they occurred
+            flushInputEvents();
+        }
+
+        return processEvent(event);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::processEvent(const Event& event)
+    {
+        // Widgets need to be at their final location before we can find out which one the event is meant for
+        flushLayout();
+
         switch (event.type)
         {
             case Event::Type::MouseMoved:
@@ -224,10 +266,13 @@ namespace tgui
 
     void BackendGui::draw()
     {
+        flushInputEvents();
+
         if (m_drawUpdatesTime)
             updateTime();
 
         TGUI_ASSERT(m_backendRenderTarget != nullptr, "Gui must be given a window (or render target) before calling draw()");
+        flushLayout();
         m_backendRenderTarget->drawGui(m_container);
     }
 
@@ -493,6 +538,164 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendGui::setLayoutUpdatesDeferred(bool deferred)
+    {
+        m_layoutUpdatesDeferred = deferred;
+        if (!deferred)
+            flushLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::getLayoutUpdatesDeferred() const
+    {
+        return m_layoutUpdatesDeferred;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::flushLayout()
+    {
+        if (m_pendingLayoutWidgets.empty())
+            return;
+
+        // Updating a widget may change layouts of other widgets. These should only be marked as well, as they will be updated
+        // later in the same pass. Otherwise the changes would recursively propagate through the widgets like without deferring.
+        const bool wasDeferred = m_layoutUpdatesDeferred;
+        m_layoutUpdatesDeferred = true;
+
+        std::unordered_set<const Widget*> visitedWidgets;
+        std::vector<Widget::Ptr> sortedWidgets;
+        std::vector<std::pair<Widget*, bool>> stack; // The bool indicates whether the dependents of the widget were pushed
+        std::vector<Widget*> dependents;
+        while (!m_pendingLayoutWidgets.empty())
+        {
+            std::vector<std::weak_ptr<Widget>> pendingWidgets;
+            pendingWidgets.swap(m_pendingLayoutWidgets);
+
+            // Sort the widgets that need to be updated topologically with a depth-first search over the widgets that
+            // depend on them. The widgets are found in reverse order: a widget is only added after all its dependents.
+            visitedWidgets.clear();
+            sortedWidgets.clear();
+            for (const auto& weakWidget : pendingWidgets)
+            {
+                const Widget::Ptr pendingWidget = weakWidget.lock();
+                if (!pendingWidget || !pendingWidget->isLayoutUpdatePending() || (visitedWidgets.count(pendingWidget.get()) > 0))
+                    continue;
+
+                stack.emplace_back(pendingWidget.get(), false);
+                while (!stack.empty())
+                {
+                    Widget* const widget = stack.back().first;
+                    if (stack.back().second)
+                    {
+                        sortedWidgets.push_back(widget->shared_from_this());
+                        stack.pop_back();
+                        continue;
+                    }
+
+                    if (!visitedWidgets.insert(widget).second)
+                    {
+                        stack.pop_back();
+                        continue;
+                    }
+
+                    stack.back().second = true;
+
+                    // Widgets outside this gui can't be waiting for an update, they are always updated immediately
+                    dependents.clear();
+                    widget->getLayoutDependents(dependents);
+                    for (auto* dependent : dependents)
+                    {
+                        if ((dependent->getParentGui() == this) && (visitedWidgets.count(dependent) == 0))
+                            stack.emplace_back(dependent, false);
+                    }
+                }
+            }
+
+            // Widgets that get marked again while updating the others will be handled in a next iteration
+            for (auto it = sortedWidgets.rbegin(); it != sortedWidgets.rend(); ++it)
+                (*it)->applyPendingLayoutUpdate();
+        }
+
+        m_layoutUpdatesDeferred = wasDeferred;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::scheduleLayoutUpdate(Widget* widget)
+    {
+        TGUI_ASSERT(widget->getParentGui() == this, "BackendGui::scheduleLayoutUpdate can only be called for widgets inside the gui");
+        m_pendingLayoutWidgets.push_back(widget->shared_from_this());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setInputEventsCoalesced(bool coalesced)
+    {
+        m_inputEventsCoalesced = coalesced;
+        if (!coalesced)
+            flushInputEvents();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::getInputEventsCoalesced() const
+    {
+        return m_inputEventsCoalesced;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setRawMouseInput(bool raw)
+    {
+        m_rawMouseInput = raw;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::getRawMouseInput() const
+    {
+        return m_rawMouseInput;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::flushInputEvents()
+    {
+        if (m_queuedInputEvents.empty())
+            return false;
+
+        // The queue is swapped out first, in case the events are queued again while processing them
+        std::vector<Event> queuedEvents;
+        queuedEvents.swap(m_queuedInputEvents);
+
+        bool eventHandled = false;
+        for (const auto& event : queuedEvents)
+        {
+            if (processEvent(event))
+                eventHandled = true;
+        }
+
+        // Reuse the memory of the queue for the next events if no new events were queued in the meantime
+        if (m_queuedInputEvents.empty())
+        {
+            queuedEvents.clear();
+            m_queuedInputEvents.swap(queuedEvents);
+        }
+
+        return eventHandled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint64_t BackendGui::getCoalescedInputEventCount() const
+    {
+        return m_coalescedInputEventCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendGui::updateTime()
     {
         const auto timePointNow = std::chrono::steady_clock::now();
@@ -511,10 +714,24 @@ namespace tgui
     {
         bool screenRefreshRequired = Timer::updateTime(elapsedTime);
 
+        // Emit the signals that were posted from other threads
+        if (Signal::dispatchPostedEmits())
+            screenRefreshRequired = true;
+
+        // Propagate the style changes that were published from other threads
+        if (priv::dev::MessageBroker::dispatchPostedEvents())
+            screenRefreshRequired = true;
+
         if (!m_windowFocused)
             return screenRefreshRequired;
 
+        // Animations can move and resize many widgets at once, so the layouts that depend on them are updated in a single pass
+        const bool layoutUpdatesDeferred = m_layoutUpdatesDeferred;
+        m_layoutUpdatesDeferred = true;
         screenRefreshRequired |= m_container->updateTime(elapsedTime);
+        m_layoutUpdatesDeferred = layoutUpdatesDeferred;
+        if (!layoutUpdatesDeferred)
+            flushLayout();
 
         if (m_tooltipPossible)
         {
@@ -553,6 +770,41 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> BackendGui::getTimeUntilNextUpdate() const
+    {
+        if (Signal::hasPostedEmits() || priv::dev::MessageBroker::hasPostedEvents())
+            return Duration{};
+
+        Optional<Duration> timeUntilNextUpdate = Timer::getNextScheduledTime();
+        const auto updateBefore = [&timeUntilNextUpdate](Duration duration){
+            if (!timeUntilNextUpdate || (duration < *timeUntilNextUpdate))
+                timeUntilNextUpdate = duration;
+        };
+
+        // The widgets aren't updated while the window isn't focused
+        if (m_windowFocused)
+        {
+            const Optional<Duration> widgetTime = m_container->getTimeUntilNextUpdate();
+            if (widgetTime)
+                updateBefore(*widgetTime);
+
+            if (m_tooltipPossible)
+                updateBefore((m_tooltipTime < ToolTip::getInitialDelay()) ? ToolTip::getInitialDelay() - m_tooltipTime : Duration{});
+        }
+
+        if (!timeUntilNextUpdate || (m_lastUpdateTime == std::chrono::steady_clock::time_point()))
+            return timeUntilNextUpdate;
+
+        // The durations are relative to the last time the clock was updated
+        const Duration timeSinceLastUpdate = std::chrono::steady_clock::now() - m_lastUpdateTime;
+        if (timeSinceLastUpdate >= *timeUntilNextUpdate)
+            return Duration{};
+
+        return *timeUntilNextUpdate - timeSinceLastUpdate;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f BackendGui::mapPixelToView(int x, int y) const
     {
         return {((x - m_viewport.getLeft()) * (m_view.getWidth() / m_viewport.getWidth())) + m_view.getLeft(),
@@ -570,7 +822,14 @@ namespace tgui
         if (m_backendRenderTarget)
             m_backendRenderTarget->setView(m_view.getRect(), m_viewport.getRect(), {static_cast<float>(m_framebufferSize.x), static_cast<float>(m_framebufferSize.y)});
 
+        // Changing the size of the root container affects all widgets with relative layouts,
+        // so the layouts are updated in a single pass instead of each time a widget changes.
+        const bool layoutUpdatesDeferred = m_layoutUpdatesDeferred;
+        m_layoutUpdatesDeferred = true;
         m_container->setSize(Vector2f{m_view.getWidth(), m_view.getHeight()});
+        m_layoutUpdatesDeferred = layoutUpdatesDeferred;
+        if (!layoutUpdatesDeferred)
+            flushLayout();
 
         // Derived classes should update m_view in their updateContainerSize() function before calling this function
         const FloatRect& viewRect = m_view.getRect();
@@ -162,6 +162,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendGLFW::wakeUpEventLoop()
+    {
+        glfwPostEmptyEvent();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     GLFWcursor* BackendGLFW::createSystemCursor(Cursor::Type type)
     {
         int typeGLFW = GLFW_ARROW_CURSOR;
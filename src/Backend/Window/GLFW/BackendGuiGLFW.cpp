@@ -25,7 +25,6 @@
 
 #include <TGUI/Backend/Window/GLFW/BackendGuiGLFW.hpp>
 #include <TGUI/Backend/Window/GLFW/BackendGLFW.hpp>
-#include <TGUI/Timer.hpp>
 
 #define GLFW_INCLUDE_NONE // Don't let GLFW include an OpenGL extention loader
 #include <GLFW/glfw3.h>
@@ -346,55 +345,108 @@ namespace tgui
         glfwSetWindowUserPointer(m_window, this);
 
         glfwSetWindowFocusCallback(m_window, [](GLFWwindow* window, int focused){
-            static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window))->windowFocusCallback(focused);
+            auto gui = static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window));
+            gui->mainLoopEventReceived();
+            gui->windowFocusCallback(focused);
         });
         glfwSetFramebufferSizeCallback(m_window, [](GLFWwindow* window, int width, int height){
-            static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window))->sizeCallback(width, height);
+            auto gui = static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window));
+            gui->mainLoopEventReceived();
+            gui->sizeCallback(width, height);
         });
         glfwSetCharCallback(m_window, [](GLFWwindow* window, unsigned int codepoint){
-            static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window))->charCallback(codepoint);
+            auto gui = static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window));
+            gui->mainLoopEventReceived();
+            gui->charCallback(codepoint);
         });
         glfwSetKeyCallback(m_window, [](GLFWwindow* window, int key, int scancode, int action, int mods){
-            static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window))->keyCallback(key, scancode, action, mods);
+            auto gui = static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window));
+            gui->mainLoopEventReceived();
+            gui->keyCallback(key, scancode, action, mods);
         });
         glfwSetScrollCallback(m_window, [](GLFWwindow* window, double xoffset, double yoffset){
-            static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window))->scrollCallback(xoffset, yoffset);
+            auto gui = static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window));
+            gui->mainLoopEventReceived();
+            gui->scrollCallback(xoffset, yoffset);
         });
         glfwSetCursorPosCallback(m_window, [](GLFWwindow* window, double xpos, double ypos){
-            static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window))->cursorPosCallback(xpos, ypos);
+            auto gui = static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window));
+            gui->mainLoopEventReceived();
+            gui->cursorPosCallback(xpos, ypos);
         });
         glfwSetMouseButtonCallback(m_window, [](GLFWwindow* window, int button, int action, int mods){
-            static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window))->mouseButtonCallback(button, action, mods);
+            auto gui = static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window));
+            gui->mainLoopEventReceived();
+            gui->mouseButtonCallback(button, action, mods);
+        });
+        glfwSetWindowRefreshCallback(m_window, [](GLFWwindow* window){
+            // The window contents were damaged (e.g. when the window was uncovered), so we have to draw again
+            static_cast<BackendGuiGLFW*>(glfwGetWindowUserPointer(window))->mainLoopEventReceived();
         });
 
         setDrawingUpdatesTime(false);
 
+        bool refreshRequired = true;
         std::chrono::steady_clock::time_point lastRenderTime;
         while (!glfwWindowShouldClose(m_window))
         {
-            // Don't try to render too often, even when the screen is changing (e.g. during animation)
-            const auto timePointNow = std::chrono::steady_clock::now();
-            const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
-            if (timePointNextAllowed <= timePointNow)
+            // Sleep until an event arrives or until the gui has to be updated or drawn. While the screen is changing
+            // (e.g. during animations) we don't wake up before the next frame is allowed to be rendered.
+            Optional<Duration> timeout;
+            if (refreshRequired)
             {
-                m_backendRenderTarget->clearScreen();
-                draw();
-                glfwSwapBuffers(m_window);
-                lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
+                const auto timePointNow = std::chrono::steady_clock::now();
+                const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
+                timeout = (timePointNextAllowed > timePointNow) ? Duration{timePointNextAllowed - timePointNow} : Duration{};
             }
+            else
+                timeout = getTimeUntilNextUpdate();
+
+            m_mainLoopEventReceived = false;
+            if (!timeout)
+                glfwWaitEvents();
+            else if (*timeout == Duration{})
+                glfwPollEvents();
+            else
+                glfwWaitEventsTimeout(static_cast<double>(timeout->asSeconds()));
+
+            if (m_mainLoopEventReceived)
+                refreshRequired = true;
+            if (flushInputEvents())
+                refreshRequired = true;
+            if (updateTime())
+                refreshRequired = true;
+
+            if (!refreshRequired)
+                continue;
 
-            double eventTimeoutSeconds = 0.01;
-            Optional<Duration> duration = Timer::getNextScheduledTime();
-            if (duration && (*duration < std::chrono::milliseconds(10)))
-                eventTimeoutSeconds = static_cast<double>(duration->asSeconds());
+            // Don't try to render too often, even when the screen is changing (e.g. during animation)
+            const auto timePointNow = std::chrono::steady_clock::now();
+            if (timePointNow < lastRenderTime + std::chrono::milliseconds(15))
+                continue;
+
+            m_backendRenderTarget->clearScreen();
+            draw();
+            glfwSwapBuffers(m_window);
 
-            glfwWaitEventsTimeout(eventTimeoutSeconds);
-            updateTime();
+            refreshRequired = false;
+            lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendGuiGLFW::mainLoopEventReceived()
+    {
+        if (m_mainLoopEventReceived)
+            return;
+
+        m_mainLoopEventReceived = true;
+        updateTime();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendGuiGLFW::setGuiWindow(GLFWwindow* window)
     {
         TGUI_ASSERT(std::dynamic_pointer_cast<BackendGLFW>(getBackend()), "BackendGuiGLFW requires system backend of type BackendGLFW");
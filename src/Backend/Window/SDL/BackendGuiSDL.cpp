@@ -25,11 +25,11 @@
 
 #include <TGUI/Backend/Window/SDL/BackendGuiSDL.hpp>
 #include <TGUI/Backend/Window/SDL/BackendSDL.hpp>
-#include <TGUI/Timer.hpp>
 
 #include <TGUI/extlibs/IncludeSDL.hpp>
 
-#include <thread>
+#include <algorithm>
+#include <limits>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -372,15 +372,6 @@ namespace tgui
 
         m_backendRenderTarget->setClearColor(clearColor);
 
-        // Helper function that calculates the amount of time to sleep, which is 10ms unless a timer will expire before this time
-        const auto getTimerWakeUpTime = []{
-            Optional<Duration> duration = Timer::getNextScheduledTime();
-            if (duration && (*duration < std::chrono::milliseconds(10)))
-                return *duration;
-            else
-                return Duration{std::chrono::milliseconds(10)};
-        };
-
         setDrawingUpdatesTime(false);
 
         bool quit = false;
@@ -388,52 +379,58 @@ namespace tgui
         std::chrono::steady_clock::time_point lastRenderTime;
         while (!quit)
         {
-            bool eventProcessed = false;
-            while (true)
+            // Sleep until an event arrives or until the gui has to be updated or drawn. While the screen is changing
+            // (e.g. during animations) we don't wake up before the next frame is allowed to be rendered.
+            Optional<Duration> timeout;
+            if (refreshRequired)
             {
-                // We could use SDL_WaitEventTimeout instead of SDL_PollEvent and custom timing in the future, but we would
-                // have to be careful not to keep calling the function with the same timeout while events keep coming.
-                SDL_Event event;
-                while (SDL_PollEvent(&event) != 0)
-                {
-                    if (handleEvent(event))
-                        eventProcessed = true;
-
-                    if (event.type == SDL_QUIT)
-                    {
-                        quit = true;
-                        eventProcessed = true;
-                    }
-                    else if ((event.type == SDL_WINDOWEVENT) && (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED))
-                    {
-                        eventProcessed = true;
-                    }
-                }
+                const auto timePointNow = std::chrono::steady_clock::now();
+                const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
+                timeout = (timePointNextAllowed > timePointNow) ? Duration{timePointNextAllowed - timePointNow} : Duration{};
+            }
+            else
+                timeout = getTimeUntilNextUpdate();
+
+            SDL_Event event;
+            bool eventReceived;
+            if (!timeout)
+                eventReceived = (SDL_WaitEvent(&event) != 0);
+            else if (*timeout == Duration{})
+                eventReceived = (SDL_PollEvent(&event) != 0);
+            else // Round the timeout up, waking up too early would only make us wait again
+            {
+                const double timeoutMs = std::min(std::ceil(static_cast<double>(timeout->asSeconds()) * 1000), static_cast<double>(std::numeric_limits<int>::max()));
+                eventReceived = (SDL_WaitEventTimeout(&event, static_cast<int>(timeoutMs)) != 0);
+            }
 
-                if (updateTime())
-                    break;
+            // The clock is updated before handling the events, so that e.g. the double click timeout is correct after a long wait
+            if (updateTime())
+                refreshRequired = true;
 
-                if (eventProcessed || refreshRequired)
-                    break;
+            while (eventReceived)
+            {
+                if (handleEvent(event))
+                    refreshRequired = true;
+
+                if (event.type == SDL_QUIT)
+                    quit = true;
+                else if ((event.type == SDL_WINDOWEVENT)
+                      && ((event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) || (event.window.event == SDL_WINDOWEVENT_EXPOSED)))
+                    refreshRequired = true;
 
-                std::this_thread::sleep_for(std::chrono::nanoseconds(getTimerWakeUpTime()));
+                eventReceived = (SDL_PollEvent(&event) != 0);
             }
 
-            refreshRequired = true;
+            if (flushInputEvents())
+                refreshRequired = true;
+
+            if (quit || !refreshRequired)
+                continue;
 
             // Don't try to render too often, even when the screen is changing (e.g. during animation)
             const auto timePointNow = std::chrono::steady_clock::now();
-            const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
-            if (timePointNextAllowed > timePointNow)
-            {
-                const auto timerWakeUpTime = getTimerWakeUpTime();
-                if (timePointNextAllowed - timePointNow < timerWakeUpTime)
-                    std::this_thread::sleep_for(timePointNextAllowed - timePointNow);
-                else
-                    std::this_thread::sleep_for(std::chrono::nanoseconds(timerWakeUpTime));
-
+            if (timePointNow < lastRenderTime + std::chrono::milliseconds(15))
                 continue;
-            }
 
             m_backendRenderTarget->clearScreen();
             draw();
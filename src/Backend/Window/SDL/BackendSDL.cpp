@@ -162,6 +162,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendSDL::wakeUpEventLoop()
+    {
+        // We use our own event type so that the event can't be mistaken for one of the user events
+        static const Uint32 wakeUpEventType = SDL_RegisterEvents(1);
+        if (wakeUpEventType == static_cast<Uint32>(-1))
+            return;
+
+        SDL_Event event;
+        SDL_zero(event);
+        event.type = wakeUpEventType;
+        SDL_PushEvent(&event);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendSDL::isKeyboardModifierPressed(Event::KeyModifier modifierKey)
     {
         const SDL_Keymod pressedModifiers = SDL_GetModState();
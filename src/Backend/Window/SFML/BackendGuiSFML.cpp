@@ -25,7 +25,8 @@
 #include <TGUI/Backend/Window/SFML/BackendGuiSFML.hpp>
 #include <TGUI/Backend/Window/SFML/BackendSFML.hpp>
 #include <TGUI/ToolTip.hpp>
-#include <TGUI/Timer.hpp>
+#include <TGUI/Signal.hpp>
+#include <TGUI/Components.hpp>
 #include <thread>
 
 #include <SFML/Graphics/RenderTexture.hpp>
@@ -175,15 +176,6 @@ namespace tgui
 
         m_backendRenderTarget->setClearColor(clearColor);
 
-        // Helper function that calculates the amount of time to sleep, which is 10ms unless a timer will expire before this time
-        const auto getTimerWakeUpTime = []{
-            Optional<Duration> duration = Timer::getNextScheduledTime();
-            if (duration && (*duration < std::chrono::milliseconds(10)))
-                return *duration;
-            else
-                return Duration{std::chrono::milliseconds(10)};
-        };
-
         setDrawingUpdatesTime(false);
 
         sf::Event event;
@@ -192,55 +184,73 @@ namespace tgui
         bool windowOpen = m_window->isOpen();
         while (m_window->isOpen()) // Don't just check windowOpen, user code can also call window.close()
         {
-            bool eventProcessed = false;
-            while (true)
+            // Find out how long we can wait before the gui has to be updated or drawn. While the screen is changing
+            // (e.g. during animations) we don't wake up before the next frame is allowed to be rendered.
+            Optional<Duration> timeout;
+            if (refreshRequired)
             {
-                while (m_window->pollEvent(event))
-                {
-                    if (handleEvent(event))
-                        eventProcessed = true;
-
-                    if (event.type == sf::Event::Closed)
-                    {
-                        // We don't call m_window->close() as it would destroy the OpenGL context, which will cause messages to be
-                        // printed in the terminal later when we try to destroy our backend renderer (which tries to clean up OpenGL resources).
-                        // The close function will be called by the window destructor.
-                        windowOpen = false;
-                        eventProcessed = true;
-                    }
-                    else if (event.type == sf::Event::Resized)
-                    {
-                        eventProcessed = true;
-                    }
-                }
+                const auto timePointNow = std::chrono::steady_clock::now();
+                const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
+                timeout = (timePointNextAllowed > timePointNow) ? Duration{timePointNextAllowed - timePointNow} : Duration{};
+            }
+            else
+                timeout = getTimeUntilNextUpdate();
 
-                if (updateTime())
+            // SFML can't wait for an event with a timeout and can't be woken up from another thread (waitEvent also polls
+            // every 10ms internally), so we keep polling for input. The gui itself is only updated when needed.
+            const auto timePointWakeUp = std::chrono::steady_clock::now() + std::chrono::nanoseconds(timeout ? *timeout : Duration{});
+            bool eventReceived = m_window->pollEvent(event);
+            while (!eventReceived && !Signal::hasPostedEmits() && !priv::dev::MessageBroker::hasPostedEvents())
+            {
+                const auto timePointNow = std::chrono::steady_clock::now();
+                if (timeout && (timePointNow >= timePointWakeUp))
                     break;
 
-                if (eventProcessed || refreshRequired)
-                    break;
+                if (timeout && (timePointWakeUp - timePointNow < std::chrono::milliseconds(10)))
+                    std::this_thread::sleep_for(timePointWakeUp - timePointNow);
+                else
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
 
-                std::this_thread::sleep_for(std::chrono::nanoseconds(getTimerWakeUpTime()));
+                eventReceived = m_window->pollEvent(event);
             }
 
+            // The clock is updated before handling the events, so that e.g. the double click timeout is correct after a long wait
+            if (updateTime())
+                refreshRequired = true;
+
+            while (eventReceived)
+            {
+                if (handleEvent(event))
+                    refreshRequired = true;
+
+                if (event.type == sf::Event::Closed)
+                {
+                    // We don't call m_window->close() as it would destroy the OpenGL context, which will cause messages to be
+                    // printed in the terminal later when we try to destroy our backend renderer (which tries to clean up OpenGL resources).
+                    // The close function will be called by the window destructor.
+                    windowOpen = false;
+                }
+                else if (event.type == sf::Event::Resized)
+                {
+                    refreshRequired = true;
+                }
+
+                eventReceived = m_window->pollEvent(event);
+            }
+
+            if (flushInputEvents())
+                refreshRequired = true;
+
             if (!windowOpen)
                 break;
 
-            refreshRequired = true;
+            if (!refreshRequired)
+                continue;
 
             // Don't try to render too often, even when the screen is changing (e.g. during animation)
             const auto timePointNow = std::chrono::steady_clock::now();
-            const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
-            if (timePointNextAllowed > timePointNow)
-            {
-                const auto timerWakeUpTime = getTimerWakeUpTime();
-                if (timePointNextAllowed - timePointNow < timerWakeUpTime)
-                    std::this_thread::sleep_for(timePointNextAllowed - timePointNow);
-                else
-                    std::this_thread::sleep_for(std::chrono::nanoseconds(timerWakeUpTime));
-
+            if (timePointNow < lastRenderTime + std::chrono::milliseconds(15))
                 continue;
-            }
 
             m_backendRenderTarget->clearScreen();
             draw();
@@ -25,6 +25,13 @@
 
 #include <TGUI/Components.hpp>
 #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
+#include <TGUI/Backend/Window/Backend.hpp>
+
+#include <initializer_list>
+#include <type_traits>
+#include <atomic>
+#include <limits>
+#include <mutex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -46,92 +53,355 @@ namespace dev
     template class StyleProperty<Outline>;
     template class StyleProperty<TextStyles>;
 
-    std::unordered_map<std::uint64_t, std::set<std::uint64_t>> MessageBroker::m_topicIdToCallbackIds;
-    std::unordered_map<std::uint64_t, std::uint64_t> MessageBroker::m_callbackIdToTopicId;
-    std::unordered_map<std::uint64_t, std::function<void()>> MessageBroker::m_listeners;
-    std::uint64_t MessageBroker::m_lastId = 0;
+    namespace
+    {
+        // Topic and callback ids store the index of their slot in the lowest 32 bits and the generation of the slot in the
+        // highest 32 bits. The generation changes each time a slot is freed, so that old ids don't refer to the new owner.
+        std::uint64_t makeHandle(std::uint32_t index, std::uint32_t generation)
+        {
+            return (static_cast<std::uint64_t>(generation) << 32) | index;
+        }
+
+        std::uint32_t getHandleIndex(std::uint64_t handle)
+        {
+            return static_cast<std::uint32_t>(handle & 0xFFFFFFFF);
+        }
+
+        std::uint32_t getHandleGeneration(std::uint64_t handle)
+        {
+            return static_cast<std::uint32_t>(handle >> 32);
+        }
+
+        std::uint32_t getNextGeneration(std::uint32_t generation)
+        {
+            // Generation 0 is skipped, which guarantees that a valid handle is never 0
+            return (generation == std::numeric_limits<std::uint32_t>::max()) ? 1 : generation + 1;
+        }
+
+        // Subscribers that unsubscribe are only marked as removed, as their function might be executing
+        constexpr std::uint32_t RemovedSubscriber = std::numeric_limits<std::uint32_t>::max();
+
+        struct Subscriber
+        {
+            std::function<void()> func;
+            std::uint32_t callbackIndex; // RemovedSubscriber when the subscriber no longer exists
+        };
+
+        struct Topic
+        {
+            std::vector<Subscriber> subscribers; // In the order in which they subscribed
+            std::vector<Subscriber> subscribedWhileSending; // Appended to the subscribers when the event has been sent
+            std::size_t unsubscribedCount = 0; // Number of removed entries in the subscribers list
+            unsigned int sendDepth = 0;
+            std::uint32_t generation = 1;
+            bool alive = false;
+        };
+
+        // Topics are accessed by index while sending, because a subscriber may create new topics and make the list grow.
+        // This requires the subscriber lists to be moved instead of copied when that happens.
+        static_assert(std::is_nothrow_move_constructible<Topic>::value, "Subscribers may not be copied when the topic list grows");
+
+        struct CallbackSlot
+        {
+            std::uint32_t topicIndex = 0;
+            std::uint32_t position = 0; // Index in the subscribers or in subscribedWhileSending of the topic
+            std::uint32_t generation = 1;
+            bool used = false;
+            bool subscribedWhileSending = false;
+        };
+
+        std::vector<Topic> topics;
+        std::vector<std::uint32_t> freeTopicIndices;
+
+        std::vector<CallbackSlot> callbackSlots;
+        std::vector<std::uint32_t> freeCallbackIndices;
+
+        // Events that were posted from any thread, waiting to be sent on the gui thread
+        std::mutex postedEventsMutex;
+        std::vector<std::uint64_t> postedEvents;
+        std::atomic<std::size_t> postedEventCount{0}; // Allows checking whether there are events without locking the mutex
+
+        TGUI_NODISCARD Topic* findTopic(std::uint64_t topicId)
+        {
+            const std::uint32_t index = getHandleIndex(topicId);
+            if ((index >= topics.size()) || !topics[index].alive || (topics[index].generation != getHandleGeneration(topicId)))
+                return nullptr;
+
+            return &topics[index];
+        }
+
+        void freeCallbackSlot(std::uint32_t callbackIndex)
+        {
+            CallbackSlot& slot = callbackSlots[callbackIndex];
+            slot.used = false;
+            slot.generation = getNextGeneration(slot.generation);
+            freeCallbackIndices.push_back(callbackIndex);
+        }
+
+        // Removes the subscribers that unsubscribed, while keeping the remaining ones in the same order
+        void compactSubscribers(Topic& topic)
+        {
+            auto& subscribers = topic.subscribers;
+            std::size_t newSize = 0;
+            for (std::size_t i = 0; i < subscribers.size(); ++i)
+            {
+                if (subscribers[i].callbackIndex == RemovedSubscriber)
+                    continue;
+
+                if (newSize != i)
+                    subscribers[newSize] = std::move(subscribers[i]);
+
+                callbackSlots[subscribers[newSize].callbackIndex].position = static_cast<std::uint32_t>(newSize);
+                ++newSize;
+            }
+
+            subscribers.erase(subscribers.begin() + static_cast<std::ptrdiff_t>(newSize), subscribers.end());
+            topic.unsubscribedCount = 0;
+        }
+
+        void releaseTopic(std::uint32_t topicIndex)
+        {
+            Topic& topic = topics[topicIndex];
+            std::vector<Subscriber>().swap(topic.subscribers);
+            std::vector<Subscriber>().swap(topic.subscribedWhileSending);
+            topic.unsubscribedCount = 0;
+            topic.generation = getNextGeneration(topic.generation);
+            freeTopicIndices.push_back(topicIndex);
+        }
+
+        // Applies the changes that were made while sending once the outermost sendEvent for the topic finishes
+        struct SendDepthGuard
+        {
+            explicit SendDepthGuard(std::uint32_t index) :
+                topicIndex{index}
+            {
+                ++topics[topicIndex].sendDepth;
+            }
+
+            ~SendDepthGuard()
+            {
+                Topic& topic = topics[topicIndex];
+                if (--topic.sendDepth > 0)
+                    return;
+
+                if (!topic.alive)
+                {
+                    releaseTopic(topicIndex);
+                    return;
+                }
+
+                for (auto& subscriber : topic.subscribedWhileSending)
+                {
+                    if (subscriber.callbackIndex == RemovedSubscriber)
+                        continue;
+
+                    CallbackSlot& slot = callbackSlots[subscriber.callbackIndex];
+                    slot.subscribedWhileSending = false;
+                    slot.position = static_cast<std::uint32_t>(topic.subscribers.size());
+                    topic.subscribers.push_back(std::move(subscriber));
+                }
+                topic.subscribedWhileSending.clear();
+
+                if (topic.unsubscribedCount > 0)
+                    compactSubscribers(topic);
+            }
+
+            SendDepthGuard(const SendDepthGuard&) = delete;
+            SendDepthGuard& operator=(const SendDepthGuard&) = delete;
+
+            std::uint32_t topicIndex;
+        };
+
+        bool sendEventImpl(std::uint64_t topicId)
+        {
+            const Topic* topic = findTopic(topicId);
+            if (!topic || topic->subscribers.empty())
+                return false;
+
+            // Subscribers that are added while sending are only called for the next event.
+            // The topic is looked up again after each call, as the callback could have caused the list of topics to grow.
+            const std::uint32_t topicIndex = getHandleIndex(topicId);
+            const std::size_t subscriberCount = topic->subscribers.size();
+            SendDepthGuard guard(topicIndex);
+            for (std::size_t i = 0; i < subscriberCount; ++i)
+            {
+                const Subscriber& subscriber = topics[topicIndex].subscribers[i];
+                if (subscriber.callbackIndex != RemovedSubscriber)
+                    subscriber.func();
+            }
+
+            return true;
+        }
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::uint64_t MessageBroker::createTopic()
     {
-        return ++m_lastId;
+        std::uint32_t topicIndex;
+        if (!freeTopicIndices.empty())
+        {
+            topicIndex = freeTopicIndices.back();
+            freeTopicIndices.pop_back();
+        }
+        else
+        {
+            topicIndex = static_cast<std::uint32_t>(topics.size());
+            topics.emplace_back();
+        }
+
+        Topic& topic = topics[topicIndex];
+        topic.alive = true;
+        return makeHandle(topicIndex, topic.generation);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void MessageBroker::destroyTopic(std::uint64_t topicId)
     {
-        auto it = m_topicIdToCallbackIds.find(topicId);
-
-        // If nobody subscribed to the topic then we don't have to destroy anything
-        if (it == m_topicIdToCallbackIds.end())
+        Topic* topic = findTopic(topicId);
+        if (!topic)
             return;
 
-        // Make a copy of the callback ids to prevent issues when unsubscribe removes the value from the set
-        const std::set<std::uint64_t> callbackIds = it->second;
-        for (const auto& callbackId : callbackIds)
-            unsubscribe(callbackId);
+        // Subscribers that still have a callback id for this topic can safely call unsubscribe later, the id will be ignored.
+        // When the topic is being sent, the subscribers are only destroyed once the callbacks have finished.
+        for (auto* subscribers : {&topic->subscribers, &topic->subscribedWhileSending})
+        {
+            for (auto& subscriber : *subscribers)
+            {
+                if (subscriber.callbackIndex == RemovedSubscriber)
+                    continue;
+
+                freeCallbackSlot(subscriber.callbackIndex);
+                subscriber.callbackIndex = RemovedSubscriber;
+            }
+        }
 
-        m_topicIdToCallbackIds.erase(it);
+        topic->alive = false;
+        if (topic->sendDepth == 0)
+            releaseTopic(getHandleIndex(topicId));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::uint64_t MessageBroker::subscribe(std::uint64_t topicId, std::function<void()> func)
     {
-        const std::uint64_t callbackId = ++m_lastId;
-        m_topicIdToCallbackIds[topicId].insert(callbackId);
-        m_callbackIdToTopicId[callbackId] = topicId;
-        m_listeners[callbackId] = std::move(func);
-        return callbackId;
+        Topic* topic = findTopic(topicId);
+        TGUI_ASSERT(topic, "MessageBroker::subscribe requires a topic that was created with createTopic");
+        if (!topic)
+            return 0;
+
+        std::uint32_t callbackIndex;
+        if (!freeCallbackIndices.empty())
+        {
+            callbackIndex = freeCallbackIndices.back();
+            freeCallbackIndices.pop_back();
+        }
+        else
+        {
+            callbackIndex = static_cast<std::uint32_t>(callbackSlots.size());
+            callbackSlots.emplace_back();
+        }
+
+        CallbackSlot& slot = callbackSlots[callbackIndex];
+        slot.topicIndex = getHandleIndex(topicId);
+        slot.used = true;
+
+        // The subscribers list can't grow while it is being iterated
+        slot.subscribedWhileSending = (topic->sendDepth > 0);
+        auto& subscribers = slot.subscribedWhileSending ? topic->subscribedWhileSending : topic->subscribers;
+        slot.position = static_cast<std::uint32_t>(subscribers.size());
+        subscribers.push_back({std::move(func), callbackIndex});
+
+        return makeHandle(callbackIndex, slot.generation);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void MessageBroker::unsubscribe(std::uint64_t callbackId)
     {
-        auto listenersIt = m_listeners.find(callbackId);
-        if (listenersIt == m_listeners.end())
-        {
-            // It is possible that the listener has already been unsubscribed if the topic was destroyed
-            // before the listener unsubscribes.
+        // It is possible that the callback id is no longer valid because the topic was destroyed before the listener unsubscribes
+        const std::uint32_t callbackIndex = getHandleIndex(callbackId);
+        if ((callbackIndex >= callbackSlots.size()) || !callbackSlots[callbackIndex].used
+         || (callbackSlots[callbackIndex].generation != getHandleGeneration(callbackId)))
             return;
+
+        const CallbackSlot& slot = callbackSlots[callbackIndex];
+        Topic& topic = topics[slot.topicIndex];
+        if (slot.subscribedWhileSending)
+            topic.subscribedWhileSending[slot.position].callbackIndex = RemovedSubscriber;
+        else
+        {
+            // The entry is marked instead of erased to keep the positions of the other subscribers unchanged.
+            // The list is compacted once it contains more removed entries than subscribers, which keeps the cost constant
+            // on average per unsubscribe.
+            Subscriber& subscriber = topic.subscribers[slot.position];
+            subscriber.callbackIndex = RemovedSubscriber;
+            ++topic.unsubscribedCount;
+            if (topic.sendDepth == 0)
+            {
+                subscriber.func = nullptr;
+                if (topic.unsubscribedCount * 2 > topic.subscribers.size())
+                    compactSubscribers(topic);
+            }
         }
 
-#if defined(__GNUC__)
-#   pragma GCC diagnostic push
-#   pragma GCC diagnostic ignored "-Wnull-dereference"  // Suppress warning for not checking the iterator in release mode
-#endif
-        // Find out to which topic this callback belongs
-        auto it = m_callbackIdToTopicId.find(callbackId);
-        TGUI_ASSERT(it != m_callbackIdToTopicId.end(), "MessageBroker::unsubscribe requires callback id to have matching topic");
-        const auto topicId = it->second;
-#if defined(__GNUC__)
-#   pragma GCC diagnostic pop
-#endif
+        freeCallbackSlot(callbackIndex);
+    }
 
-        // Remove the callback
-        m_listeners.erase(listenersIt);
-        m_callbackIdToTopicId.erase(it);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        TGUI_ASSERT(m_topicIdToCallbackIds.find(topicId) != m_topicIdToCallbackIds.end(), "Topic id needs to have matching callback in MessageBroker::unsubscribe");
-        m_topicIdToCallbackIds[topicId].erase(callbackId);
+    void MessageBroker::sendEvent(std::uint64_t topicId)
+    {
+        sendEventImpl(topicId);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MessageBroker::sendEvent(std::uint64_t topicId)
+    void MessageBroker::postEvent(std::uint64_t topicId)
     {
-        // If nobody subscribed to the topic then we don't need to send anything
-        auto it = m_topicIdToCallbackIds.find(topicId);
-        if (it == m_topicIdToCallbackIds.end())
-            return;
+        {
+            std::lock_guard<std::mutex> lock(postedEventsMutex);
+            postedEvents.push_back(topicId);
+            postedEventCount = postedEvents.size();
+        }
+
+        // The gui may be waiting for events, it has to wake up to dispatch the event
+        if (isBackendSet())
+            getBackend()->wakeUpEventLoop();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MessageBroker::dispatchPostedEvents()
+    {
+        if (postedEventCount == 0)
+            return false;
 
-        // Make a copy of the callback ids to prevent issues when an unsubscribe is called during a callback
-        const std::set<std::uint64_t> callbackIds = it->second;
-        for (const auto& callbackId : callbackIds)
-            m_listeners[callbackId]();
+        // Events that are posted by the subscribers are only sent the next time this function is called
+        std::vector<std::uint64_t> events;
+        {
+            std::lock_guard<std::mutex> lock(postedEventsMutex);
+            events.swap(postedEvents);
+            postedEventCount = 0;
+        }
+
+        // Topics that were destroyed after the event was posted are skipped by sendEventImpl
+        bool subscriberCalled = false;
+        for (const std::uint64_t topicId : events)
+        {
+            if (sendEventImpl(topicId))
+                subscriberCalled = true;
+        }
+
+        return subscriberCalled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MessageBroker::hasPostedEvents()
+    {
+        return postedEventCount != 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
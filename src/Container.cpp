@@ -32,6 +32,9 @@
 #include <TGUI/Filesystem.hpp>
 
 #include <fstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -155,10 +158,360 @@ namespace tgui
             for (const auto& childNode : node->children)
                 makePathsRelativeToForm(childNode, formPath);
         }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TGUI_NODISCARD bool isWidgetScaledOrRotated(const Widget& widget)
+        {
+            return (widget.getRotation() != 0) || (widget.getScale().x != 1) || (widget.getScale().y != 1);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the area of the parent in which the widget can be found or drawn. The widget may not be scaled or rotated.
+        // This is the union of its normal and full size, which may lie on the left or above its position.
+        TGUI_NODISCARD FloatRect getWidgetBoundsInParent(const Widget& widget)
+        {
+            const Vector2f size = widget.getSize();
+            const Vector2f pos = widget.getPosition() - Vector2f{widget.getOrigin().x * size.x, widget.getOrigin().y * size.y};
+            const Vector2f offset = widget.getWidgetOffset();
+            const Vector2f fullSize = widget.getFullSize();
+            const Vector2f topLeft{pos.x + std::min(0.f, offset.x), pos.y + std::min(0.f, offset.y)};
+            const Vector2f bottomRight{pos.x + std::max(size.x, offset.x + fullSize.x), pos.y + std::max(size.y, offset.y + fullSize.y)};
+            return {topLeft, bottomRight - topLeft};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Searches the widgets by name: first the direct children, then recursively and finally inside SubwidgetContainer widgets
+        Widget::Ptr searchWidgetByName(const std::vector<Widget::Ptr>& widgets, const String& widgetName)
+        {
+            for (const auto& child : widgets)
+            {
+                if (child->getWidgetName() == widgetName)
+                    return child;
+            }
+
+            for (const auto& child : widgets)
+            {
+                if (child->isContainer())
+                {
+                    Widget::Ptr widget = searchWidgetByName(std::static_pointer_cast<Container>(child)->getWidgets(), widgetName);
+                    if (widget != nullptr)
+                        return widget;
+                }
+            }
+
+            for (const auto& child : widgets)
+            {
+                auto subWidgetContainer = dynamic_cast<const SubwidgetContainer*>(child.get());
+                if (subWidgetContainer)
+                {
+                    Widget::Ptr widget = subWidgetContainer->getContainer()->get(widgetName);
+                    if (widget != nullptr)
+                        return widget;
+                }
+            }
+
+            return nullptr;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    struct Container::SpatialIndex
+    {
+        // Widgets that would be stored in more cells than this are checked for every query instead
+        static constexpr int MaxCellsPerWidget = 256;
+
+        struct Entry
+        {
+            int left = 0;   // Range of cells in which the widget is stored
+            int top = 0;
+            int right = -1;
+            int bottom = -1;
+            bool alwaysChecked = false;
+            std::size_t order = 0; // Cached index of the widget in m_widgets
+        };
+
+        explicit SpatialIndex(float size) :
+            cellSize{size}
+        {
+        }
+
+        TGUI_NODISCARD static std::uint64_t getCellKey(int x, int y)
+        {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+        }
+
+        TGUI_NODISCARD int getCellCoordinate(float pos) const
+        {
+            const float cell = std::floor(pos / cellSize);
+            if (cell < -1073741824.f)
+                return -1073741824;
+            else if (cell > 1073741824.f)
+                return 1073741824;
+            else
+                return static_cast<int>(cell);
+        }
+
+        void removeFromCells(const Widget* widget, const Entry& entry)
+        {
+            if (entry.alwaysChecked)
+            {
+                alwaysCheckedWidgets.erase(std::find(alwaysCheckedWidgets.begin(), alwaysCheckedWidgets.end(), widget));
+                return;
+            }
+
+            for (int y = entry.top; y <= entry.bottom; ++y)
+            {
+                for (int x = entry.left; x <= entry.right; ++x)
+                {
+                    const auto cellIt = cells.find(getCellKey(x, y));
+                    if (cellIt == cells.end())
+                        continue;
+
+                    auto& cellWidgets = cellIt->second;
+                    const auto it = std::find(cellWidgets.begin(), cellWidgets.end(), widget);
+                    if (it != cellWidgets.end())
+                    {
+                        *it = cellWidgets.back();
+                        cellWidgets.pop_back();
+                    }
+
+                    if (cellWidgets.empty())
+                        cells.erase(cellIt);
+                }
+            }
+        }
+
+        void removeWidget(Widget* widget)
+        {
+            pendingWidgets.erase(widget);
+
+            const auto it = entries.find(widget);
+            if (it == entries.end())
+                return;
+
+            removeFromCells(widget, it->second);
+            entries.erase(it);
+        }
+
+        void clear()
+        {
+            cells.clear();
+            entries.clear();
+            alwaysCheckedWidgets.clear();
+            pendingWidgets.clear();
+        }
+
+        // Moves the widgets of which the bounds changed to the cells that they overlap with
+        void update()
+        {
+            for (auto* widget : pendingWidgets)
+            {
+                auto it = entries.find(widget);
+                if (it == entries.end())
+                    it = entries.emplace(widget, Entry{}).first;
+                else
+                    removeFromCells(widget, it->second);
+
+                Entry& entry = it->second;
+                entry.alwaysChecked = isWidgetScaledOrRotated(*widget);
+                if (!entry.alwaysChecked)
+                {
+                    const FloatRect bounds = getWidgetBoundsInParent(*widget);
+                    entry.left = getCellCoordinate(bounds.left);
+                    entry.top = getCellCoordinate(bounds.top);
+                    entry.right = getCellCoordinate(bounds.left + bounds.width);
+                    entry.bottom = getCellCoordinate(bounds.top + bounds.height);
+
+                    const auto cellCount = static_cast<std::int64_t>(entry.right - entry.left + 1) * (entry.bottom - entry.top + 1);
+                    if (cellCount > MaxCellsPerWidget)
+                        entry.alwaysChecked = true;
+                }
+
+                if (entry.alwaysChecked)
+                {
+                    alwaysCheckedWidgets.push_back(widget);
+                    continue;
+                }
+
+                for (int y = entry.top; y <= entry.bottom; ++y)
+                {
+                    for (int x = entry.left; x <= entry.right; ++x)
+                        cells[getCellKey(x, y)].push_back(widget);
+                }
+            }
+
+            pendingWidgets.clear();
+        }
+
+        // Finds the widgets that might be located at the given position, together with their cached index in m_widgets.
+        // The result is not sorted.
+        void query(Vector2f pos, std::vector<std::pair<std::size_t, Widget*>>& result) const
+        {
+            result.clear();
+            const auto addCandidates = [this,&result](const std::vector<Widget*>& widgets){
+                for (auto* widget : widgets)
+                    result.emplace_back(entries.find(widget)->second.order, widget);
+            };
+
+            addCandidates(alwaysCheckedWidgets);
+
+            const auto cellIt = cells.find(getCellKey(getCellCoordinate(pos.x), getCellCoordinate(pos.y)));
+            if (cellIt != cells.end())
+                addCandidates(cellIt->second);
+        }
+
+        // Finds the widgets that might overlap with the given rectangle. The result is not sorted and can contain duplicates.
+        void query(const FloatRect& rect, std::vector<std::pair<std::size_t, Widget*>>& result) const
+        {
+            result.clear();
+            for (auto* widget : alwaysCheckedWidgets)
+                result.emplace_back(entries.find(widget)->second.order, widget);
+
+            const int left = getCellCoordinate(rect.left);
+            const int top = getCellCoordinate(rect.top);
+            const int right = getCellCoordinate(rect.left + rect.width);
+            const int bottom = getCellCoordinate(rect.top + rect.height);
+            const auto addCell = [this,&result](const std::vector<Widget*>& cellWidgets){
+                for (auto* widget : cellWidgets)
+                    result.emplace_back(entries.find(widget)->second.order, widget);
+            };
+
+            // Look up each cell in the rectangle, unless there are less cells in the grid than in the rectangle
+            const auto cellCount = static_cast<std::int64_t>(right - left + 1) * (bottom - top + 1);
+            if (cellCount <= static_cast<std::int64_t>(cells.size()))
+            {
+                for (int y = top; y <= bottom; ++y)
+                {
+                    for (int x = left; x <= right; ++x)
+                    {
+                        const auto cellIt = cells.find(getCellKey(x, y));
+                        if (cellIt != cells.end())
+                            addCell(cellIt->second);
+                    }
+                }
+            }
+            else
+            {
+                for (const auto& cell : cells)
+                {
+                    const int x = static_cast<int>(static_cast<std::uint32_t>(cell.first >> 32));
+                    const int y = static_cast<int>(static_cast<std::uint32_t>(cell.first));
+                    if ((x >= left) && (x <= right) && (y >= top) && (y <= bottom))
+                        addCell(cell.second);
+                }
+            }
+        }
+
+        // Sorts the candidates from back to front and removes duplicates. The cached index of each candidate in the
+        // list of widgets is only updated when it turns out to be outdated.
+        void sortCandidates(const std::vector<Widget::Ptr>& widgets)
+        {
+            const auto isOrderValid = [&widgets](const std::pair<std::size_t, Widget*>& candidate){
+                return (candidate.first < widgets.size()) && (widgets[candidate.first].get() == candidate.second);
+            };
+            if (!std::all_of(candidates.begin(), candidates.end(), isOrderValid))
+            {
+                for (std::size_t i = 0; i < widgets.size(); ++i)
+                {
+                    const auto it = entries.find(widgets[i].get());
+                    if (it != entries.end())
+                        it->second.order = i;
+                }
+
+                for (auto& candidate : candidates)
+                    candidate.first = entries[candidate.second].order;
+
+                // Widgets that are no longer part of the container are dropped from the index
+                const auto invalidIt = std::partition(candidates.begin(), candidates.end(), isOrderValid);
+                for (auto it = invalidIt; it != candidates.end(); ++it)
+                {
+                    if (entries.find(it->second) != entries.end())
+                        removeWidget(it->second);
+                }
+                candidates.erase(invalidIt, candidates.end());
+            }
+
+            std::sort(candidates.begin(), candidates.end());
+            candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+        }
+
+        float cellSize;
+        std::unordered_map<std::uint64_t, std::vector<Widget*>> cells;
+        std::unordered_map<const Widget*, Entry> entries;
+        std::vector<Widget*> alwaysCheckedWidgets;
+        std::unordered_set<Widget*> pendingWidgets;
+        std::vector<std::pair<std::size_t, Widget*>> candidates;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Container::NameIndex
+    {
+        struct StringHash
+        {
+            TGUI_NODISCARD std::size_t operator()(const String& str) const
+            {
+                return std::hash<std::u32string>{}(str.toUtf32());
+            }
+        };
+
+        // Adds the widget and all widgets inside it to the index
+        void addTree(Widget* widget)
+        {
+            if (!widget->getWidgetName().empty())
+                widgets.emplace(widget->getWidgetName(), widget);
+
+            if (widget->isContainer())
+            {
+                for (const auto& child : static_cast<Container*>(widget)->getWidgets())
+                    addTree(child.get());
+            }
+            else if (dynamic_cast<const SubwidgetContainer*>(widget))
+                ++subwidgetContainerCount;
+        }
+
+        // Removes the widget and all widgets inside it from the index
+        void removeTree(Widget* widget)
+        {
+            removeName(widget->getWidgetName(), widget);
+
+            if (widget->isContainer())
+            {
+                for (const auto& child : static_cast<Container*>(widget)->getWidgets())
+                    removeTree(child.get());
+            }
+            else if (dynamic_cast<const SubwidgetContainer*>(widget))
+                --subwidgetContainerCount;
+        }
+
+        void removeName(const String& name, const Widget* widget)
+        {
+            if (name.empty())
+                return;
+
+            const auto range = widgets.equal_range(name);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (it->second == widget)
+                {
+                    widgets.erase(it);
+                    return;
+                }
+            }
+        }
+
+        std::unordered_multimap<String, Widget*, StringHash> widgets;
+
+        // Widgets inside a SubwidgetContainer aren't part of the index, so the slow search is used when these exist
+        std::size_t subwidgetContainerCount = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Container::Container(const char* typeName, bool initRenderer) :
         Widget{typeName, initRenderer}
     {
@@ -179,6 +532,9 @@ namespace tgui
 
         for (const auto& widget : m_widgets)
             widgetAdded(widget);
+
+        if (other.m_spatialIndex)
+            setSpatialIndexEnabled(true, other.m_spatialIndex->cellSize);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -189,7 +545,8 @@ namespace tgui
         m_widgetBelowMouse        {std::move(other.m_widgetBelowMouse)},
         m_widgetWithLeftMouseDown {std::move(other.m_widgetWithLeftMouseDown)},
         m_widgetWithRightMouseDown{std::move(other.m_widgetWithRightMouseDown)},
-        m_focusedWidget           {std::move(other.m_focusedWidget)}
+        m_focusedWidget           {std::move(other.m_focusedWidget)},
+        m_spatialIndex            {std::move(other.m_spatialIndex)}
     {
         // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
         // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
@@ -199,6 +556,8 @@ namespace tgui
 
         for (auto& widget : m_widgets)
             widget->setParent(this);
+
+        other.m_nameIndex = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -219,6 +578,9 @@ namespace tgui
         // Make sure it is not the same widget
         if (this != &right)
         {
+            // This container is detached from its parent, which can't be tracked by the name index of the root container
+            invalidateRootNameIndex();
+
             Widget::operator=(right);
 
             m_widgetBelowMouse = nullptr;
@@ -238,6 +600,11 @@ namespace tgui
 
             for (auto& widget : m_widgets)
                 widgetAdded(widget);
+
+            if (right.m_spatialIndex)
+                setSpatialIndexEnabled(true, right.m_spatialIndex->cellSize);
+            else
+                m_spatialIndex = nullptr;
         }
 
         return *this;
@@ -250,11 +617,15 @@ namespace tgui
         // Make sure it is not the same widget
         if (this != &right)
         {
+            invalidateRootNameIndex();
+            right.invalidateRootNameIndex();
+
             m_widgets                  = std::move(right.m_widgets);
             m_widgetBelowMouse         = std::move(right.m_widgetBelowMouse);
             m_widgetWithLeftMouseDown  = std::move(right.m_widgetWithLeftMouseDown);
             m_widgetWithRightMouseDown = std::move(right.m_widgetWithRightMouseDown);
             m_focusedWidget            = std::move(right.m_focusedWidget);
+            m_spatialIndex             = std::move(right.m_spatialIndex);
             Widget::operator=(std::move(right));
 
             // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
@@ -274,6 +645,7 @@ namespace tgui
 
     void Container::setSize(const Layout2d& size)
     {
+        const Vector2f oldInnerSize = m_prevInnerSize;
         if (size.getValue() != m_prevSize)
         {
             Widget::setSize(size);
@@ -285,10 +657,16 @@ namespace tgui
             if (getInnerSize() != m_prevInnerSize)
             {
                 m_prevInnerSize = getInnerSize();
-                for (auto& layout : m_boundSizeLayouts)
-                    layout->recalculateValue();
+                recalculateBoundSizeLayouts();
             }
         }
+
+        // Some children cover the entire inner area of the container (e.g. the placeholder that closes an open menu)
+        if (m_spatialIndex && (m_prevInnerSize != oldInnerSize))
+        {
+            for (const auto& widget : m_widgets)
+                m_spatialIndex->pendingWidgets.insert(widget.get());
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -297,6 +675,7 @@ namespace tgui
     {
         TGUI_ASSERT(widgetPtr != nullptr, "Can't add nullptr to container");
 
+        widgetPtr->m_indexInParent = m_widgets.size();
         m_widgets.push_back(widgetPtr);
         if (!widgetName.empty())
             widgetPtr->setWidgetName(widgetName);
@@ -308,49 +687,57 @@ namespace tgui
 
     Widget::Ptr Container::get(const String& widgetName) const
     {
-        // First search for direct children
-        for (const auto& child : m_widgets)
-        {
-            if (child->getWidgetName() == widgetName)
-                return child;
-        }
+        if (widgetName.empty())
+            return searchWidgetByName(m_widgets, widgetName);
+
+        const Container* root = this;
+        while (root->m_parent)
+            root = root->m_parent;
 
-        // If no widget was found then search recursively
-        for (const auto& child : m_widgets)
+        if (!root->m_nameIndex)
         {
-            if (child->isContainer())
-            {
-                Widget::Ptr widget = std::static_pointer_cast<Container>(child)->get(widgetName);
-                if (widget != nullptr)
-                    return widget;
-            }
+            root->m_nameIndex = std::make_unique<NameIndex>();
+            for (const auto& child : root->m_widgets)
+                root->m_nameIndex->addTree(child.get());
         }
 
-        // If we still couldn't find it then check if there are any SubwidgetContainer widgets and search their subwidgets
-        for (const auto& child : m_widgets)
+        // The index contains all widgets in the tree, only the ones that are located inside this container are relevant.
+        // The search order only matters when multiple widgets have the same name, in which case we fall back to a normal
+        // search to find the same widget as before. The normal search is also needed when SubwidgetContainer widgets exist.
+        if (root->m_nameIndex->subwidgetContainerCount == 0)
         {
-            auto subWidgetContainer = dynamic_cast<const SubwidgetContainer*>(child.get());
-            if (subWidgetContainer)
+            Widget* foundWidget = nullptr;
+            unsigned int matches = 0;
+            const auto range = root->m_nameIndex->widgets.equal_range(widgetName);
+            for (auto it = range.first; it != range.second; ++it)
             {
-                Widget::Ptr widget = subWidgetContainer->getContainer()->get(widgetName);
-                if (widget != nullptr)
-                    return widget;
+                const Container* parent = it->second->getParent();
+                while (parent && (parent != this))
+                    parent = parent->getParent();
+
+                if (parent)
+                {
+                    foundWidget = it->second;
+                    ++matches;
+                }
             }
+
+            if (matches == 0)
+                return nullptr;
+            else if (matches == 1)
+                return foundWidget->shared_from_this();
         }
 
-        return nullptr;
+        return searchWidgetByName(m_widgets, widgetName);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Container::remove(const Widget::Ptr& widget)
     {
-        // Loop through every widget
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        const std::size_t i = findWidgetIndex(widget.get());
+        if (i < m_widgets.size())
         {
-            if (m_widgets[i] != widget)
-                continue;
-
             if (widget == m_widgetBelowMouse && m_parentGui && (widget->getMouseCursor() != m_mouseCursor))
                 m_parentGui->requestMouseCursor(m_mouseCursor);
 
@@ -367,9 +754,16 @@ namespace tgui
                 widget->setFocused(false);
             }
 
+            if (m_spatialIndex)
+                m_spatialIndex->removeWidget(widget.get());
+
+            if (NameIndex* nameIndex = getRootNameIndex())
+                nameIndex->removeTree(widget.get());
+
             // Remove the widget
             widget->setParent(nullptr);
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i));
+            updateWidgetIndices(i, m_widgets.size());
             return true;
         }
 
@@ -383,11 +777,20 @@ namespace tgui
         if (m_mouseHover && m_parentGui && (m_mouseCursor != Cursor::Type::Arrow))
             m_parentGui->requestMouseCursor(m_mouseCursor);
 
+        NameIndex* nameIndex = getRootNameIndex();
         for (const auto& widget : m_widgets)
+        {
+            if (nameIndex)
+                nameIndex->removeTree(widget.get());
+
             widget->setParent(nullptr);
+        }
 
         m_widgets.clear();
 
+        if (m_spatialIndex)
+            m_spatialIndex->clear();
+
         m_widgetBelowMouse = nullptr;
         m_widgetWithLeftMouseDown = nullptr;
         m_widgetWithRightMouseDown = nullptr;
@@ -590,81 +993,58 @@ namespace tgui
 
     void Container::moveWidgetToFront(const Widget::Ptr& widget)
     {
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            if (m_widgets[i] != widget)
-                continue;
-
-            // Copy the widget
-            m_widgets.push_back(m_widgets[i]);
+        const std::size_t index = findWidgetIndex(widget.get());
+        if (index >= m_widgets.size())
+            return;
 
-            // Remove the old widget
-            m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i));
-            break;
-        }
+        std::rotate(m_widgets.begin() + static_cast<std::ptrdiff_t>(index), m_widgets.begin() + static_cast<std::ptrdiff_t>(index + 1), m_widgets.end());
+        updateWidgetIndices(index, m_widgets.size());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::moveWidgetToBack(const Widget::Ptr& widget)
     {
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            if (m_widgets[i] != widget)
-                continue;
-
-            // Copy the widget
-            const Widget::Ptr obj = m_widgets[i];
-            m_widgets.insert(m_widgets.begin(), obj);
+        const std::size_t index = findWidgetIndex(widget.get());
+        if (index >= m_widgets.size())
+            return;
 
-            // Remove the old widget
-            m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i + 1));
-            break;
-        }
+        std::rotate(m_widgets.begin(), m_widgets.begin() + static_cast<std::ptrdiff_t>(index), m_widgets.begin() + static_cast<std::ptrdiff_t>(index + 1));
+        updateWidgetIndices(0, index + 1);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::size_t Container::moveWidgetForward(const Widget::Ptr& widget)
     {
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            if (m_widgets[i] != widget)
-                continue;
-
-            // If the widget is already at the front then we can't move it further forward
-            if (i == m_widgets.size() - 1)
-                return m_widgets.size() - 1;
+        const std::size_t index = findWidgetIndex(widget.get());
+        if (index >= m_widgets.size())
+            return m_widgets.size(); // The widget wasn't found in this container
 
-            std::swap(m_widgets[i], m_widgets[i+1]);
-            return i + 1;
-        }
+        // If the widget is already at the front then we can't move it further forward
+        if (index == m_widgets.size() - 1)
+            return m_widgets.size() - 1;
 
-        // The widget wasn't found in this container
-        return m_widgets.size();
+        std::swap(m_widgets[index], m_widgets[index+1]);
+        updateWidgetIndices(index, index + 2);
+        return index + 1;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::size_t Container::moveWidgetBackward(const Widget::Ptr& widget)
     {
-        for (std::size_t i = m_widgets.size(); i > 0; --i)
-        {
-            if (m_widgets[i-1] != widget)
-                continue;
-
-            // If the widget is already at the back then we can't move it further backward
-            if (i-1 == 0)
-                return 0;
+        const std::size_t index = findWidgetIndex(widget.get());
+        if (index >= m_widgets.size())
+            return m_widgets.size(); // The widget wasn't found in this container
 
-            std::swap(m_widgets[i-2], m_widgets[i-1]);
-            return i-2;
-        }
+        // If the widget is already at the back then we can't move it further backward
+        if (index == 0)
+            return 0;
 
-        // The widget wasn't found in this container
-        return m_widgets.size();
+        std::swap(m_widgets[index-1], m_widgets[index]);
+        updateWidgetIndices(index - 1, index + 1);
+        return index - 1;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -674,16 +1054,7 @@ namespace tgui
         if (index >= m_widgets.size())
             return false;
 
-        std::size_t currentWidgetIndex = m_widgets.size();
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            if (m_widgets[i] == widget)
-            {
-                currentWidgetIndex = i;
-                break;
-            }
-        }
-
+        const std::size_t currentWidgetIndex = findWidgetIndex(widget.get());
         if (currentWidgetIndex == m_widgets.size())
             return false;
 
@@ -691,8 +1062,19 @@ namespace tgui
             return true;
 
         // Move the widget to the new index
-        m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(currentWidgetIndex));
-        m_widgets.insert(m_widgets.begin() + static_cast<std::ptrdiff_t>(index), widget);
+        const auto currentIt = m_widgets.begin() + static_cast<std::ptrdiff_t>(currentWidgetIndex);
+        const auto newIt = m_widgets.begin() + static_cast<std::ptrdiff_t>(index);
+        if (index > currentWidgetIndex)
+        {
+            std::rotate(currentIt, currentIt + 1, newIt + 1);
+            updateWidgetIndices(currentWidgetIndex, index + 1);
+        }
+        else
+        {
+            std::rotate(newIt, currentIt, currentIt + 1);
+            updateWidgetIndices(index, currentWidgetIndex + 1);
+        }
+
         return true;
     }
 
@@ -700,13 +1082,11 @@ namespace tgui
 
     int Container::getWidgetIndex(const Widget::Ptr& widget) const
     {
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            if (m_widgets[i] == widget)
-                return static_cast<int>(i);
-        }
-
-        return -1;
+        const std::size_t index = findWidgetIndex(widget.get());
+        if (index < m_widgets.size())
+            return static_cast<int>(index);
+        else
+            return -1;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -738,31 +1118,94 @@ namespace tgui
     {
         pos -= getPosition() + getChildWidgetsOffset();
 
-        for (auto it = m_widgets.crbegin(); it != m_widgets.crend(); ++it)
+        // Look for a visible widget below the mouse
+        Widget::Ptr widget = getWidgetBelowMouse(pos);
+        if (!widget)
+            return nullptr;
+
+        // If the widget is a container then look inside it
+        if (widget->isContainer())
         {
-            const auto& widget = *it;
+            Container::Ptr container = std::static_pointer_cast<Container>(widget);
+            auto childWidget = container->getWidgetAtPosition(transformMousePos(widget, pos));
+            if (childWidget)
+                return childWidget;
+        }
 
-            // Look for a visible widget below the mouse
-            if (!widget->isVisible())
-                continue;
-            if (!widget->isMouseOnWidget(transformMousePos(widget, pos)))
-                continue;
+        // If the widget isn't a container, or there were no child widgets inside it, then return this widget
+        return widget;
+    }
 
-            // If the widget is a container then look inside it
-            if (widget->isContainer())
-            {
-                Container::Ptr container = std::static_pointer_cast<Container>(widget);
-                auto childWidget = container->getWidgetAtPosition(transformMousePos(widget, pos));
-                if (childWidget)
-                    return childWidget;
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // If the widget isn't a container, or there were no child widgets inside it, then return this widget
-            return widget;
+    void Container::setSpatialIndexEnabled(bool enabled, float cellSize)
+    {
+        if (!enabled)
+        {
+            m_spatialIndex = nullptr;
+            return;
         }
 
-        // No visible widgets were found at the queried position
-        return nullptr;
+        TGUI_ASSERT(cellSize > 0, "Cell size of spatial index must be positive");
+        if (m_spatialIndex && (m_spatialIndex->cellSize == cellSize))
+            return;
+
+        m_spatialIndex = std::make_unique<SpatialIndex>(cellSize);
+        for (const auto& widget : m_widgets)
+            m_spatialIndex->pendingWidgets.insert(widget.get());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isSpatialIndexEnabled() const
+    {
+        return m_spatialIndex != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::beginUpdate()
+    {
+        ++m_updateDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::endUpdate()
+    {
+        TGUI_ASSERT(m_updateDepth > 0, "Container::endUpdate called without matching beginUpdate");
+        if (m_updateDepth == 0)
+            return;
+
+        --m_updateDepth;
+        if ((m_updateDepth == 0) && m_widgetsUpdatePending)
+        {
+            m_widgetsUpdatePending = false;
+            updateWidgets();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isUpdating() const
+    {
+        return m_updateDepth > 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateWidgets()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::requestWidgetsUpdate()
+    {
+        if (m_updateDepth > 0)
+            m_widgetsUpdatePending = true;
+        else
+            updateWidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -861,6 +1304,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::childWidgetBoundsChanged(Widget* child)
+    {
+        if (m_spatialIndex)
+            m_spatialIndex->pendingWidgets.insert(child);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::childWidgetFocused(const Widget::Ptr& child)
     {
         if (m_focusedWidget != child)
@@ -1001,10 +1452,7 @@ namespace tgui
                 return toolTip;
         }
 
-        if (m_toolTip)
-            return getToolTip();
-
-        return nullptr;
+        return getToolTip();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1013,18 +1461,24 @@ namespace tgui
     {
         Widget::rendererChanged(property);
 
-        if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        switch (RendererPropertyRegistry::findId(property))
         {
-            for (const auto& widget : m_widgets)
-                widget->setInheritedOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            for (const auto& widget : m_widgets)
-            {
-                if (m_fontCached != Font::getGlobalFont())
-                    widget->setInheritedFont(m_fontCached);
-            }
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                for (const auto& widget : m_widgets)
+                    widget->setInheritedOpacity(m_opacityCached);
+                break;
+
+            case RendererProperty::Font:
+                for (const auto& widget : m_widgets)
+                {
+                    if (m_fontCached != Font::getGlobalFont())
+                        widget->setInheritedFont(m_fontCached);
+                }
+                break;
+
+            default:
+                break;
         }
     }
 
@@ -1232,7 +1686,20 @@ namespace tgui
 
     bool Container::updateTime(Duration elapsedTime)
     {
-        bool screenRefreshRequired = Widget::updateTime(elapsedTime);
+        // Play the animations of all child widgets at once.
+        // The callbacks of finished animations could remove the last reference to this container.
+        bool screenRefreshRequired = false;
+        Widget::Ptr keepAlive;
+        if (m_animations && !m_animations->empty())
+        {
+            keepAlive = shared_from_this();
+            screenRefreshRequired = m_animations->update(elapsedTime, this);
+        }
+
+        if (m_animations)
+            m_animations->setBatchUpdateActive(true);
+
+        screenRefreshRequired |= Widget::updateTime(elapsedTime);
 
         // Loop through all widgets
         for (auto& widget : m_widgets)
@@ -1242,13 +1709,47 @@ namespace tgui
                 screenRefreshRequired |= widget->updateTime(elapsedTime);
         }
 
+        if (m_animations)
+            m_animations->setBatchUpdateActive(false);
+
         return screenRefreshRequired;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> Container::getTimeUntilNextUpdate() const
+    {
+        // Animations have to be updated every frame, except for the paused animations of invisible children
+        if (m_animations && m_animations->hasPlayingAnimations(this))
+            return Duration{};
+
+        Optional<Duration> timeUntilNextUpdate;
+        for (const auto& widget : m_widgets)
+        {
+            if (!widget->isVisible())
+                continue;
+
+            const Optional<Duration> widgetTime = widget->getTimeUntilNextUpdate();
+            if (widgetTime && (!timeUntilNextUpdate || (*widgetTime < *timeUntilNextUpdate)))
+            {
+                if (*widgetTime == Duration{})
+                    return widgetTime;
+
+                timeUntilNextUpdate = widgetTime;
+            }
+        }
+
+        return timeUntilNextUpdate;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::setParent(Container* parent)
     {
+        // Only the root container keeps track of the widget names, the parent will add our widgets to its own index
+        if (parent)
+            m_nameIndex = nullptr;
+
         const BackendGui* oldParentGui = m_parentGui;
 
         Widget::setParent(parent);
@@ -1276,6 +1777,25 @@ namespace tgui
 
     Widget::Ptr Container::getWidgetBelowMouse(Vector2f mousePos) const
     {
+        if (m_spatialIndex)
+        {
+            m_spatialIndex->update();
+
+            m_spatialIndex->query(mousePos, m_spatialIndex->candidates);
+            m_spatialIndex->sortCandidates(m_widgets);
+
+            // Check the candidates from front to back, like the widgets would be checked without the index
+            const auto& candidates = m_spatialIndex->candidates;
+            for (auto it = candidates.crbegin(); it != candidates.crend(); ++it)
+            {
+                const auto& widget = m_widgets[it->first];
+                if (widget->isVisible() && widget->isMouseOnWidget(transformMousePos(widget, mousePos)))
+                    return widget;
+            }
+
+            return nullptr;
+        }
+
         for (auto it = m_widgets.crbegin(); it != m_widgets.crend(); ++it)
         {
             const auto& widget = *it;
@@ -1311,10 +1831,29 @@ namespace tgui
 
     void Container::draw(BackendRenderTarget& target, RenderStates states) const
     {
-        for (const auto& widget : m_widgets)
+        // Find which part of the container is visible, so that child widgets outside of it can be skipped without having
+        // to compose their transform. This is only done when the container isn't rotated. A margin is added to the rectangle
+        // because the position of the widget gets rounded when it is drawn.
+        const std::array<float, 6>& matrix = states.transform.getAffineMatrix();
+        const bool cullChildren = (matrix[1] == 0) && (matrix[2] == 0) && (matrix[0] != 0) && (matrix[3] != 0);
+        FloatRect visibleRect;
+        if (cullChildren)
         {
+            visibleRect = states.transform.getInverse().transformRect(target.getClipRect());
+            visibleRect = {visibleRect.left - 1, visibleRect.top - 1, visibleRect.width + 2, visibleRect.height + 2};
+        }
+
+        const auto drawChild = [&](const Widget::Ptr& widget){
             if (!widget->isVisible())
-                continue;
+                return;
+
+            if (cullChildren && !isWidgetScaledOrRotated(*widget))
+            {
+                const FloatRect bounds = getWidgetBoundsInParent(*widget);
+                if ((bounds.left > visibleRect.left + visibleRect.width) || (bounds.top > visibleRect.top + visibleRect.height)
+                 || (bounds.left + bounds.width < visibleRect.left) || (bounds.top + bounds.height < visibleRect.top))
+                    return;
+            }
 
             const Vector2f origin{widget->getOrigin().x * widget->getSize().x, widget->getOrigin().y * widget->getSize().y};
 
@@ -1332,6 +1871,22 @@ namespace tgui
             }
 
             target.drawWidget(widgetStates, widget);
+        };
+
+        // When there is a spatial index, only the children in the grid cells that overlap with the visible area are checked
+        if (cullChildren && m_spatialIndex)
+        {
+            m_spatialIndex->update();
+            m_spatialIndex->query(visibleRect, m_spatialIndex->candidates);
+            m_spatialIndex->sortCandidates(m_widgets);
+
+            for (const auto& candidate : m_spatialIndex->candidates)
+                drawChild(m_widgets[candidate.first]);
+        }
+        else
+        {
+            for (const auto& widget : m_widgets)
+                drawChild(widget);
         }
     }
 
@@ -1431,6 +1986,78 @@ namespace tgui
 
         if (m_textSizeCached != 0)
             widgetPtr->setTextSize(m_textSizeCached);
+
+        if (m_spatialIndex)
+            m_spatialIndex->pendingWidgets.insert(widgetPtr.get());
+
+        if (NameIndex* nameIndex = getRootNameIndex())
+            nameIndex->addTree(widgetPtr.get());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Container::findWidgetIndex(const Widget* widget) const
+    {
+        if (!widget)
+            return m_widgets.size();
+
+        const std::size_t cachedIndex = widget->m_indexInParent;
+        if ((cachedIndex < m_widgets.size()) && (m_widgets[cachedIndex].get() == widget))
+            return cachedIndex;
+
+        // The widget isn't a child or m_widgets was changed directly, so refresh the indices of all widgets
+        std::size_t index = m_widgets.size();
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            m_widgets[i]->m_indexInParent = i;
+            if (m_widgets[i].get() == widget)
+                index = i;
+        }
+
+        return index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateWidgetIndices(std::size_t first, std::size_t last)
+    {
+        for (std::size_t i = first; i < last; ++i)
+            m_widgets[i]->m_indexInParent = i;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Container::NameIndex* Container::getRootNameIndex() const
+    {
+        const Container* root = this;
+        while (root->m_parent)
+            root = root->m_parent;
+
+        return root->m_nameIndex.get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidateRootNameIndex()
+    {
+        Container* root = this;
+        while (root->m_parent)
+            root = root->m_parent;
+
+        root->m_nameIndex = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::widgetNameChanged(Widget* widget, const String& oldName)
+    {
+        NameIndex* nameIndex = getRootNameIndex();
+        if (!nameIndex)
+            return;
+
+        nameIndex->removeName(oldName, widget);
+        if (!widget->getWidgetName().empty())
+            nameIndex->widgets.emplace(widget->getWidgetName(), widget);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1529,8 +2156,7 @@ namespace tgui
 
         m_size = size;
         onSizeChange.emit(this, size.getValue());
-        for (auto& layout : m_boundSizeLayouts)
-            layout->recalculateValue();
+        recalculateBoundSizeLayouts();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -126,6 +126,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> CustomWidgetForBindings::getTimeUntilNextUpdate() const
+    {
+        if (implGetTimeUntilNextUpdate)
+            return implGetTimeUntilNextUpdate();
+
+        // We don't know when the update function needs to be called, so keep calling it regularly
+        return Duration{std::chrono::milliseconds(10)};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool CustomWidgetForBindings::isMouseOnWidget(Vector2f pos) const
     {
         return implMouseOnWidget(pos);
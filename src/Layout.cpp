@@ -302,34 +302,8 @@ namespace tgui
             "Layout constructor with bound widget must be called with an operation that involves the widget"
         );
 
-        // TODO: Try to resolve the code duplicate with recalculateValue()
-        if (m_operation == Operation::BindingPosX)
-            m_value = m_boundWidget->getPosition().x;
-        else if (m_operation == Operation::BindingPosY)
-            m_value = m_boundWidget->getPosition().y;
-        else if (m_operation == Operation::BindingLeft)
-            m_value = m_boundWidget->getPosition().x - (m_boundWidget->getOrigin().x * m_boundWidget->getSize().x);
-        else if (m_operation == Operation::BindingTop)
-            m_value = m_boundWidget->getPosition().y - (m_boundWidget->getOrigin().y * m_boundWidget->getSize().y);
-        else if (m_operation == Operation::BindingWidth)
-            m_value = m_boundWidget->getSize().x;
-        else if (m_operation == Operation::BindingHeight)
-            m_value = m_boundWidget->getSize().y;
-        else if (m_operation == Operation::BindingInnerWidth)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().x;
-        }
-        else if (m_operation == Operation::BindingInnerHeight)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().y;
-        }
-
         resetPointers();
-        recalculateValue();
+        m_value = calculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -343,7 +317,7 @@ namespace tgui
         TGUI_ASSERT(m_rightOperand != nullptr, "Right operand in layout constructor can't be a nullptr");
 
         resetPointers();
-        recalculateValue();
+        m_value = calculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -356,7 +330,10 @@ namespace tgui
         m_rightOperand   {other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr},
         m_boundWidget    {other.m_boundWidget},
         m_boundString    {other.m_boundString},
-        m_connectedWidgetCallback{nullptr}
+        m_connectedWidgetCallback{nullptr},
+        m_connectedWidget{nullptr},
+        m_program        {nullptr},
+        m_updatePending  {false}
     {
         // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
         if (!m_boundString.empty())
@@ -375,7 +352,10 @@ namespace tgui
         m_rightOperand   {std::move(other.m_rightOperand)},
         m_boundWidget    {other.m_boundWidget},
         m_boundString    {std::move(other.m_boundString)},
-        m_connectedWidgetCallback{std::move(other.m_connectedWidgetCallback)}
+        m_connectedWidgetCallback{std::move(other.m_connectedWidgetCallback)},
+        m_connectedWidget{other.m_connectedWidget},
+        m_program        {nullptr},
+        m_updatePending  {other.m_updatePending}
     {
         resetPointers();
     }
@@ -396,6 +376,9 @@ namespace tgui
             m_boundWidget     = other.m_boundWidget;
             m_boundString     = other.m_boundString;
             m_connectedWidgetCallback = nullptr;
+            m_connectedWidget = nullptr;
+            m_program         = nullptr;
+            m_updatePending   = false;
 
             // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
             if (!m_boundString.empty())
@@ -423,6 +406,9 @@ namespace tgui
             m_boundWidget     = other.m_boundWidget;
             m_boundString     = std::move(other.m_boundString);
             m_connectedWidgetCallback = std::move(other.m_connectedWidgetCallback);
+            m_connectedWidget = other.m_connectedWidget;
+            m_program         = nullptr;
+            m_updatePending   = other.m_updatePending;
 
             resetPointers();
         }
@@ -448,7 +434,10 @@ namespace tgui
 
         // Inform the parent that the value of the layout has changed
         if (m_parent)
+        {
+            invalidateProgram();
             m_parent->recalculateValue();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -587,6 +576,10 @@ namespace tgui
 
             m_leftOperand->m_parent = this;
             m_rightOperand->m_parent = this;
+
+            // Only the topmost layout has a program
+            m_leftOperand->m_program = nullptr;
+            m_rightOperand->m_program = nullptr;
         }
 
         if (m_boundWidget)
@@ -613,11 +606,18 @@ namespace tgui
 
         // No callbacks must be made while parsing, a single callback will be made when done if needed
         m_connectedWidgetCallback = nullptr;
+        m_updatePending = false;
 
-        parseBindingStringRecursive(widget, xAxis);
+        // Only compile the layout again when a string now refers to a different widget or property
+        if (parseBindingStringRecursive(widget, xAxis))
+        {
+            invalidateProgram();
+            recalculateValue();
+        }
 
         // Restore the callback function
         m_connectedWidgetCallback = std::move(valueChangedCallbackHandler);
+        m_connectedWidget = m_connectedWidgetCallback ? widget : nullptr;
 
         if (m_value != oldValue)
         {
@@ -640,6 +640,7 @@ namespace tgui
             m_operation = Operation::Value;
         }
 
+        invalidateProgram();
         recalculateValue();
     }
 
@@ -647,82 +648,285 @@ namespace tgui
 
     void Layout::recalculateValue()
     {
+        // Only the topmost layout is recalculated. Evaluating its program also updates the values of all its operands.
+        if (m_parent)
+        {
+            getRootLayout()->recalculateValue();
+            return;
+        }
+
+        if ((m_operation == Operation::Value) || (m_operation == Operation::BindingString))
+            return;
+
         const float oldValue = m_value;
+        m_value = evaluateProgram();
+        if (m_value != oldValue)
+        {
+            // The topmost layout must tell the connected widget about the new value.
+            // If the gui defers layout updates then the widget is only informed when the gui flushes the layout.
+            if (m_connectedWidgetCallback)
+            {
+                BackendGui* gui = m_connectedWidget ? m_connectedWidget->getParentGui() : nullptr;
+                if (gui && gui->getLayoutUpdatesDeferred())
+                {
+                    m_updatePending = true;
+                    gui->scheduleLayoutUpdate(m_connectedWidget);
+                }
+                else
+                    m_connectedWidgetCallback();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::recalculateLayouts(const std::unordered_set<Layout*>& layouts)
+    {
+        if (layouts.empty())
+            return;
+
+        if (layouts.size() == 1)
+        {
+            (*layouts.begin())->recalculateValue();
+            return;
+        }
+
+        // The topmost layouts are collected before updating them to prevent issues with the set being changed during the loop
+        // if some layout gets copied in a called setSize or setPosition function.
+        std::vector<Layout*> rootLayouts;
+        rootLayouts.reserve(layouts.size());
+        for (auto* layout : layouts)
+        {
+            Layout* rootLayout = layout->getRootLayout();
+            if (!rootLayout->m_recalculationQueued)
+            {
+                rootLayout->m_recalculationQueued = true;
+                rootLayouts.push_back(rootLayout);
+            }
+        }
+
+        for (auto* rootLayout : rootLayouts)
+            rootLayout->m_recalculationQueued = false;
+
+        for (auto* rootLayout : rootLayouts)
+            rootLayout->recalculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout* Layout::getRootLayout()
+    {
+        Layout* layout = this;
+        while (layout->m_parent)
+            layout = layout->m_parent;
+
+        return layout;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float Layout::calculateValue() const
+    {
         switch (m_operation)
         {
             case Operation::Value:
-                break;
+                return m_value;
             case Operation::Plus:
-                m_value = m_leftOperand->getValue() + m_rightOperand->getValue();
-                break;
+                return m_leftOperand->m_value + m_rightOperand->m_value;
             case Operation::Minus:
-                m_value = m_leftOperand->getValue() - m_rightOperand->getValue();
-                break;
+                return m_leftOperand->m_value - m_rightOperand->m_value;
             case Operation::Multiplies:
-                m_value = m_leftOperand->getValue() * m_rightOperand->getValue();
-                break;
+                return m_leftOperand->m_value * m_rightOperand->m_value;
             case Operation::Divides:
-                if (m_rightOperand->getValue() != 0)
-                    m_value = m_leftOperand->getValue() / m_rightOperand->getValue();
+                if (m_rightOperand->m_value != 0)
+                    return m_leftOperand->m_value / m_rightOperand->m_value;
                 else
-                    m_value = 0;
-                break;
+                    return 0;
             case Operation::Minimum:
-                m_value = std::min(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
+                return std::min(m_leftOperand->m_value, m_rightOperand->m_value);
             case Operation::Maximum:
-                m_value = std::max(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
+                return std::max(m_leftOperand->m_value, m_rightOperand->m_value);
             case Operation::BindingPosX:
-                m_value = m_boundWidget->getPosition().x;
-                break;
+                return m_boundWidget->getPosition().x;
             case Operation::BindingPosY:
-                m_value = m_boundWidget->getPosition().y;
-                break;
+                return m_boundWidget->getPosition().y;
             case Operation::BindingLeft:
-                m_value = m_boundWidget->getPosition().x - (m_boundWidget->getOrigin().x * m_boundWidget->getSize().x);
-                break;
+                return m_boundWidget->getPosition().x - (m_boundWidget->getOrigin().x * m_boundWidget->getSize().x);
             case Operation::BindingTop:
-                m_value = m_boundWidget->getPosition().y - (m_boundWidget->getOrigin().y * m_boundWidget->getSize().y);
-                break;
+                return m_boundWidget->getPosition().y - (m_boundWidget->getOrigin().y * m_boundWidget->getSize().y);
             case Operation::BindingWidth:
-                m_value = m_boundWidget->getSize().x;
-                break;
+                return m_boundWidget->getSize().x;
             case Operation::BindingHeight:
-                m_value = m_boundWidget->getSize().y;
-                break;
+                return m_boundWidget->getSize().y;
             case Operation::BindingInnerWidth:
             {
                 const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().x;
-                break;
+                return boundContainer ? boundContainer->getInnerSize().x : m_value;
             }
             case Operation::BindingInnerHeight:
             {
                 const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().y;
-                break;
+                return boundContainer ? boundContainer->getInnerSize().y : m_value;
             }
             case Operation::BindingString:
                 // The string should have already been parsed by now.
                 // Passing here either means something is wrong with the string or the layout was not connected to a widget with a parent yet.
-                break;
+                return m_value;
         };
 
-        if (m_value != oldValue)
+        TGUI_ASSERT(false, "All layout operations should have been handled");
+        return m_value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::invalidateProgram()
+    {
+        Layout* root = getRootLayout();
+        if (root->m_program)
+            root->m_program->instructions.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::compileInstructions(std::vector<Instruction>& instructions)
+    {
+        if (m_leftOperand)
         {
-            if (m_parent)
-                m_parent->recalculateValue();
-            else
+            m_leftOperand->compileInstructions(instructions);
+            m_rightOperand->compileInstructions(instructions);
+        }
+
+        // The topmost layout stores the result itself and constants don't need to be updated.
+        // Bindings that are waiting for their string to be parsed and inner size bindings to widgets that aren't
+        // containers keep their value, so they are constants as well.
+        Instruction instruction{m_operation, m_value, m_boundWidget, m_parent ? this : nullptr};
+        const bool isConstant = (m_operation == Operation::Value) || (m_operation == Operation::BindingString);
+        const bool isBinding = !isConstant && !m_leftOperand;
+        if (isConstant || (isBinding && !m_boundWidget)
+         || (((m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight))
+             && !dynamic_cast<const Container*>(m_boundWidget)))
+        {
+            instruction.operation = Operation::Value;
+            instruction.node = nullptr;
+        }
+
+        instructions.push_back(instruction);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float Layout::evaluateProgram()
+    {
+        if (!m_program)
+            m_program = std::make_unique<Program>();
+
+        if (m_program->instructions.empty())
+        {
+            compileInstructions(m_program->instructions);
+
+            // Each instruction adds at most one value to the stack
+            m_program->stack.resize(m_program->instructions.size());
+        }
+
+        float* const stack = m_program->stack.data();
+        std::size_t stackSize = 0;
+        for (const auto& instruction : m_program->instructions)
+        {
+            float value = instruction.value;
+            switch (instruction.operation)
             {
-                // The topmost layout must tell the connected widget about the new value
-                if (m_connectedWidgetCallback)
-                    m_connectedWidgetCallback();
+                case Operation::Value:
+                case Operation::BindingString:
+                    break;
+                case Operation::Plus:
+                    value = stack[stackSize - 2] + stack[stackSize - 1];
+                    stackSize -= 2;
+                    break;
+                case Operation::Minus:
+                    value = stack[stackSize - 2] - stack[stackSize - 1];
+                    stackSize -= 2;
+                    break;
+                case Operation::Multiplies:
+                    value = stack[stackSize - 2] * stack[stackSize - 1];
+                    stackSize -= 2;
+                    break;
+                case Operation::Divides:
+                    value = (stack[stackSize - 1] != 0) ? (stack[stackSize - 2] / stack[stackSize - 1]) : 0;
+                    stackSize -= 2;
+                    break;
+                case Operation::Minimum:
+                    value = std::min(stack[stackSize - 2], stack[stackSize - 1]);
+                    stackSize -= 2;
+                    break;
+                case Operation::Maximum:
+                    value = std::max(stack[stackSize - 2], stack[stackSize - 1]);
+                    stackSize -= 2;
+                    break;
+                case Operation::BindingPosX:
+                    value = instruction.widget->getPosition().x;
+                    break;
+                case Operation::BindingPosY:
+                    value = instruction.widget->getPosition().y;
+                    break;
+                case Operation::BindingLeft:
+                    value = instruction.widget->getPosition().x - (instruction.widget->getOrigin().x * instruction.widget->getSize().x);
+                    break;
+                case Operation::BindingTop:
+                    value = instruction.widget->getPosition().y - (instruction.widget->getOrigin().y * instruction.widget->getSize().y);
+                    break;
+                case Operation::BindingWidth:
+                    value = instruction.widget->getSize().x;
+                    break;
+                case Operation::BindingHeight:
+                    value = instruction.widget->getSize().y;
+                    break;
+                case Operation::BindingInnerWidth: // The widget was verified to be a container while compiling
+                    value = static_cast<const Container*>(instruction.widget)->getInnerSize().x;
+                    break;
+                case Operation::BindingInnerHeight:
+                    value = static_cast<const Container*>(instruction.widget)->getInnerSize().y;
+                    break;
             }
+
+            if (instruction.node)
+                instruction.node->m_value = value;
+
+            stack[stackSize++] = value;
         }
+
+        TGUI_ASSERT(stackSize == 1, "Evaluating a layout program should leave a single value on the stack");
+        return stack[0];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget* Layout::getConnectedWidget() const
+    {
+        const Layout* layout = this;
+        while (layout->m_parent)
+            layout = layout->m_parent;
+
+        return layout->m_connectedWidget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Layout::isUpdatePending() const
+    {
+        return m_updatePending;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::applyPendingUpdate()
+    {
+        if (!m_updatePending)
+            return;
+
+        m_updatePending = false;
+        if (m_connectedWidgetCallback)
+            m_connectedWidgetCallback();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -741,19 +945,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingStringRecursive(Widget* widget, bool xAxis)
+    bool Layout::parseBindingStringRecursive(Widget* widget, bool xAxis)
     {
+        bool bindingChanged = false;
         if (m_leftOperand)
         {
             TGUI_ASSERT(m_rightOperand != nullptr, "If a left operand exists then there should also be a right operand");
 
-            m_leftOperand->parseBindingStringRecursive(widget, xAxis);
-            m_rightOperand->parseBindingStringRecursive(widget, xAxis);
+            bindingChanged = m_leftOperand->parseBindingStringRecursive(widget, xAxis);
+            bindingChanged = m_rightOperand->parseBindingStringRecursive(widget, xAxis) || bindingChanged;
         }
 
         // Parse the string binding even when the referred widget was already found. The widget may be added to a different parent
         if (!m_boundString.empty())
+        {
+            const Operation oldOperation = m_operation;
+            const Widget* oldBoundWidget = m_boundWidget;
             parseBindingString(m_boundString, widget, xAxis);
+
+            // The program only has to be compiled again when the layout now refers to something else
+            if ((m_operation != oldOperation) || (m_boundWidget != oldBoundWidget))
+                bindingChanged = true;
+        }
+
+        return bindingChanged;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -870,7 +1085,6 @@ namespace tgui
         }
 
         resetPointers();
-        recalculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Loading/ImageLoader.hpp>
+#include <TGUI/PixelKernels.hpp>
 #include <TGUI/Global.hpp>
 
 #if defined(__GNUC__)
@@ -87,6 +88,37 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // stb_image can't decode at a reduced scale, so the image is downscaled in-place right after decoding it.
+        // Every step halves the image by averaging 2x2 pixels, which is cheap and doesn't cause aliasing artifacts.
+        TGUI_NODISCARD Vector2u downscaleImage(std::uint8_t* pixels, Vector2u size, Vector2u maximumSize)
+        {
+            while ((maximumSize.x > 0) && (maximumSize.y > 0) && (size.x / 2 >= maximumSize.x) && (size.y / 2 >= maximumSize.y))
+            {
+                const Vector2u newSize{size.x / 2, size.y / 2};
+                for (unsigned int y = 0; y < newSize.y; ++y)
+                {
+                    const std::uint8_t* srcRow1 = &pixels[4 * static_cast<std::size_t>(2 * y) * size.x];
+                    const std::uint8_t* srcRow2 = srcRow1 + (4 * static_cast<std::size_t>(size.x));
+                    std::uint8_t* dstRow = &pixels[4 * static_cast<std::size_t>(y) * newSize.x];
+                    for (unsigned int x = 0; x < newSize.x; ++x)
+                    {
+                        for (unsigned int c = 0; c < 4; ++c)
+                        {
+                            const auto sum = static_cast<unsigned int>(srcRow1[8*x + c] + srcRow1[8*x + 4 + c] + srcRow2[8*x + c] + srcRow2[8*x + 4 + c]);
+                            dstRow[4*x + c] = static_cast<std::uint8_t>((sum + 2) / 4);
+                        }
+                    }
+                }
+
+                size = newSize;
+            }
+
+            return size;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::unique_ptr<std::uint8_t[]> ImageLoader::loadFromFile(const String& filename, Vector2u& imageSize)
@@ -102,27 +134,70 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::unique_ptr<std::uint8_t[]> ImageLoader::loadFromMemory(const std::uint8_t* data, std::size_t dataSize, Vector2u& imageSize)
+    {
+        return loadFromMemory(data, dataSize, {0, 0}, imageSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<std::uint8_t[]> ImageLoader::loadFromFile(const String& filename, Vector2u maximumSize, Vector2u& imageSize)
+    {
+        std::size_t fileSize;
+        auto fileContents = readFileToMemory(filename, fileSize);
+        if (!fileContents)
+            return nullptr;
+
+        return loadFromMemory(fileContents.get(), fileSize, maximumSize, imageSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<std::uint8_t[]> ImageLoader::loadFromMemory(const std::uint8_t* data, std::size_t dataSize, Vector2u maximumSize, Vector2u& imageSize)
     {
         std::unique_ptr<std::uint8_t[]> pixelData = nullptr;
 
+        // Images without alpha channel (e.g. all jpg files) are decoded as RGB and converted to RGBA by our own vectorized
+        // code, which is faster than letting stb_image add the alpha channel.
         int imgWidth;
         int imgHeight;
         int imgChannels;
-        stbi_uc* buffer = stbi_load_from_memory(static_cast<const stbi_uc*>(data), static_cast<int>(dataSize), &imgWidth, &imgHeight, &imgChannels, 4);
+        const int decodedChannels = (stbi_info_from_memory(static_cast<const stbi_uc*>(data), static_cast<int>(dataSize), &imgWidth, &imgHeight, &imgChannels) && (imgChannels == 3)) ? 3 : 4;
+
+        stbi_uc* buffer = stbi_load_from_memory(static_cast<const stbi_uc*>(data), static_cast<int>(dataSize), &imgWidth, &imgHeight, &imgChannels, decodedChannels);
         if (!buffer)
             return pixelData;
 
         if ((imgWidth > 0) && (imgHeight > 0))
         {
-            const std::size_t pixelDataSize = 4 * static_cast<std::size_t>(imgWidth) * static_cast<std::size_t>(imgHeight);
-            pixelData = MakeUniqueForOverwrite<std::uint8_t[]>(pixelDataSize);
-            std::memcpy(pixelData.get(), buffer, pixelDataSize);
-
-            imageSize.x = static_cast<unsigned int>(imgWidth);
-            imageSize.y = static_cast<unsigned int>(imgHeight);
+            const Vector2u decodedSize{static_cast<unsigned int>(imgWidth), static_cast<unsigned int>(imgHeight)};
+
+            std::unique_ptr<std::uint8_t[]> convertedPixels;
+            std::uint8_t* pixels = buffer;
+            if (decodedChannels == 3)
+            {
+                convertedPixels = MakeUniqueForOverwrite<std::uint8_t[]>(4 * static_cast<std::size_t>(decodedSize.x) * decodedSize.y);
+                PixelKernels::convertRgbToRgba(buffer, convertedPixels.get(), static_cast<std::size_t>(decodedSize.x) * decodedSize.y);
+                pixels = convertedPixels.get();
+
+                stbi_image_free(buffer);
+                buffer = nullptr;
+            }
+
+            imageSize = downscaleImage(pixels, decodedSize, maximumSize);
+
+            if (convertedPixels && (imageSize == decodedSize))
+                pixelData = std::move(convertedPixels);
+            else
+            {
+                const std::size_t pixelDataSize = 4 * static_cast<std::size_t>(imageSize.x) * static_cast<std::size_t>(imageSize.y);
+                pixelData = MakeUniqueForOverwrite<std::uint8_t[]>(pixelDataSize);
+                std::memcpy(pixelData.get(), pixels, pixelDataSize);
+            }
         }
 
-        stbi_image_free(buffer);
+        if (buffer)
+            stbi_image_free(buffer);
+
         return pixelData;
     }
 
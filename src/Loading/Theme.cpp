@@ -25,6 +25,7 @@
 
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/RendererProperties.hpp>
 #include <TGUI/Widget.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -148,6 +149,7 @@ namespace tgui
                                                          {"BorderBelowTitleBar", 1.f},
                                                          {"PaddingBetweenButtons", 1.f},
                                                          {"ShowTextOnTitleButtons", true}})},
+                    {"FlexLayout", RendererData::create()},
                     {"Group", RendererData::create()},
                     {"HorizontalLayout", RendererData::create()},
                     {"HorizontalWrap", RendererData::create()},
@@ -526,7 +528,7 @@ namespace tgui
         // Load the global properties
         const auto& globalProperties = m_themeLoader->getGlobalProperties(m_primary);
         for (const auto& property : globalProperties)
-            m_globalProperties[property.first] = ObjectConverter(property.second);
+            m_globalProperties[property.first] = resolveValue(property.first, property.second);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -545,6 +547,7 @@ namespace tgui
     Theme::Theme(const Theme& other) :
         m_renderers       {},
         m_globalProperties{other.m_globalProperties},
+        m_resolvedValues  {other.m_resolvedValues},
         m_primary         {other.m_primary}
     {
         for (const auto& pair : other.m_renderers)
@@ -562,6 +565,7 @@ namespace tgui
     Theme::Theme(Theme&& other) noexcept :
         m_renderers       {std::move(other.m_renderers)},
         m_globalProperties{std::move(other.m_globalProperties)},
+        m_resolvedValues  {std::move(other.m_resolvedValues)},
         m_primary         {std::move(other.m_primary)}
     {
         for (const auto& pair : m_renderers)
@@ -578,6 +582,7 @@ namespace tgui
 
             std::swap(m_renderers,        temp.m_renderers);
             std::swap(m_globalProperties, temp.m_globalProperties);
+            std::swap(m_resolvedValues,   temp.m_resolvedValues);
             std::swap(m_primary,          temp.m_primary);
 
             for (const auto& pair : m_renderers)
@@ -595,6 +600,7 @@ namespace tgui
         {
             m_renderers = std::move(other.m_renderers);
             m_globalProperties = std::move(other.m_globalProperties);
+            m_resolvedValues = std::move(other.m_resolvedValues);
             m_primary = std::move(other.m_primary);
 
             for (const auto& pair : m_renderers)
@@ -620,9 +626,10 @@ namespace tgui
 
         // Load the new global properties
         m_globalProperties.clear();
+        m_resolvedValues.clear();
         const auto& globalProperties = m_themeLoader->getGlobalProperties(m_primary);
         for (const auto& property : globalProperties)
-            m_globalProperties[property.first] = ObjectConverter(property.second);
+            m_globalProperties[property.first] = resolveValue(property.first, property.second);
 
         // Update the existing widgets that were using renderers from this theme
         for (auto& pair : m_renderers)
@@ -631,14 +638,10 @@ namespace tgui
                 continue;
 
             auto& renderer = pair.second;
-            const auto& properties = m_themeLoader->load(m_primary, pair.first);
             auto observers = std::move(renderer->observers);
 
-            renderer = RendererData::create();
+            renderer = createRenderer(m_themeLoader->load(m_primary, pair.first));
             renderer->observers = std::move(observers);
-            renderer->connectedTheme = this;
-            for (const auto& property : properties)
-                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
 
             for (auto& observer : renderer->observers)
                 observer->setRenderer(renderer);
@@ -654,13 +657,9 @@ namespace tgui
         if (it != m_renderers.end())
             return it->second;
 
-        m_renderers[id] = RendererData::create();
-        m_renderers[id]->connectedTheme = this;
-        auto& properties = m_themeLoader->load(m_primary, id);
-        for (const auto& property : properties)
-            m_renderers[id]->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
-        return m_renderers[id];
+        auto renderer = createRenderer(m_themeLoader->load(m_primary, id));
+        m_renderers[id] = renderer;
+        return renderer;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -675,14 +674,9 @@ namespace tgui
         if (!m_themeLoader->canLoad(m_primary, id))
             return nullptr;
 
-        m_renderers[id] = RendererData::create();
-        m_renderers[id]->connectedTheme = this;
-
-        const auto& properties = m_themeLoader->load(m_primary, id);
-        for (const auto& property : properties)
-            m_renderers[id]->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
-        return m_renderers[id];
+        auto renderer = createRenderer(m_themeLoader->load(m_primary, id));
+        m_renderers[id] = renderer;
+        return renderer;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -826,6 +820,74 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter Theme::resolveValue(const String& property, const String& value)
+    {
+        // Nested renderers aren't shared, otherwise changing e.g. the scrollbar of one widget type would affect other widgets.
+        // Values of properties that weren't registered with a type are left for the renderer getters to deserialize.
+        const ObjectConverter::Type type = RendererPropertyRegistry::getType(RendererPropertyRegistry::findId(property));
+        if ((type == ObjectConverter::Type::None) || (type == ObjectConverter::Type::String) || (type == ObjectConverter::Type::RendererData))
+            return ObjectConverter{value};
+
+        auto key = std::make_pair(type, value);
+        const auto it = m_resolvedValues.find(key);
+        if (it != m_resolvedValues.end())
+            return it->second;
+
+        // Deserialize the value in the same way as the getter in the renderer would do it
+        ObjectConverter converter{value};
+        try
+        {
+            switch (type)
+            {
+                case ObjectConverter::Type::Bool:
+                    (void)converter.getBool();
+                    break;
+                case ObjectConverter::Type::Font:
+                    (void)converter.getFont();
+                    break;
+                case ObjectConverter::Type::Color:
+                    (void)converter.getColor();
+                    break;
+                case ObjectConverter::Type::Number:
+                    (void)converter.getNumber();
+                    break;
+                case ObjectConverter::Type::Outline:
+                    (void)converter.getOutline();
+                    break;
+                case ObjectConverter::Type::Texture:
+                    (void)converter.getTexture();
+                    break;
+                case ObjectConverter::Type::TextStyle:
+                    (void)converter.getTextStyle();
+                    break;
+                default:
+                    break;
+            }
+        }
+        catch (const Exception&)
+        {
+            // Keep the serialized value, the error will be reported when a widget tries to use the property
+            converter = ObjectConverter{value};
+        }
+
+        m_resolvedValues.emplace(std::move(key), converter);
+        return converter;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<RendererData> Theme::createRenderer(const std::map<String, String>& properties)
+    {
+        auto renderer = RendererData::create();
+        renderer->connectedTheme = this;
+        for (const auto& property : properties)
+            renderer->propertyValuePairs[property.first] = resolveValue(property.first, property.second);
+
+        return renderer;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
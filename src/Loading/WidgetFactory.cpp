@@ -67,6 +67,7 @@ namespace tgui
         {"ComboBox", std::make_shared<ComboBox>},
         {"EditBox", std::make_shared<EditBox>},
         {"FileDialog", std::make_shared<FileDialog>},
+        {"FlexLayout", std::make_shared<FlexLayout>},
         {"Grid", std::make_shared<Grid>},
         {"Group", std::make_shared<Group>},
         {"HorizontalLayout", std::make_shared<HorizontalLayout>},
@@ -0,0 +1,295 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/PixelKernels.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define TGUI_PIXEL_KERNELS_SSE2 1
+    #include <immintrin.h>
+
+    // AVX2 functions are compiled for every x86 CPU and are only called after checking that the CPU supports them
+    #if defined(__GNUC__) || defined(__clang__)
+        #define TGUI_PIXEL_KERNELS_TARGET_AVX2 __attribute__((target("avx2")))
+    #else
+        #define TGUI_PIXEL_KERNELS_TARGET_AVX2
+        #include <intrin.h>
+    #endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+    #define TGUI_PIXEL_KERNELS_NEON 1
+    #include <arm_neon.h>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        TGUI_NODISCARD unsigned int countBits(std::uint32_t value)
+        {
+            value = value - ((value >> 1) & 0x55555555u);
+            value = (value & 0x33333333u) + ((value >> 2) & 0x33333333u);
+            return (((value + (value >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void convertRgbToRgbaScalar(const std::uint8_t* rgbPixels, std::uint8_t* rgbaPixels, std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                rgbaPixels[4*i + 0] = rgbPixels[3*i + 0];
+                rgbaPixels[4*i + 1] = rgbPixels[3*i + 1];
+                rgbaPixels[4*i + 2] = rgbPixels[3*i + 2];
+                rgbaPixels[4*i + 3] = 255;
+            }
+        }
+
+        // The begin index has to be a multiple of 8 so that the first pixel is stored in the first bit of a byte
+        std::size_t extractTransparencyMaskScalar(const std::uint8_t* pixels, std::size_t begin, std::size_t end, std::uint8_t* mask)
+        {
+            for (std::size_t byteIndex = begin / 8; byteIndex < (end + 7) / 8; ++byteIndex)
+                mask[byteIndex] = 0;
+
+            std::size_t transparentPixelCount = 0;
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                if (pixels[4*i + 3] == 0)
+                {
+                    mask[i / 8] |= static_cast<std::uint8_t>(1 << (i % 8));
+                    ++transparentPixelCount;
+                }
+            }
+
+            return transparentPixelCount;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if TGUI_PIXEL_KERNELS_SSE2
+        TGUI_NODISCARD bool isAvx2Supported()
+        {
+    #if defined(__GNUC__) || defined(__clang__)
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") != 0;
+    #else
+            int cpuInfo[4];
+            __cpuid(cpuInfo, 0);
+            if (cpuInfo[0] < 7)
+                return false;
+
+            // The OS also has to save the AVX registers when switching threads
+            __cpuid(cpuInfo, 1);
+            const bool osUsesXSave = ((cpuInfo[2] & (1 << 27)) != 0);
+            const bool cpuHasAvx = ((cpuInfo[2] & (1 << 28)) != 0);
+            if (!osUsesXSave || !cpuHasAvx || ((_xgetbv(0) & 6) != 6))
+                return false;
+
+            __cpuidex(cpuInfo, 7, 0);
+            return ((cpuInfo[1] & (1 << 5)) != 0);
+    #endif
+        }
+
+        TGUI_NODISCARD bool useAvx2()
+        {
+            static const bool supported = isAvx2Supported();
+            return supported;
+        }
+
+        TGUI_NODISCARD __m128i load128(const std::uint8_t* ptr)
+        {
+            return _mm_loadu_si128(static_cast<const __m128i*>(static_cast<const void*>(ptr)));
+        }
+
+        std::size_t extractTransparencyMaskSSE2(const std::uint8_t* pixels, std::size_t pixelCount, std::uint8_t* mask, std::size_t& transparentPixelCount)
+        {
+            const __m128i zero = _mm_setzero_si128();
+
+            std::size_t i = 0;
+            for (; i + 16 <= pixelCount; i += 16)
+            {
+                // Move the alpha channels of 16 pixels into a single register and compare all of them with 0
+                const __m128i alpha1 = _mm_srli_epi32(load128(pixels + 4*i), 24);
+                const __m128i alpha2 = _mm_srli_epi32(load128(pixels + 4*i + 16), 24);
+                const __m128i alpha3 = _mm_srli_epi32(load128(pixels + 4*i + 32), 24);
+                const __m128i alpha4 = _mm_srli_epi32(load128(pixels + 4*i + 48), 24);
+                const __m128i alpha = _mm_packus_epi16(_mm_packs_epi32(alpha1, alpha2), _mm_packs_epi32(alpha3, alpha4));
+                const auto bits = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(alpha, zero)));
+
+                mask[i / 8] = static_cast<std::uint8_t>(bits & 0xFF);
+                mask[i / 8 + 1] = static_cast<std::uint8_t>(bits >> 8);
+                transparentPixelCount += countBits(bits);
+            }
+            return i;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TGUI_NODISCARD TGUI_PIXEL_KERNELS_TARGET_AVX2 __m256i load256(const std::uint8_t* ptr)
+        {
+            return _mm256_loadu_si256(static_cast<const __m256i*>(static_cast<const void*>(ptr)));
+        }
+
+        TGUI_PIXEL_KERNELS_TARGET_AVX2 void store256(std::uint8_t* ptr, __m256i value)
+        {
+            _mm256_storeu_si256(static_cast<__m256i*>(static_cast<void*>(ptr)), value);
+        }
+
+        TGUI_PIXEL_KERNELS_TARGET_AVX2 std::size_t convertRgbToRgbaAVX2(const std::uint8_t* rgbPixels, std::uint8_t* rgbaPixels, std::size_t pixelCount)
+        {
+            // Each 128-bit lane contains 4 RGB pixels (and 4 bytes that are ignored), which are spread over 16 bytes
+            const __m256i shuffleMask = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+                                                         0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+            const __m256i alphaChannels = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+
+            // Every iteration reads 28 bytes, so we stop when less than 10 pixels (30 bytes) remain
+            std::size_t i = 0;
+            for (; i + 10 <= pixelCount; i += 8)
+            {
+                const __m256i rgb = _mm256_inserti128_si256(_mm256_castsi128_si256(load128(rgbPixels + 3*i)), load128(rgbPixels + 3*i + 12), 1);
+                store256(rgbaPixels + 4*i, _mm256_or_si256(_mm256_shuffle_epi8(rgb, shuffleMask), alphaChannels));
+            }
+            return i;
+        }
+
+        TGUI_PIXEL_KERNELS_TARGET_AVX2 std::size_t extractTransparencyMaskAVX2(const std::uint8_t* pixels, std::size_t pixelCount, std::uint8_t* mask, std::size_t& transparentPixelCount)
+        {
+            const __m256i zero = _mm256_setzero_si256();
+
+            // Packing works per 128-bit lane, so groups of 4 pixels have to be put back in order afterwards
+            const __m256i reorder = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+            std::size_t i = 0;
+            for (; i + 32 <= pixelCount; i += 32)
+            {
+                const __m256i alpha1 = _mm256_srli_epi32(load256(pixels + 4*i), 24);
+                const __m256i alpha2 = _mm256_srli_epi32(load256(pixels + 4*i + 32), 24);
+                const __m256i alpha3 = _mm256_srli_epi32(load256(pixels + 4*i + 64), 24);
+                const __m256i alpha4 = _mm256_srli_epi32(load256(pixels + 4*i + 96), 24);
+                const __m256i packedAlpha = _mm256_packus_epi16(_mm256_packs_epi32(alpha1, alpha2), _mm256_packs_epi32(alpha3, alpha4));
+                const __m256i alpha = _mm256_permutevar8x32_epi32(packedAlpha, reorder);
+                const auto bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(alpha, zero)));
+
+                mask[i / 8] = static_cast<std::uint8_t>(bits & 0xFF);
+                mask[i / 8 + 1] = static_cast<std::uint8_t>((bits >> 8) & 0xFF);
+                mask[i / 8 + 2] = static_cast<std::uint8_t>((bits >> 16) & 0xFF);
+                mask[i / 8 + 3] = static_cast<std::uint8_t>(bits >> 24);
+                transparentPixelCount += countBits(bits);
+            }
+            return i;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#elif TGUI_PIXEL_KERNELS_NEON
+        std::size_t convertRgbToRgbaNEON(const std::uint8_t* rgbPixels, std::uint8_t* rgbaPixels, std::size_t pixelCount)
+        {
+            std::size_t i = 0;
+            for (; i + 16 <= pixelCount; i += 16)
+            {
+                const uint8x16x3_t rgb = vld3q_u8(rgbPixels + 3*i);
+
+                uint8x16x4_t rgba;
+                rgba.val[0] = rgb.val[0];
+                rgba.val[1] = rgb.val[1];
+                rgba.val[2] = rgb.val[2];
+                rgba.val[3] = vdupq_n_u8(255);
+                vst4q_u8(rgbaPixels + 4*i, rgba);
+            }
+            return i;
+        }
+
+        std::size_t extractTransparencyMaskNEON(const std::uint8_t* pixels, std::size_t pixelCount, std::uint8_t* mask, std::size_t& transparentPixelCount)
+        {
+            static const std::uint8_t bitValues[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+            const uint8x16_t bitMask = vld1q_u8(bitValues);
+
+            std::size_t i = 0;
+            for (; i + 16 <= pixelCount; i += 16)
+            {
+                // Give every transparent pixel its own bit and add the bits together to get the mask of 2 bytes
+                const uint8x16x4_t rgba = vld4q_u8(pixels + 4*i);
+                const uint8x16_t bits = vandq_u8(vceqq_u8(rgba.val[3], vdupq_n_u8(0)), bitMask);
+                uint8x8_t sum = vpadd_u8(vget_low_u8(bits), vget_high_u8(bits));
+                sum = vpadd_u8(sum, sum);
+                sum = vpadd_u8(sum, sum);
+
+                mask[i / 8] = vget_lane_u8(sum, 0);
+                mask[i / 8 + 1] = vget_lane_u8(sum, 1);
+                transparentPixelCount += countBits(static_cast<std::uint32_t>(mask[i / 8]) | (static_cast<std::uint32_t>(mask[i / 8 + 1]) << 8));
+            }
+            return i;
+        }
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PixelKernels::convertRgbToRgba(const std::uint8_t* rgbPixels, std::uint8_t* rgbaPixels, std::size_t pixelCount)
+    {
+        std::size_t processedPixels = 0;
+#if TGUI_PIXEL_KERNELS_SSE2
+        // SSE2 has no instruction to shuffle bytes, so only AVX2 is used for this function
+        if (useAvx2())
+            processedPixels = convertRgbToRgbaAVX2(rgbPixels, rgbaPixels, pixelCount);
+#elif TGUI_PIXEL_KERNELS_NEON
+        processedPixels = convertRgbToRgbaNEON(rgbPixels, rgbaPixels, pixelCount);
+#endif
+        convertRgbToRgbaScalar(rgbPixels, rgbaPixels, processedPixels, pixelCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PixelKernels::extractTransparencyMask(const std::uint8_t* pixels, std::size_t pixelCount, std::uint8_t* mask)
+    {
+        std::size_t transparentPixelCount = 0;
+        std::size_t processedPixels = 0;
+#if TGUI_PIXEL_KERNELS_SSE2
+        if (useAvx2())
+            processedPixels = extractTransparencyMaskAVX2(pixels, pixelCount, mask, transparentPixelCount);
+        else
+            processedPixels = extractTransparencyMaskSSE2(pixels, pixelCount, mask, transparentPixelCount);
+#elif TGUI_PIXEL_KERNELS_NEON
+        processedPixels = extractTransparencyMaskNEON(pixels, pixelCount, mask, transparentPixelCount);
+#endif
+        return transparentPixelCount + extractTransparencyMaskScalar(pixels, processedPixels, pixelCount, mask);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const char* PixelKernels::getInstructionSet()
+    {
+#if TGUI_PIXEL_KERNELS_SSE2
+        return useAvx2() ? "AVX2" : "SSE2";
+#elif TGUI_PIXEL_KERNELS_NEON
+        return "NEON";
+#else
+        return "Scalar";
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
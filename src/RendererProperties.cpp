@@ -0,0 +1,741 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/RendererProperties.hpp>
+#include <TGUI/Exception.hpp>
+#include <unordered_map>
+#include <functional>
+#include <algorithm>
+#include <deque>
+#include <mutex>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        struct PropertyNameHash
+        {
+            TGUI_NODISCARD std::size_t operator()(const String& name) const
+            {
+                return std::hash<std::u32string>{}(name.toUtf32());
+            }
+        };
+
+        using PropertyIdMap = std::unordered_map<String, RendererPropertyId, PropertyNameHash>;
+
+        // The names of the properties from the RendererProperty enum, in the same order
+        const String* getBuiltinNames()
+        {
+            static const String names[] = {
+                U"ArrowBackgroundColor",
+                U"ArrowBackgroundColorDisabled",
+                U"ArrowBackgroundColorHover",
+                U"ArrowColor",
+                U"ArrowColorDisabled",
+                U"ArrowColorHover",
+                U"ArrowsOnNavigationButtonsVisible",
+                U"BackButton",
+                U"BackgroundColor",
+                U"BackgroundColorChecked",
+                U"BackgroundColorCheckedDisabled",
+                U"BackgroundColorCheckedHover",
+                U"BackgroundColorDisabled",
+                U"BackgroundColorDown",
+                U"BackgroundColorDownDisabled",
+                U"BackgroundColorDownFocused",
+                U"BackgroundColorDownHover",
+                U"BackgroundColorFocused",
+                U"BackgroundColorHover",
+                U"BorderBelowTitleBar",
+                U"BorderBetweenArrows",
+                U"BorderColor",
+                U"BorderColorChecked",
+                U"BorderColorCheckedDisabled",
+                U"BorderColorCheckedFocused",
+                U"BorderColorCheckedHover",
+                U"BorderColorDisabled",
+                U"BorderColorDown",
+                U"BorderColorDownDisabled",
+                U"BorderColorDownFocused",
+                U"BorderColorDownHover",
+                U"BorderColorFocused",
+                U"BorderColorHover",
+                U"Borders",
+                U"Button",
+                U"CaretColor",
+                U"CaretColorFocused",
+                U"CaretColorHover",
+                U"CaretWidth",
+                U"CheckColor",
+                U"CheckColorDisabled",
+                U"CheckColorHover",
+                U"CloseButton",
+                U"Color",
+                U"DefaultTextColor",
+                U"DefaultTextStyle",
+                U"DistanceToSide",
+                U"EditBox",
+                U"FileTypeComboBox",
+                U"FilenameLabel",
+                U"FillColor",
+                U"Font",
+                U"ForwardButton",
+                U"GridLinesColor",
+                U"HeaderBackgroundColor",
+                U"HeaderTextColor",
+                U"ImageRotation",
+                U"Label",
+                U"ListBox",
+                U"ListView",
+                U"MaximizeButton",
+                U"MinimizeButton",
+                U"MinimumResizableBorderWidth",
+                U"Opacity",
+                U"OpacityDisabled",
+                U"Padding",
+                U"PaddingBetweenButtons",
+                U"RoundedBorderRadius",
+                U"Scrollbar",
+                U"ScrollbarWidth",
+                U"SelectedBackgroundColor",
+                U"SelectedBackgroundColorHover",
+                U"SelectedBorderColor",
+                U"SelectedBorderColorHover",
+                U"SelectedTextBackgroundColor",
+                U"SelectedTextColor",
+                U"SelectedTextColorHover",
+                U"SelectedTextStyle",
+                U"SelectedTrackColor",
+                U"SelectedTrackColorHover",
+                U"SeparatorColor",
+                U"SeparatorSidePadding",
+                U"SeparatorThickness",
+                U"SeparatorVerticalPadding",
+                U"ShowTextOnTitleButtons",
+                U"Slider",
+                U"SpaceBetweenWidgets",
+                U"TextColor",
+                U"TextColorChecked",
+                U"TextColorCheckedDisabled",
+                U"TextColorCheckedHover",
+                U"TextColorDisabled",
+                U"TextColorDown",
+                U"TextColorDownDisabled",
+                U"TextColorDownFocused",
+                U"TextColorDownHover",
+                U"TextColorFilled",
+                U"TextColorFocused",
+                U"TextColorHover",
+                U"TextDistanceRatio",
+                U"TextOutlineColor",
+                U"TextOutlineThickness",
+                U"TextSize",
+                U"TextStyle",
+                U"TextStyleChecked",
+                U"TextStyleDisabled",
+                U"TextStyleDown",
+                U"TextStyleDownDisabled",
+                U"TextStyleDownFocused",
+                U"TextStyleDownHover",
+                U"TextStyleFocused",
+                U"TextStyleHover",
+                U"Texture",
+                U"TextureArrow",
+                U"TextureArrowDisabled",
+                U"TextureArrowDown",
+                U"TextureArrowDownHover",
+                U"TextureArrowHover",
+                U"TextureArrowUp",
+                U"TextureArrowUpHover",
+                U"TextureBackground",
+                U"TextureBackgroundDisabled",
+                U"TextureBranchCollapsed",
+                U"TextureBranchExpanded",
+                U"TextureChecked",
+                U"TextureCheckedDisabled",
+                U"TextureCheckedFocused",
+                U"TextureCheckedHover",
+                U"TextureDisabled",
+                U"TextureDisabledTab",
+                U"TextureDown",
+                U"TextureDownDisabled",
+                U"TextureDownFocused",
+                U"TextureDownHover",
+                U"TextureFill",
+                U"TextureFocused",
+                U"TextureForeground",
+                U"TextureHeaderBackground",
+                U"TextureHover",
+                U"TextureItemBackground",
+                U"TextureLeaf",
+                U"TextureSelectedItemBackground",
+                U"TextureSelectedTab",
+                U"TextureSelectedTabHover",
+                U"TextureSelectedTrack",
+                U"TextureSelectedTrackHover",
+                U"TextureTab",
+                U"TextureTabHover",
+                U"TextureThumb",
+                U"TextureThumbHover",
+                U"TextureTitleBar",
+                U"TextureTrack",
+                U"TextureTrackHover",
+                U"TextureUnchecked",
+                U"TextureUncheckedDisabled",
+                U"TextureUncheckedFocused",
+                U"TextureUncheckedHover",
+                U"ThumbColor",
+                U"ThumbColorHover",
+                U"ThumbWithinTrack",
+                U"TitleBarColor",
+                U"TitleBarHeight",
+                U"TitleColor",
+                U"TrackColor",
+                U"TrackColorHover",
+                U"TransparentTexture",
+                U"UpButton",
+            };
+            static_assert(sizeof(names) / sizeof(names[0]) == RendererProperty::BuiltinCount, "Builtin property names don't match the RendererProperty enum");
+            return names;
+        }
+
+        // The types of the properties from the RendererProperty enum, in the same order.
+        // None is used for properties that can contain values of different types.
+        const ObjectConverter::Type* getBuiltinTypes()
+        {
+            static const ObjectConverter::Type types[] = {
+                ObjectConverter::Type::Color, // ArrowBackgroundColor
+                ObjectConverter::Type::Color, // ArrowBackgroundColorDisabled
+                ObjectConverter::Type::Color, // ArrowBackgroundColorHover
+                ObjectConverter::Type::Color, // ArrowColor
+                ObjectConverter::Type::Color, // ArrowColorDisabled
+                ObjectConverter::Type::Color, // ArrowColorHover
+                ObjectConverter::Type::Bool, // ArrowsOnNavigationButtonsVisible
+                ObjectConverter::Type::RendererData, // BackButton
+                ObjectConverter::Type::Color, // BackgroundColor
+                ObjectConverter::Type::Color, // BackgroundColorChecked
+                ObjectConverter::Type::Color, // BackgroundColorCheckedDisabled
+                ObjectConverter::Type::Color, // BackgroundColorCheckedHover
+                ObjectConverter::Type::Color, // BackgroundColorDisabled
+                ObjectConverter::Type::Color, // BackgroundColorDown
+                ObjectConverter::Type::Color, // BackgroundColorDownDisabled
+                ObjectConverter::Type::Color, // BackgroundColorDownFocused
+                ObjectConverter::Type::Color, // BackgroundColorDownHover
+                ObjectConverter::Type::Color, // BackgroundColorFocused
+                ObjectConverter::Type::Color, // BackgroundColorHover
+                ObjectConverter::Type::Number, // BorderBelowTitleBar
+                ObjectConverter::Type::Number, // BorderBetweenArrows
+                ObjectConverter::Type::Color, // BorderColor
+                ObjectConverter::Type::Color, // BorderColorChecked
+                ObjectConverter::Type::Color, // BorderColorCheckedDisabled
+                ObjectConverter::Type::Color, // BorderColorCheckedFocused
+                ObjectConverter::Type::Color, // BorderColorCheckedHover
+                ObjectConverter::Type::Color, // BorderColorDisabled
+                ObjectConverter::Type::Color, // BorderColorDown
+                ObjectConverter::Type::Color, // BorderColorDownDisabled
+                ObjectConverter::Type::Color, // BorderColorDownFocused
+                ObjectConverter::Type::Color, // BorderColorDownHover
+                ObjectConverter::Type::Color, // BorderColorFocused
+                ObjectConverter::Type::Color, // BorderColorHover
+                ObjectConverter::Type::Outline, // Borders
+                ObjectConverter::Type::RendererData, // Button
+                ObjectConverter::Type::Color, // CaretColor
+                ObjectConverter::Type::Color, // CaretColorFocused
+                ObjectConverter::Type::Color, // CaretColorHover
+                ObjectConverter::Type::Number, // CaretWidth
+                ObjectConverter::Type::Color, // CheckColor
+                ObjectConverter::Type::Color, // CheckColorDisabled
+                ObjectConverter::Type::Color, // CheckColorHover
+                ObjectConverter::Type::RendererData, // CloseButton
+                ObjectConverter::Type::Color, // Color
+                ObjectConverter::Type::Color, // DefaultTextColor
+                ObjectConverter::Type::TextStyle, // DefaultTextStyle
+                ObjectConverter::Type::Number, // DistanceToSide
+                ObjectConverter::Type::RendererData, // EditBox
+                ObjectConverter::Type::RendererData, // FileTypeComboBox
+                ObjectConverter::Type::RendererData, // FilenameLabel
+                ObjectConverter::Type::Color, // FillColor
+                ObjectConverter::Type::Font, // Font
+                ObjectConverter::Type::RendererData, // ForwardButton
+                ObjectConverter::Type::Color, // GridLinesColor
+                ObjectConverter::Type::Color, // HeaderBackgroundColor
+                ObjectConverter::Type::Color, // HeaderTextColor
+                ObjectConverter::Type::Number, // ImageRotation
+                ObjectConverter::Type::RendererData, // Label
+                ObjectConverter::Type::RendererData, // ListBox
+                ObjectConverter::Type::RendererData, // ListView
+                ObjectConverter::Type::RendererData, // MaximizeButton
+                ObjectConverter::Type::RendererData, // MinimizeButton
+                ObjectConverter::Type::Number, // MinimumResizableBorderWidth
+                ObjectConverter::Type::Number, // Opacity
+                ObjectConverter::Type::Number, // OpacityDisabled
+                ObjectConverter::Type::Outline, // Padding
+                ObjectConverter::Type::Number, // PaddingBetweenButtons
+                ObjectConverter::Type::Number, // RoundedBorderRadius
+                ObjectConverter::Type::RendererData, // Scrollbar
+                ObjectConverter::Type::Number, // ScrollbarWidth
+                ObjectConverter::Type::Color, // SelectedBackgroundColor
+                ObjectConverter::Type::Color, // SelectedBackgroundColorHover
+                ObjectConverter::Type::Color, // SelectedBorderColor
+                ObjectConverter::Type::Color, // SelectedBorderColorHover
+                ObjectConverter::Type::Color, // SelectedTextBackgroundColor
+                ObjectConverter::Type::Color, // SelectedTextColor
+                ObjectConverter::Type::Color, // SelectedTextColorHover
+                ObjectConverter::Type::TextStyle, // SelectedTextStyle
+                ObjectConverter::Type::Color, // SelectedTrackColor
+                ObjectConverter::Type::Color, // SelectedTrackColorHover
+                ObjectConverter::Type::Color, // SeparatorColor
+                ObjectConverter::Type::Number, // SeparatorSidePadding
+                ObjectConverter::Type::Number, // SeparatorThickness
+                ObjectConverter::Type::Number, // SeparatorVerticalPadding
+                ObjectConverter::Type::Bool, // ShowTextOnTitleButtons
+                ObjectConverter::Type::RendererData, // Slider
+                ObjectConverter::Type::None, // SpaceBetweenWidgets
+                ObjectConverter::Type::Color, // TextColor
+                ObjectConverter::Type::Color, // TextColorChecked
+                ObjectConverter::Type::Color, // TextColorCheckedDisabled
+                ObjectConverter::Type::Color, // TextColorCheckedHover
+                ObjectConverter::Type::Color, // TextColorDisabled
+                ObjectConverter::Type::Color, // TextColorDown
+                ObjectConverter::Type::Color, // TextColorDownDisabled
+                ObjectConverter::Type::Color, // TextColorDownFocused
+                ObjectConverter::Type::Color, // TextColorDownHover
+                ObjectConverter::Type::Color, // TextColorFilled
+                ObjectConverter::Type::Color, // TextColorFocused
+                ObjectConverter::Type::Color, // TextColorHover
+                ObjectConverter::Type::Number, // TextDistanceRatio
+                ObjectConverter::Type::Color, // TextOutlineColor
+                ObjectConverter::Type::Number, // TextOutlineThickness
+                ObjectConverter::Type::Number, // TextSize
+                ObjectConverter::Type::TextStyle, // TextStyle
+                ObjectConverter::Type::TextStyle, // TextStyleChecked
+                ObjectConverter::Type::TextStyle, // TextStyleDisabled
+                ObjectConverter::Type::TextStyle, // TextStyleDown
+                ObjectConverter::Type::TextStyle, // TextStyleDownDisabled
+                ObjectConverter::Type::TextStyle, // TextStyleDownFocused
+                ObjectConverter::Type::TextStyle, // TextStyleDownHover
+                ObjectConverter::Type::TextStyle, // TextStyleFocused
+                ObjectConverter::Type::TextStyle, // TextStyleHover
+                ObjectConverter::Type::Texture, // Texture
+                ObjectConverter::Type::Texture, // TextureArrow
+                ObjectConverter::Type::Texture, // TextureArrowDisabled
+                ObjectConverter::Type::Texture, // TextureArrowDown
+                ObjectConverter::Type::Texture, // TextureArrowDownHover
+                ObjectConverter::Type::Texture, // TextureArrowHover
+                ObjectConverter::Type::Texture, // TextureArrowUp
+                ObjectConverter::Type::Texture, // TextureArrowUpHover
+                ObjectConverter::Type::Texture, // TextureBackground
+                ObjectConverter::Type::Texture, // TextureBackgroundDisabled
+                ObjectConverter::Type::Texture, // TextureBranchCollapsed
+                ObjectConverter::Type::Texture, // TextureBranchExpanded
+                ObjectConverter::Type::Texture, // TextureChecked
+                ObjectConverter::Type::Texture, // TextureCheckedDisabled
+                ObjectConverter::Type::Texture, // TextureCheckedFocused
+                ObjectConverter::Type::Texture, // TextureCheckedHover
+                ObjectConverter::Type::Texture, // TextureDisabled
+                ObjectConverter::Type::Texture, // TextureDisabledTab
+                ObjectConverter::Type::Texture, // TextureDown
+                ObjectConverter::Type::Texture, // TextureDownDisabled
+                ObjectConverter::Type::Texture, // TextureDownFocused
+                ObjectConverter::Type::Texture, // TextureDownHover
+                ObjectConverter::Type::Texture, // TextureFill
+                ObjectConverter::Type::Texture, // TextureFocused
+                ObjectConverter::Type::Texture, // TextureForeground
+                ObjectConverter::Type::Texture, // TextureHeaderBackground
+                ObjectConverter::Type::Texture, // TextureHover
+                ObjectConverter::Type::Texture, // TextureItemBackground
+                ObjectConverter::Type::Texture, // TextureLeaf
+                ObjectConverter::Type::Texture, // TextureSelectedItemBackground
+                ObjectConverter::Type::Texture, // TextureSelectedTab
+                ObjectConverter::Type::Texture, // TextureSelectedTabHover
+                ObjectConverter::Type::Texture, // TextureSelectedTrack
+                ObjectConverter::Type::Texture, // TextureSelectedTrackHover
+                ObjectConverter::Type::Texture, // TextureTab
+                ObjectConverter::Type::Texture, // TextureTabHover
+                ObjectConverter::Type::Texture, // TextureThumb
+                ObjectConverter::Type::Texture, // TextureThumbHover
+                ObjectConverter::Type::Texture, // TextureTitleBar
+                ObjectConverter::Type::Texture, // TextureTrack
+                ObjectConverter::Type::Texture, // TextureTrackHover
+                ObjectConverter::Type::Texture, // TextureUnchecked
+                ObjectConverter::Type::Texture, // TextureUncheckedDisabled
+                ObjectConverter::Type::Texture, // TextureUncheckedFocused
+                ObjectConverter::Type::Texture, // TextureUncheckedHover
+                ObjectConverter::Type::Color, // ThumbColor
+                ObjectConverter::Type::Color, // ThumbColorHover
+                ObjectConverter::Type::Bool, // ThumbWithinTrack
+                ObjectConverter::Type::Color, // TitleBarColor
+                ObjectConverter::Type::Number, // TitleBarHeight
+                ObjectConverter::Type::Color, // TitleColor
+                ObjectConverter::Type::Color, // TrackColor
+                ObjectConverter::Type::Color, // TrackColorHover
+                ObjectConverter::Type::Bool, // TransparentTexture
+                ObjectConverter::Type::RendererData, // UpButton
+            };
+            static_assert(sizeof(types) / sizeof(types[0]) == RendererProperty::BuiltinCount, "Builtin property types don't match the RendererProperty enum");
+            return types;
+        }
+
+        // Never modified after construction, so it can be read without locking
+        const PropertyIdMap& getBuiltinIds()
+        {
+            static const PropertyIdMap ids = []{
+                const String* names = getBuiltinNames();
+                PropertyIdMap map;
+                map.reserve(RendererProperty::BuiltinCount);
+                for (RendererPropertyId id = 0; id < RendererProperty::BuiltinCount; ++id)
+                    map.emplace(names[id], id);
+                return map;
+            }();
+            return ids;
+        }
+
+        // Properties that were registered at runtime. A deque is used so that references to the names remain valid.
+        struct DynamicProperties
+        {
+            std::mutex mutex;
+            std::deque<String> names;
+            PropertyIdMap ids;
+        };
+
+        DynamicProperties& getDynamicProperties()
+        {
+            static DynamicProperties properties;
+            return properties;
+        }
+
+        // Finds the id of the property, without checking the properties that were registered at runtime
+        RendererPropertyId findBuiltinId(const String& name)
+        {
+            // The strings returned by getName can be recognized by their address
+            const String* names = getBuiltinNames();
+            if (std::greater_equal<const String*>{}(&name, names) && std::less<const String*>{}(&name, names + RendererProperty::BuiltinCount))
+                return static_cast<RendererPropertyId>(&name - names);
+
+            const auto& builtinIds = getBuiltinIds();
+            const auto it = builtinIds.find(name);
+            if (it != builtinIds.end())
+                return it->second;
+
+            return RendererPropertyRegistry::InvalidId;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    constexpr RendererPropertyId RendererPropertyRegistry::InvalidId;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyId RendererPropertyRegistry::getId(const String& name)
+    {
+        const RendererPropertyId builtinId = findBuiltinId(name);
+        if (builtinId != InvalidId)
+            return builtinId;
+
+        auto& dynamicProperties = getDynamicProperties();
+        std::lock_guard<std::mutex> lock(dynamicProperties.mutex);
+        const auto it = dynamicProperties.ids.find(name);
+        if (it != dynamicProperties.ids.end())
+            return it->second;
+
+        const std::size_t id = RendererProperty::BuiltinCount + dynamicProperties.names.size();
+        if (id >= InvalidId)
+            throw Exception{U"Failed to register renderer property '" + name + U"', too many properties have been registered."};
+
+        dynamicProperties.names.push_back(name);
+        dynamicProperties.ids.emplace(name, static_cast<RendererPropertyId>(id));
+        return static_cast<RendererPropertyId>(id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyId RendererPropertyRegistry::findId(const String& name)
+    {
+        const RendererPropertyId builtinId = findBuiltinId(name);
+        if (builtinId != InvalidId)
+            return builtinId;
+
+        auto& dynamicProperties = getDynamicProperties();
+        std::lock_guard<std::mutex> lock(dynamicProperties.mutex);
+        const auto it = dynamicProperties.ids.find(name);
+        if (it != dynamicProperties.ids.end())
+            return it->second;
+        else
+            return InvalidId;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const String& RendererPropertyRegistry::getName(RendererPropertyId id)
+    {
+        if (id < RendererProperty::BuiltinCount)
+            return getBuiltinNames()[id];
+
+        auto& dynamicProperties = getDynamicProperties();
+        std::lock_guard<std::mutex> lock(dynamicProperties.mutex);
+        TGUI_ASSERT(static_cast<std::size_t>(id - RendererProperty::BuiltinCount) < dynamicProperties.names.size(), "RendererPropertyRegistry::getName called with an id that wasn't registered");
+        return dynamicProperties.names[static_cast<std::size_t>(id - RendererProperty::BuiltinCount)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter::Type RendererPropertyRegistry::getType(RendererPropertyId id)
+    {
+        if (id < RendererProperty::BuiltinCount)
+            return getBuiltinTypes()[id];
+        else
+            return ObjectConverter::Type::None;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::RendererPropertyMap(const std::map<String, ObjectConverter>& pairs)
+    {
+        for (const auto& pair : pairs)
+            (*this)[pair.first] = pair.second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::RendererPropertyMap(const RendererPropertyMap& other) :
+        m_ids{other.m_ids}
+    {
+        m_pairs.reserve(other.m_pairs.size());
+        for (const auto& pair : other.m_pairs)
+            m_pairs.push_back(std::make_unique<value_type>(*pair));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap& RendererPropertyMap::operator=(const RendererPropertyMap& other)
+    {
+        if (this != &other)
+        {
+            RendererPropertyMap temp(other);
+            std::swap(m_ids,   temp.m_ids);
+            std::swap(m_pairs, temp.m_pairs);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::operator std::map<String, ObjectConverter>() const
+    {
+        std::map<String, ObjectConverter> pairs;
+        for (const auto& pair : m_pairs)
+            pairs.insert(*pair);
+        return pairs;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& RendererPropertyMap::operator[](RendererPropertyId id)
+    {
+        const std::size_t index = lowerBound(id);
+        if ((index < m_ids.size()) && (m_ids[index] == id))
+            return m_pairs[index]->second;
+
+        m_ids.insert(m_ids.begin() + static_cast<std::ptrdiff_t>(index), id);
+        m_pairs.insert(m_pairs.begin() + static_cast<std::ptrdiff_t>(index),
+                       std::make_unique<value_type>(RendererPropertyRegistry::getName(id), ObjectConverter{}));
+        return m_pairs[index]->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& RendererPropertyMap::operator[](const String& property)
+    {
+        return (*this)[RendererPropertyRegistry::getId(property)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::find(RendererPropertyId id)
+    {
+        const std::size_t index = lowerBound(id);
+        if ((index < m_ids.size()) && (m_ids[index] == id))
+            return iterator{m_pairs.begin() + static_cast<std::ptrdiff_t>(index)};
+        else
+            return end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::const_iterator RendererPropertyMap::find(RendererPropertyId id) const
+    {
+        const std::size_t index = lowerBound(id);
+        if ((index < m_ids.size()) && (m_ids[index] == id))
+            return const_iterator{m_pairs.cbegin() + static_cast<std::ptrdiff_t>(index)};
+        else
+            return end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::find(const String& property)
+    {
+        const RendererPropertyId id = RendererPropertyRegistry::findId(property);
+        if (id != RendererPropertyRegistry::InvalidId)
+            return find(id);
+        else
+            return end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::const_iterator RendererPropertyMap::find(const String& property) const
+    {
+        const RendererPropertyId id = RendererPropertyRegistry::findId(property);
+        if (id != RendererPropertyRegistry::InvalidId)
+            return find(id);
+        else
+            return end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RendererPropertyMap::count(const String& property) const
+    {
+        return (find(property) != end()) ? 1 : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::erase(const_iterator it)
+    {
+        const auto index = it.getBase() - m_pairs.cbegin();
+        m_ids.erase(m_ids.begin() + index);
+        return iterator{m_pairs.erase(m_pairs.begin() + index)};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RendererPropertyMap::erase(const String& property)
+    {
+        const auto it = find(property);
+        if (it == end())
+            return 0;
+
+        erase(it);
+        return 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererPropertyMap::clear()
+    {
+        m_ids.clear();
+        m_pairs.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RendererPropertyMap::lowerBound(RendererPropertyId id) const
+    {
+        return static_cast<std::size_t>(std::lower_bound(m_ids.begin(), m_ids.end(), id) - m_ids.begin());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererPropertyMask::set(RendererPropertyId id)
+    {
+        const std::size_t word = id / 64u;
+        if (word >= m_bits.size())
+            m_bits.resize(word + 1, 0);
+
+        m_bits[word] |= (std::uint64_t(1) << (id % 64u));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool RendererPropertyMask::test(RendererPropertyId id) const
+    {
+        const std::size_t word = id / 64u;
+        if (word >= m_bits.size())
+            return false;
+
+        return (m_bits[word] & (std::uint64_t(1) << (id % 64u))) != 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool RendererPropertyMask::empty() const
+    {
+        return std::all_of(m_bits.begin(), m_bits.end(), [](std::uint64_t bits){ return bits == 0; });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererPropertyMask::clear()
+    {
+        m_bits.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<RendererPropertyId> RendererPropertyMask::getIds() const
+    {
+        std::vector<RendererPropertyId> ids;
+        for (std::size_t word = 0; word < m_bits.size(); ++word)
+        {
+            std::uint64_t bits = m_bits[word];
+            while (bits != 0)
+            {
+                unsigned int bit = 0;
+                while ((bits & (std::uint64_t(1) << bit)) == 0)
+                    ++bit;
+
+                ids.push_back(static_cast<RendererPropertyId>((word * 64) + bit));
+                bits &= bits - 1; // Clear the lowest bit
+            }
+        }
+
+        return ids;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMask& RendererPropertyMask::operator|=(const RendererPropertyMask& other)
+    {
+        if (other.m_bits.size() > m_bits.size())
+            m_bits.resize(other.m_bits.size(), 0);
+
+        for (std::size_t word = 0; word < other.m_bits.size(); ++word)
+            m_bits[word] |= other.m_bits[word];
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,19 +34,19 @@ namespace tgui
 
     void BoxLayoutRenderer::setSpaceBetweenWidgets(float distance)
     {
-        setProperty("SpaceBetweenWidgets", ObjectConverter{distance});
+        setProperty(RendererProperty::SpaceBetweenWidgets, ObjectConverter{distance});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     float BoxLayoutRenderer::getSpaceBetweenWidgets() const
     {
-        auto it = m_data->propertyValuePairs.find("SpaceBetweenWidgets");
+        auto it = m_data->propertyValuePairs.find(RendererProperty::SpaceBetweenWidgets);
         if (it != m_data->propertyValuePairs.end())
             return it->second.getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("Padding");
+            it = m_data->propertyValuePairs.find(RendererProperty::Padding);
             if (it != m_data->propertyValuePairs.end())
             {
                 const Padding padding = it->second.getOutline();
@@ -26,11 +26,30 @@
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/RendererDefines.hpp>
 #include <TGUI/Widget.hpp>
+#include <unordered_map>
+#include <exception>
+#include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // State of the batch that was started with WidgetRenderer::beginBatchUpdate
+        unsigned int batchUpdateDepth = 0;
+        std::vector<Widget*> pendingWidgets; // In the order in which their renderer was first changed
+        std::unordered_map<const Widget*, RendererPropertyMask> pendingChanges;
+
+        // Values from before the batch started, to restore the properties that a widget rejects
+        struct OldPropertyValue
+        {
+            std::shared_ptr<RendererData> data; // Keeps the data alive, so that its address can't be reused during the batch
+            ObjectConverter value;
+        };
+        std::map<std::pair<const RendererData*, RendererPropertyId>, OldPropertyValue> pendingOldValues;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     RendererData::RendererData(const RendererData& other) :
@@ -99,7 +118,7 @@ namespace tgui
 
     void WidgetRenderer::setOpacity(float opacity)
     {
-        setProperty("Opacity", ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
+        setProperty(RendererProperty::Opacity, ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -109,9 +128,9 @@ namespace tgui
     void WidgetRenderer::setOpacityDisabled(float opacity)
     {
         if (opacity != -1.f)
-            setProperty("OpacityDisabled", ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
+            setProperty(RendererProperty::OpacityDisabled, ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
         else
-            setProperty("OpacityDisabled", ObjectConverter{-1.f});
+            setProperty(RendererProperty::OpacityDisabled, ObjectConverter{-1.f});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -145,14 +164,14 @@ namespace tgui
 
     void WidgetRenderer::setFont(const Font& font)
     {
-        setProperty("Font", font);
+        setProperty(RendererProperty::Font, font);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font WidgetRenderer::getFont() const
     {
-        auto it = m_data->propertyValuePairs.find("Font");
+        auto it = m_data->propertyValuePairs.find(RendererProperty::Font);
         if (it != m_data->propertyValuePairs.end())
             return it->second.getFont();
         else
@@ -163,14 +182,14 @@ namespace tgui
 
     void WidgetRenderer::setTextSize(unsigned int size)
     {
-        setProperty("TextSize", static_cast<float>(size));
+        setProperty(RendererProperty::TextSize, static_cast<float>(size));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int WidgetRenderer::getTextSize() const
     {
-        auto it = m_data->propertyValuePairs.find("TextSize");
+        auto it = m_data->propertyValuePairs.find(RendererProperty::TextSize);
         if (it != m_data->propertyValuePairs.end())
             return static_cast<unsigned int>(it->second.getNumber());
         else
@@ -181,12 +200,43 @@ namespace tgui
 
     void WidgetRenderer::setProperty(const String& property, ObjectConverter&& value)
     {
-        if (m_data->propertyValuePairs[property] == value)
+        setProperty(RendererPropertyRegistry::getId(property), std::move(value));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::setProperty(RendererPropertyId id, ObjectConverter&& value)
+    {
+        ObjectConverter& storedValue = m_data->propertyValuePairs[id];
+        if (storedValue == value)
+            return;
+
+        if (batchUpdateDepth > 0)
+        {
+            const auto key = std::make_pair(static_cast<const RendererData*>(m_data.get()), id);
+            if (pendingOldValues.find(key) == pendingOldValues.end())
+                pendingOldValues.emplace(key, OldPropertyValue{m_data, storedValue});
+
+            storedValue = value;
+            for (const auto& observer : m_data->observers)
+            {
+                auto pendingIt = pendingChanges.find(observer);
+                if (pendingIt == pendingChanges.end())
+                {
+                    pendingIt = pendingChanges.emplace(observer, RendererPropertyMask{}).first;
+                    pendingWidgets.push_back(observer);
+                }
+
+                pendingIt->second.set(id);
+            }
             return;
+        }
 
-        const ObjectConverter oldValue = m_data->propertyValuePairs[property];
-        m_data->propertyValuePairs[property] = value;
+        const ObjectConverter oldValue = storedValue;
+        storedValue = value;
 
+        // The interned name is passed to the widgets, which lets them find the property id without hashing the string
+        const String& property = RendererPropertyRegistry::getName(id);
         try
         {
             for (const auto& observer : m_data->observers)
@@ -194,7 +244,7 @@ namespace tgui
         }
         catch (const Exception&)
         {
-            m_data->propertyValuePairs[property] = oldValue;
+            m_data->propertyValuePairs[id] = oldValue;
             throw;
         }
     }
@@ -212,7 +262,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::map<String, ObjectConverter>& WidgetRenderer::getPropertyValuePairs() const
+    const RendererPropertyMap& WidgetRenderer::getPropertyValuePairs() const
     {
         return m_data->propertyValuePairs;
     }
@@ -257,6 +307,89 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::beginBatchUpdate()
+    {
+        ++batchUpdateDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::endBatchUpdate()
+    {
+        TGUI_ASSERT(batchUpdateDepth > 0, "WidgetRenderer::endBatchUpdate called without a matching beginBatchUpdate");
+        if (batchUpdateDepth == 0)
+            return;
+
+        --batchUpdateDepth;
+        if (batchUpdateDepth > 0)
+            return;
+
+        // The lists are moved out first, as widgets may change renderers again while being informed
+        const std::vector<Widget*> widgets = std::move(pendingWidgets);
+        pendingWidgets.clear();
+        const auto oldValues = std::move(pendingOldValues);
+        pendingOldValues.clear();
+
+        std::exception_ptr firstError;
+        for (Widget* widget : widgets)
+        {
+            // Widgets that were destroyed in the meantime have already been removed from the map
+            const auto pendingIt = pendingChanges.find(widget);
+            if (pendingIt == pendingChanges.end())
+                continue;
+
+            const RendererPropertyMask properties = std::move(pendingIt->second);
+            pendingChanges.erase(pendingIt);
+
+            try
+            {
+                widget->rendererChangedCallback(properties);
+            }
+            catch (const Exception&)
+            {
+                if (!firstError)
+                    firstError = std::current_exception();
+
+                // Pass the properties one by one to find out which ones the widget rejected and restore their old values,
+                // the same way as when the property is set outside a batch
+                const auto& data = widget->getSharedRenderer()->getData();
+                for (const RendererPropertyId id : properties.getIds())
+                {
+                    try
+                    {
+                        widget->rendererChangedCallback(RendererPropertyRegistry::getName(id));
+                    }
+                    catch (const Exception&)
+                    {
+                        const auto oldValueIt = oldValues.find(std::make_pair(static_cast<const RendererData*>(data.get()), id));
+                        if (oldValueIt != oldValues.end())
+                            data->propertyValuePairs[id] = oldValueIt->second.value;
+                    }
+                }
+            }
+        }
+
+        if (firstError)
+            std::rethrow_exception(firstError);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool WidgetRenderer::isBatchUpdateActive()
+    {
+        return batchUpdateDepth > 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::removePendingChanges(const Widget* widget)
+    {
+        if (!pendingChanges.empty())
+            pendingChanges.erase(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
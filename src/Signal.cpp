@@ -26,7 +26,12 @@
 #include <TGUI/Signal.hpp>
 #include <TGUI/Widget.hpp>
 #include <TGUI/Widgets/ChildWindow.hpp>
+#include <TGUI/Backend/Window/Backend.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
 #include <set>
 #include <cassert>
 
@@ -36,8 +41,75 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        // Parameters of the signal that is being emitted on this thread. Each emit stores its parameters on the stack
+        // and restores the parameters of the outer emit afterwards, so that signals can be emitted from within handlers.
+        thread_local const void* const* currentParameters = nullptr;
+
+        struct PostedEmit
+        {
+            const Signal* signal;
+            std::function<bool()> emitFunc;
+        };
+
+        std::mutex postedEmitsMutex;
+        std::deque<PostedEmit> postedEmits;
+        std::atomic<std::size_t> postedEmitCount{0}; // Allows checking whether the queue is empty without locking the mutex
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     unsigned int Signal::m_lastSignalId = 0;
-    std::deque<const void*> Signal::m_parameters;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Keeps track of how many times the handlers are being emitted and applies the changes to the list when the last emit ends
+    struct Signal::EmitDepthGuard
+    {
+        explicit EmitDepthGuard(HandlerList& list) :
+            handlerList{list}
+        {
+            ++handlerList.emitDepth;
+        }
+
+        ~EmitDepthGuard()
+        {
+            if (--handlerList.emitDepth > 0)
+                return;
+
+            auto& handlers = handlerList.handlers;
+            if (handlerList.handlersDisconnectedWhileEmitting)
+            {
+                handlers.erase(std::remove_if(handlers.begin(), handlers.end(), [](const HandlerList::Handler& handler){ return handler.id == 0; }), handlers.end());
+                handlerList.handlersDisconnectedWhileEmitting = false;
+            }
+
+            if (!handlerList.handlersConnectedWhileEmitting.empty())
+            {
+                handlers.insert(handlers.end(), std::make_move_iterator(handlerList.handlersConnectedWhileEmitting.begin()),
+                                std::make_move_iterator(handlerList.handlersConnectedWhileEmitting.end()));
+                handlerList.handlersConnectedWhileEmitting.clear();
+            }
+        }
+
+        EmitDepthGuard(const EmitDepthGuard&) = delete;
+        EmitDepthGuard& operator=(const EmitDepthGuard&) = delete;
+
+        HandlerList& handlerList;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal::~Signal()
+    {
+        if (postedEmitCount == 0)
+            return;
+
+        std::lock_guard<std::mutex> lock(postedEmitsMutex);
+        postedEmits.erase(std::remove_if(postedEmits.begin(), postedEmits.end(), [this](const PostedEmit& postedEmit){ return postedEmit.signal == this; }), postedEmits.end());
+        postedEmitCount = postedEmits.size();
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -56,7 +128,7 @@ namespace tgui
         {
             m_enabled = other.m_enabled;
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            disconnectAll(); // signal handlers are not copied with the widget
         }
 
         return *this;
@@ -66,35 +138,191 @@ namespace tgui
 
     bool Signal::disconnect(unsigned int id)
     {
-        return (m_handlers.erase(id) != 0);
+        if (!m_handlers || (id == 0))
+            return false;
+
+        auto& handlers = m_handlers->handlers;
+        const auto it = std::find_if(handlers.begin(), handlers.end(), [id](const HandlerList::Handler& handler){ return handler.id == id; });
+        if (it != handlers.end())
+        {
+            if (m_handlers->emitDepth > 0)
+            {
+                it->id = 0;
+                m_handlers->handlersDisconnectedWhileEmitting = true;
+            }
+            else
+                handlers.erase(it);
+        }
+        else
+        {
+            auto& newHandlers = m_handlers->handlersConnectedWhileEmitting;
+            const auto newIt = std::find_if(newHandlers.begin(), newHandlers.end(), [id](const HandlerList::Handler& handler){ return handler.id == id; });
+            if (newIt == newHandlers.end())
+                return false;
+
+            newHandlers.erase(newIt);
+        }
+
+        // Release the memory when the last handler is disconnected. A signal that is still being emitted keeps its own reference.
+        const bool handlersLeft = !m_handlers->handlersConnectedWhileEmitting.empty()
+            || std::any_of(handlers.begin(), handlers.end(), [](const HandlerList::Handler& handler){ return handler.id != 0; });
+        if (!handlersLeft)
+            m_handlers = nullptr;
+
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        if (m_handlers && (m_handlers->emitDepth > 0))
+        {
+            for (auto& handler : m_handlers->handlers)
+                handler.id = 0;
+        }
+
+        m_handlers = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Signal::emit(const Widget* widget)
     {
-        if (m_handlers.empty() || !m_enabled)
+        if (!m_handlers)
             return false;
 
-        m_parameters[0] = static_cast<const void*>(&widget);
+        const void* parameters[] = {static_cast<const void*>(&widget)};
+        return emitWithParameters(parameters);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-        auto handlers = m_handlers;
-        for (const auto& handler : handlers)
-            handler.second();
+    void Signal::postEmit(const Widget* widget)
+    {
+        postEmitFunc([this, widget]{ return emit(widget); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Signal::dispatchPostedEmits()
+    {
+        if (postedEmitCount == 0)
+            return false;
+
+        // Signals that are posted by the handlers are only emitted the next time this function is called
+        std::size_t emitsLeft = postedEmitCount;
+        bool handlerCalled = false;
+        while (emitsLeft-- > 0)
+        {
+            std::function<bool()> emitFunc;
+            {
+                std::lock_guard<std::mutex> lock(postedEmitsMutex);
+                if (postedEmits.empty()) // Signals may have been destroyed in the meantime
+                    break;
+
+                emitFunc = std::move(postedEmits.front().emitFunc);
+                postedEmits.pop_front();
+                postedEmitCount = postedEmits.size();
+            }
+
+            if (emitFunc())
+                handlerCalled = true;
+        }
+
+        return handlerCalled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Signal::hasPostedEmits()
+    {
+        return postedEmitCount != 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Signal::emitWithParameters(const void* const* parameters)
+    {
+        if (!m_handlers || !m_enabled)
+            return false;
+
+        struct ParametersGuard
+        {
+            explicit ParametersGuard(const void* const* params) :
+                previousParameters{currentParameters}
+            {
+                currentParameters = params;
+            }
+
+            ~ParametersGuard()
+            {
+                currentParameters = previousParameters;
+            }
+
+            ParametersGuard(const ParametersGuard&) = delete;
+            ParametersGuard& operator=(const ParametersGuard&) = delete;
+
+            const void* const* previousParameters;
+        };
+        const ParametersGuard parametersGuard{parameters};
+
+        // Hold a reference to the handlers in case the widget (and this signal) gets destroyed during the handler.
+        // Handlers that are connected while emitting the signal are only called the next time the signal is emitted.
+        const std::shared_ptr<HandlerList> handlerList = m_handlers;
+        EmitDepthGuard depthGuard{*handlerList};
+
+        const std::size_t handlerCount = handlerList->handlers.size();
+        for (std::size_t i = 0; i < handlerCount; ++i)
+        {
+            if (handlerList->handlers[i].id != 0)
+                handlerList->handlers[i].func();
+        }
 
         return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    unsigned int Signal::addHandler(std::function<void()> func)
+    {
+        if (!m_handlers)
+            m_handlers = std::make_shared<HandlerList>();
+
+        const auto id = ++m_lastSignalId;
+        if (m_handlers->emitDepth > 0)
+            m_handlers->handlersConnectedWhileEmitting.push_back({id, std::move(func)});
+        else
+            m_handlers->handlers.push_back({id, std::move(func)});
+
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Signal::postEmitFunc(std::function<bool()> emitFunc)
+    {
+        {
+            std::lock_guard<std::mutex> lock(postedEmitsMutex);
+            postedEmits.push_back({this, std::move(emitFunc)});
+            postedEmitCount = postedEmits.size();
+        }
+
+        // The gui may be waiting for events, it has to wake up to emit the signal
+        if (isBackendSet())
+            getBackend()->wakeUpEventLoop();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const void* Signal::getParameter(std::size_t paramIndex)
+    {
+        TGUI_ASSERT(currentParameters != nullptr, "Signal parameters can only be accessed while the signal is being emitted");
+        return currentParameters[paramIndex];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr Signal::getWidget()
     {
         return dereferenceParam<Widget*>(0)->shared_from_this();
@@ -104,11 +332,19 @@ namespace tgui
 
     bool SignalChildWindow::emit(ChildWindow* childWindow)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
-        m_parameters[1] = static_cast<const void*>(&childWindow);
-        return Signal::emit(childWindow);
+        const Widget* widget = childWindow;
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&childWindow)};
+        return emitWithParameters(parameters);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SignalChildWindow::postEmit(ChildWindow* childWindow)
+    {
+        postEmitFunc([this, childWindow]{ return emit(childWindow); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -122,63 +358,94 @@ namespace tgui
 
     bool SignalItem::emit(const Widget* widget, int index, const String& item, const String& id)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
-        m_parameters[1] = static_cast<const void*>(&index);
-        m_parameters[2] = static_cast<const void*>(&item);
-        m_parameters[3] = static_cast<const void*>(&id);
-        return Signal::emit(widget);
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&index),
+                                    static_cast<const void*>(&item), static_cast<const void*>(&id)};
+        return emitWithParameters(parameters);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SignalItem::postEmit(const Widget* widget, int index, const String& item, const String& id)
+    {
+        postEmitFunc([this, widget, index, item, id]{ return emit(widget, index, item, id); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool SignalFileDialogPaths::emit(const Widget* widget, const std::vector<Filesystem::Path>& paths)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
         assert(!paths.empty());
         const String& pathStr = paths[0].asString();
-        m_parameters[1] = static_cast<const void*>(&pathStr);
-        m_parameters[2] = static_cast<const void*>(&paths[0]);
-        m_parameters[3] = static_cast<const void*>(&paths);
-        return Signal::emit(widget);
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&pathStr),
+                                    static_cast<const void*>(&paths[0]), static_cast<const void*>(&paths)};
+        return emitWithParameters(parameters);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SignalFileDialogPaths::postEmit(const Widget* widget, const std::vector<Filesystem::Path>& paths)
+    {
+        postEmitFunc([this, widget, paths]{ return emit(widget, paths); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool SignalShowEffect::emit(const Widget* widget, ShowEffectType type, bool visible)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
-        m_parameters[1] = static_cast<const void*>(&type);
-        m_parameters[2] = static_cast<const void*>(&visible);
-        return Signal::emit(widget);
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&type), static_cast<const void*>(&visible)};
+        return emitWithParameters(parameters);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SignalShowEffect::postEmit(const Widget* widget, ShowEffectType type, bool visible)
+    {
+        postEmitFunc([this, widget, type, visible]{ return emit(widget, type, visible); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool SignalAnimationType::emit(const Widget* widget, AnimationType type)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
-        m_parameters[1] = static_cast<const void*>(&type);
-        return Signal::emit(widget);
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&type)};
+        return emitWithParameters(parameters);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SignalAnimationType::postEmit(const Widget* widget, AnimationType type)
+    {
+        postEmitFunc([this, widget, type]{ return emit(widget, type); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool SignalItemHierarchy::emit(const Widget* widget, const String& item, const std::vector<String>& fullItem)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
-        m_parameters[1] = static_cast<const void*>(&item);
-        m_parameters[2] = static_cast<const void*>(&fullItem);
-        return Signal::emit(widget);
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&item), static_cast<const void*>(&fullItem)};
+        return emitWithParameters(parameters);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SignalItemHierarchy::postEmit(const Widget* widget, const String& item, const std::vector<String>& fullItem)
+    {
+        postEmitFunc([this, widget, item, fullItem]{ return emit(widget, item, fullItem); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
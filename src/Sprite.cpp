@@ -34,6 +34,139 @@
 
 namespace tgui
 {
+    TGUI_NODISCARD static std::size_t getSvgTextureMemory(const std::shared_ptr<BackendTexture>& svgTexture)
+    {
+        if (!svgTexture)
+            return 0;
+
+        return svgTexture->getGpuMemoryUsage() + svgTexture->getPixelMemoryUsage();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        // Describes which of the 4 x and y values each vertex uses, together with the triangles that are drawn.
+        // These are the same for every sprite with the same scaling type, so only the values depend on the sprite.
+        struct VertexLayout
+        {
+            std::size_t vertexCount;
+            std::array<std::uint8_t, 16> columns;
+            std::array<std::uint8_t, 16> rows;
+            std::vector<unsigned int> indices;
+        };
+    }
+
+    TGUI_NODISCARD static const VertexLayout& getVertexLayout(Sprite::ScalingType scalingType)
+    {
+        ///////////
+        // 0---1 //
+        // |   | //
+        // 2---3 //
+        ///////////
+        static const VertexLayout normalLayout{4, {{0, 3, 0, 3}}, {{0, 0, 3, 3}}, {
+            0, 2, 1,
+            1, 2, 3
+        }};
+
+        ///////////////////////
+        // 0---2-------4---6 //
+        // |   |       |   | //
+        // 1---3-------5---7 //
+        ///////////////////////
+        static const VertexLayout horizontalLayout{8, {{0, 0, 1, 1, 2, 2, 3, 3}}, {{0, 3, 0, 3, 0, 3, 0, 3}}, {
+            0, 1, 2,
+            1, 3, 2,
+            2, 3, 4,
+            3, 5, 4,
+            4, 5, 6,
+            5, 7, 6
+        }};
+
+        ///////////
+        // 0---1 //
+        // |   | //
+        // 2---3 //
+        // |   | //
+        // |   | //
+        // |   | //
+        // 4---5 //
+        // |   | //
+        // 6---7-//
+        ///////////
+        static const VertexLayout verticalLayout{8, {{0, 3, 0, 3, 0, 3, 0, 3}}, {{0, 0, 1, 1, 2, 2, 3, 3}}, {
+            0, 2, 1,
+            1, 2, 3,
+            2, 4, 3,
+            3, 4, 5,
+            4, 6, 5,
+            5, 6, 7
+        }};
+
+        ///////////////////////////////
+        // 0----1-----------11----12 //
+        // |    |            |    |  //
+        // 2----3-----------10----13 //
+        // |    |            |    |  //
+        // |    |            |    |  //
+        // |    |            |    |  //
+        // 4----5------------9----14 //
+        // |    |            |    |  //
+        // 6----7------------8----15 //
+        ///////////////////////////////
+        static const VertexLayout nineSliceLayout{16,
+            {{0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2, 3, 3, 3, 3}},
+            {{0, 0, 1, 1, 2, 2, 3, 3, 3, 2, 1, 0, 0, 1, 2, 3}}, {
+            0, 2, 1,
+            1, 2, 3,
+            2, 4, 3,
+            3, 4, 5,
+            4, 6, 5,
+            6, 7, 5,
+            7, 8, 5,
+            8, 9, 5,
+            5, 9, 3,
+            9, 10, 3,
+            3, 10, 1,
+            1, 10, 11,
+            11, 10, 12,
+            12, 10, 13,
+            10, 13, 9,
+            13, 9, 14,
+            9, 8, 14,
+            8, 15, 14
+        }};
+
+        switch (scalingType)
+        {
+        case Sprite::ScalingType::Horizontal:
+            return horizontalLayout;
+        case Sprite::ScalingType::Vertical:
+            return verticalLayout;
+        case Sprite::ScalingType::NineSlice:
+            return nineSliceLayout;
+        case Sprite::ScalingType::Normal:
+            break;
+        }
+
+        return normalLayout;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<unsigned int>& Sprite::getIndices() const
+    {
+        if (m_vertexCount == 0)
+        {
+            static const std::vector<unsigned int> noIndices;
+            return noIndices;
+        }
+
+        return getVertexLayout(m_scalingType).indices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Sprite::Sprite(const Texture& texture)
     {
         setTexture(texture);
@@ -46,7 +179,7 @@ namespace tgui
         m_texture    (other.m_texture),
         m_svgTexture (nullptr),
         m_vertices   (other.m_vertices),
-        m_indices    (other.m_indices),
+        m_vertexCount(other.m_vertexCount),
         m_visibleRect(other.m_visibleRect),
         m_vertexColor(other.m_vertexColor),
         m_opacity    (other.m_opacity),
@@ -65,7 +198,7 @@ namespace tgui
         m_texture    (std::move(other.m_texture)),
         m_svgTexture (std::move(other.m_svgTexture)),
         m_vertices   (std::move(other.m_vertices)),
-        m_indices    (std::move(other.m_indices)),
+        m_vertexCount(std::move(other.m_vertexCount)),
         m_visibleRect(std::move(other.m_visibleRect)),
         m_vertexColor(std::move(other.m_vertexColor)),
         m_opacity    (std::move(other.m_opacity)),
@@ -77,6 +210,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Sprite::~Sprite()
+    {
+        releaseSvgRasterMemory();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Sprite& Sprite::operator= (const Sprite& other)
     {
         if (this != &other)
@@ -87,7 +227,7 @@ namespace tgui
             std::swap(m_texture,     temp.m_texture);
             std::swap(m_svgTexture,  temp.m_svgTexture);
             std::swap(m_vertices,    temp.m_vertices);
-            std::swap(m_indices,     temp.m_indices);
+            std::swap(m_vertexCount, temp.m_vertexCount);
             std::swap(m_visibleRect, temp.m_visibleRect);
             std::swap(m_vertexColor, temp.m_vertexColor);
             std::swap(m_opacity,     temp.m_opacity);
@@ -105,11 +245,13 @@ namespace tgui
     {
         if (this != &other)
         {
+            releaseSvgRasterMemory();
+
             m_size        = std::move(other.m_size);
             m_texture     = std::move(other.m_texture);
             m_svgTexture  = std::move(other.m_svgTexture);
             m_vertices    = std::move(other.m_vertices);
-            m_indices     = std::move(other.m_indices);
+            m_vertexCount = std::move(other.m_vertexCount);
             m_visibleRect = std::move(other.m_visibleRect);
             m_vertexColor = std::move(other.m_vertexColor);
             m_opacity     = std::move(other.m_opacity);
@@ -125,6 +267,9 @@ namespace tgui
 
     void Sprite::setTexture(const Texture& texture)
     {
+        releaseSvgRasterMemory();
+        m_svgTexture = nullptr;
+
         m_texture = texture;
         m_vertexColor = m_texture.getColor();
 
@@ -176,8 +321,8 @@ namespace tgui
         m_opacity = opacity;
 
         const auto vertexColor = Vertex::Color(Color::applyOpacity(m_vertexColor, m_opacity));
-        for (auto& vertex : m_vertices)
-            vertex.color = Vertex::Color{vertexColor};
+        for (std::size_t i = 0; i < m_vertexCount; ++i)
+            m_vertices[i].color = vertexColor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -367,7 +512,9 @@ namespace tgui
                 static_cast<unsigned int>(std::round(getSize().x)),
                 static_cast<unsigned int>(std::round(getSize().y))};
 
+            releaseSvgRasterMemory();
             m_texture.getData()->svgImage->rasterize(*m_svgTexture, svgTextureSize);
+            m_texture.getData()->svgRasterMemory += getSvgTextureMemory(m_svgTexture);
 
             m_scalingType = ScalingType::Normal;
             textureSize = getSize();
@@ -411,173 +558,74 @@ namespace tgui
             }
         }
 
-        // Calculate the vertices based on the way we are scaling
-        const Vertex::Color vertexColor(Color::applyOpacity(m_vertexColor, m_opacity));
-        switch (m_scalingType)
-        {
-        case ScalingType::Normal:
-            ///////////
-            // 0---1 //
-            // |   | //
-            // 2---3 //
-            ///////////
-            m_vertices = {
-                {{0, 0}, vertexColor, {0, 0}},
-                {{m_size.x, 0}, vertexColor, {textureSize.x, 0}},
-                {{0, m_size.y}, vertexColor, {0, textureSize.y}},
-                {{m_size.x, m_size.y}, vertexColor, {textureSize.x, textureSize.y}},
-            };
-            m_indices = {
-                0, 2, 1,
-                1, 2, 3
-            };
-            break;
-
-        case ScalingType::Horizontal:
-            ///////////////////////
-            // 0---2-------4---6 //
-            // |   |       |   | //
-            // 1---3-------5---7 //
-            ///////////////////////
-            m_vertices = {
-                {{0, 0}, vertexColor, {0, 0}},
-                {{0, m_size.y}, vertexColor, {0, textureSize.y}},
-                {{middleRect.left * (m_size.y / textureSize.y), 0}, vertexColor, {middleRect.left, 0}},
-                {{middleRect.left * (m_size.y / textureSize.y), m_size.y}, vertexColor, {middleRect.left, textureSize.y}},
-                {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), 0}, vertexColor, {middleRect.left + middleRect.width, 0}},
-                {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), m_size.y}, vertexColor, {middleRect.left + middleRect.width, textureSize.y}},
-                {{m_size.x, 0}, vertexColor, {textureSize.x, 0}},
-                {{m_size.x, m_size.y}, vertexColor, {textureSize.x, textureSize.y}},
-            };
-            m_indices = {
-                0, 1, 2,
-                1, 3, 2,
-                2, 3, 4,
-                3, 5, 4,
-                4, 5, 6,
-                5, 7, 6
-            };
-            break;
-
-        case ScalingType::Vertical:
-            ///////////
-            // 0---1 //
-            // |   | //
-            // 2---3 //
-            // |   | //
-            // |   | //
-            // |   | //
-            // 4---5 //
-            // |   | //
-            // 6---7-//
-            ///////////
-            m_vertices = {
-                {{0, 0}, vertexColor, {0, 0}},
-                {{m_size.x, 0}, vertexColor, {textureSize.x, 0}},
-                {{0, middleRect.top * (m_size.x / textureSize.x)}, vertexColor, {0, middleRect.top}},
-                {{m_size.x, middleRect.top * (m_size.x / textureSize.x)}, vertexColor, {textureSize.x, middleRect.top}},
-                {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, vertexColor, {0, middleRect.top + middleRect.height}},
-                {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, vertexColor, {textureSize.x, middleRect.top + middleRect.height}},
-                {{0, m_size.y}, vertexColor, {0, textureSize.y}},
-                {{m_size.x, m_size.y}, vertexColor, {textureSize.x, textureSize.y}},
-            };
-            m_indices = {
-                0, 2, 1,
-                1, 2, 3,
-                2, 4, 3,
-                3, 4, 5,
-                4, 6, 5,
-                5, 6, 7
-            };
-            break;
-
-        case ScalingType::NineSlice:
-            ///////////////////////////////
-            // 0----1-----------11----12 //
-            // |    |            |    |  //
-            // 2----3-----------10----13 //
-            // |    |            |    |  //
-            // |    |            |    |  //
-            // |    |            |    |  //
-            // 4----5------------9----14 //
-            // |    |            |    |  //
-            // 6----7------------8----15 //
-            ///////////////////////////////
-            m_vertices = {
-                {{0, 0}, vertexColor, {0, 0}},
-                {{middleRect.left, 0}, vertexColor, {middleRect.left, 0}},
-                {{0, middleRect.top}, vertexColor, {0, middleRect.top}},
-                {{middleRect.left, middleRect.top}, vertexColor, {middleRect.left, middleRect.top}},
-                {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, vertexColor, {0, middleRect.top + middleRect.height}},
-                {{middleRect.left, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, vertexColor, {middleRect.left, middleRect.top + middleRect.height}},
-                {{0, m_size.y}, vertexColor, {0, textureSize.y}},
-                {{middleRect.left, m_size.y}, vertexColor, {middleRect.left, textureSize.y}},
-                {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y}, vertexColor, {middleRect.left + middleRect.width, textureSize.y}},
-                {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, vertexColor, {middleRect.left + middleRect.width, middleRect.top + middleRect.height}},
-                {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), middleRect.top}, vertexColor, {middleRect.left + middleRect.width, middleRect.top}},
-                {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), 0}, vertexColor, {middleRect.left + middleRect.width, 0}},
-                {{m_size.x, 0}, vertexColor, {textureSize.x, 0}},
-                {{m_size.x, middleRect.top}, vertexColor, {textureSize.x, middleRect.top}},
-                {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, vertexColor, {textureSize.x, middleRect.top + middleRect.height}},
-                {{m_size.x, m_size.y}, vertexColor, {textureSize.x, textureSize.y}},
-            };
-            m_indices = {
-                0, 2, 1,
-                1, 2, 3,
-                2, 4, 3,
-                3, 4, 5,
-                4, 6, 5,
-                6, 7, 5,
-                7, 8, 5,
-                8, 9, 5,
-                5, 9, 3,
-                9, 10, 3,
-                3, 10, 1,
-                1, 10, 11,
-                11, 10, 12,
-                12, 10, 13,
-                10, 13, 9,
-                13, 9, 14,
-                9, 8, 14,
-                8, 15, 14
-            };
-            break;
-        };
-
-        if (texCoordOffset != Vector2u{})
-        {
-            for (auto& vertex : m_vertices)
-            {
-                vertex.texCoords.x += static_cast<float>(m_texture.getPartRect().left);
-                vertex.texCoords.y += static_cast<float>(m_texture.getPartRect().top);
-            }
-        }
-
-        // Normalize the texture coordinates
+        // The image is split in at most 3 columns and 3 rows, so there are at most 4 different x and y values.
+        // Parts that keep their ratio are scaled with the size in the other direction, while corners keep their size.
+        const float scaleX = (m_scalingType == ScalingType::Horizontal) ? (m_size.y / textureSize.y) : 1;
+        const float scaleY = (m_scalingType == ScalingType::Vertical) ? (m_size.x / textureSize.x) : 1;
+        const std::array<float, 4> positionsX = {{
+            0,
+            middleRect.left * scaleX,
+            m_size.x - (textureSize.x - middleRect.left - middleRect.width) * scaleX,
+            m_size.x
+        }};
+        const std::array<float, 4> positionsY = {{
+            0,
+            middleRect.top * scaleY,
+            m_size.y - (textureSize.y - middleRect.top - middleRect.height) * scaleY,
+            m_size.y
+        }};
+
+        // Texture coordinates are normalized, taking into account that only part of the texture may be used
+        Vector2f normalizeSize{1, 1};
         if (m_texture.getData()->svgImage)
         {
             const Vector2f svgTextureSize{std::round(getSize().x), std::round(getSize().y)};
             if ((svgTextureSize.x != 0) && (svgTextureSize.y != 0))
-            {
-                for (auto& vertex : m_vertices)
-                {
-                    vertex.texCoords.x /= svgTextureSize.x;
-                    vertex.texCoords.y /= svgTextureSize.y;
-                }
-            }
+                normalizeSize = svgTextureSize;
         }
         else if (m_texture.getData()->backendTexture)
         {
             const Vector2f backendTextureSize{m_texture.getData()->backendTexture->getSize()};
             if ((backendTextureSize.x != 0) && (backendTextureSize.y != 0))
-            {
-                for (auto& vertex : m_vertices)
-                {
-                    vertex.texCoords.x /= backendTextureSize.x;
-                    vertex.texCoords.y /= backendTextureSize.y;
-                }
-            }
+                normalizeSize = backendTextureSize;
         }
+
+        const Vector2f offset{texCoordOffset};
+        const std::array<float, 4> texCoordsX = {{
+            (0 + offset.x) / normalizeSize.x,
+            (middleRect.left + offset.x) / normalizeSize.x,
+            (middleRect.left + middleRect.width + offset.x) / normalizeSize.x,
+            (textureSize.x + offset.x) / normalizeSize.x
+        }};
+        const std::array<float, 4> texCoordsY = {{
+            (0 + offset.y) / normalizeSize.y,
+            (middleRect.top + offset.y) / normalizeSize.y,
+            (middleRect.top + middleRect.height + offset.y) / normalizeSize.y,
+            (textureSize.y + offset.y) / normalizeSize.y
+        }};
+
+        const VertexLayout& layout = getVertexLayout(m_scalingType);
+        const Vertex::Color vertexColor(Color::applyOpacity(m_vertexColor, m_opacity));
+        for (std::size_t i = 0; i < layout.vertexCount; ++i)
+        {
+            const std::uint8_t column = layout.columns[i];
+            const std::uint8_t row = layout.rows[i];
+            m_vertices[i] = {{positionsX[column], positionsY[row]}, vertexColor, {texCoordsX[column], texCoordsY[row]}};
+        }
+
+        m_vertexCount = layout.vertexCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Sprite::releaseSvgRasterMemory()
+    {
+        if (!m_svgTexture || !m_texture.getData())
+            return;
+
+        const std::size_t svgTextureMemory = getSvgTextureMemory(m_svgTexture);
+        TGUI_ASSERT(m_texture.getData()->svgRasterMemory >= svgTextureMemory, "Memory used by rasterized svg images can't become negative");
+        m_texture.getData()->svgRasterMemory -= svgTextureMemory;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
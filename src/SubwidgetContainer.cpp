@@ -181,10 +181,7 @@ namespace tgui
         if (toolTip)
             return toolTip;
 
-        if (m_toolTip)
-            return getToolTip();
-
-        return nullptr;
+        return getToolTip();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -324,6 +321,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> SubwidgetContainer::getTimeUntilNextUpdate() const
+    {
+        return m_container->getTimeUntilNextUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool SubwidgetContainer::isMouseOnWidget(Vector2f pos) const
     {
         return m_container->isMouseOnWidget(pos - getPosition());
@@ -236,7 +236,8 @@ namespace tgui
         if (!pixelPtr)
             throw Exception{U"Failed to load texture from provided memory location (" + String(fileDataSize) + U" bytes)"};
 
-        if (!data->backendTexture->load(imageSize, std::move(pixelPtr), smooth))
+        // The pixels are kept in memory because the texture has no id and can only be serialized by saving its pixels
+        if (!data->backendTexture->load(imageSize, std::move(pixelPtr), smooth, true))
             throw Exception{U"Failed to load texture from pixels that were loaded from file in memory"};
 
         m_id = "";
@@ -253,7 +254,7 @@ namespace tgui
         auto pixelPtr = MakeUniqueForOverwrite<std::uint8_t[]>(size.x * size.y * 4);
         std::memcpy(pixelPtr.get(), pixels, size.x * size.y * 4);
 
-        if (!data->backendTexture->load(size, std::move(pixelPtr), smooth))
+        if (!data->backendTexture->load(size, std::move(pixelPtr), smooth, true))
             throw Exception{U"Failed to load texture from provided pixel data"};
 
         m_id = "";
@@ -314,6 +315,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Texture::setMipmapped(bool mipmapped)
+    {
+        if (!m_data || !m_data->backendTexture)
+            return;
+
+        // Generating or dropping the mipmaps changes the amount of video memory used by the image
+        m_data->backendTexture->setMipmapped(mipmapped);
+        TextureManager::updateMemoryUsage(m_data);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Texture::isMipmapped() const
+    {
+        if (m_data && m_data->backendTexture)
+            return m_data->backendTexture->isMipmapped();
+        else
+            return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Texture::setColor(const Color& color)
     {
         m_color = color;
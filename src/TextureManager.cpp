@@ -32,7 +32,12 @@
 
 namespace tgui
 {
-    std::map<String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    std::unordered_set<String, TextureManager::FilenameHash> TextureManager::m_filenames;
+    std::unordered_map<TextureManager::ImageKey, TextureDataHolder, TextureManager::ImageKeyHash> TextureManager::m_imageMap;
+    std::unordered_map<const TextureData*, TextureManager::ImageKey> TextureManager::m_imageKeys;
+    std::list<TextureDataHolder*> TextureManager::m_unusedImages;
+    std::size_t TextureManager::m_memoryBudget = 0;
+    std::size_t TextureManager::m_memoryUsage = 0;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -42,109 +47,183 @@ namespace tgui
         texture.setCopyCallback(&TextureManager::copyTexture);
         texture.setDestructCallback(&TextureManager::removeTexture);
 
-        const bool isSvg = ((filename.length() > 4) && (filename.substr(filename.length() - 4, 4).equalIgnoreCase(".svg")));
-
         // Look if we already had this image
-        auto imageIt = m_imageMap.find(filename);
-        if (imageIt != m_imageMap.end())
+        const auto filenameIt = m_filenames.find(filename);
+        if (filenameIt != m_filenames.end())
         {
-            // Loop all our textures to find the one containing the image
-            for (auto& dataHolder : imageIt->second)
+            const auto imageIt = m_imageMap.find({&*filenameIt, smooth});
+            if (imageIt != m_imageMap.end())
             {
-                // We can reuse everything only if the image is loaded with the same settings
-                if (dataHolder.smooth == smooth)
-                {
-                    // The exact same texture is now used at multiple places
-                    ++dataHolder.users;
-                    return dataHolder.data;
-                }
+                // The image is no longer only kept in the cache when it is used again
+                if (imageIt->second.users == 0)
+                    m_unusedImages.erase(imageIt->second.unusedImagesIt);
+
+                // The exact same texture is now used at multiple places
+                ++imageIt->second.users;
+                return imageIt->second.data;
             }
         }
-        else // The image doesn't exist yet
-        {
-            auto it = m_imageMap.insert({filename, {}});
-            imageIt = it.first;
-        }
-
-        // Add new data to the list
-        TGUI_EMPLACE_BACK(dataHolder, imageIt->second)
-        dataHolder.filename = filename;
-        dataHolder.users = 1;
-        dataHolder.smooth = smooth;
-        dataHolder.data = std::make_shared<TextureData>();
 
         // Load the image
-        auto data = imageIt->second.back().data;
+        auto data = std::make_shared<TextureData>();
+        const bool isSvg = ((filename.length() > 4) && (filename.substr(filename.length() - 4, 4).equalIgnoreCase(".svg")));
         if (isSvg)
         {
             data->svgImage.emplace(filename);
-            if (data->svgImage->isSet())
-                return data;
+            if (!data->svgImage->isSet())
+                return nullptr;
         }
         else // Not an svg
         {
             data->backendTexture = getBackend()->createTexture();
-            if (texture.getBackendTextureLoader()(*data->backendTexture, filename, smooth))
-                return data;
+            if (!texture.getBackendTextureLoader()(*data->backendTexture, filename, smooth))
+                return nullptr;
         }
 
-        // The image could not be loaded
-        if (imageIt->second.size() > 1)
-            imageIt->second.pop_back();
-        else
-            m_imageMap.erase(imageIt);
+        // Add the new data to the cache
+        const ImageKey key{&*m_filenames.insert(filename).first, smooth};
+        TextureDataHolder& dataHolder = m_imageMap[key];
+        dataHolder.filename = filename;
+        dataHolder.users = 1;
+        dataHolder.smooth = smooth;
+        dataHolder.data = data;
+        if (data->backendTexture)
+            dataHolder.memoryUsage = data->backendTexture->getGpuMemoryUsage() + data->backendTexture->getPixelMemoryUsage();
+
+        m_imageKeys[data.get()] = key;
+        m_memoryUsage += dataHolder.memoryUsage;
 
-        return nullptr;
+        // Loading a new image may require removing unused ones from the cache
+        enforceMemoryBudget();
+        return data;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextureManager::copyTexture(const std::shared_ptr<TextureData>& textureDataToCopy)
     {
-        // Loop all our textures to check if we already have this one
-        for (auto& dataHolder : m_imageMap)
+        const auto keyIt = m_imageKeys.find(textureDataToCopy.get());
+        if (keyIt == m_imageKeys.end())
+            throw Exception{U"Trying to copy texture data that was not loaded by the TextureManager."};
+
+        // The texture is now used at multiple places
+        ++m_imageMap[keyIt->second].users;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeTexture(const std::shared_ptr<TextureData>& textureDataToRemove)
+    {
+        const auto keyIt = m_imageKeys.find(textureDataToRemove.get());
+        if (keyIt == m_imageKeys.end())
+            throw Exception{U"Trying to remove a texture that was not loaded by the TextureManager."};
+
+        const auto imageIt = m_imageMap.find(keyIt->second);
+        TGUI_ASSERT(imageIt != m_imageMap.end(), "Every image key in TextureManager has to refer to an image");
+        if (imageIt->second.users == 0)
+            throw Exception{U"Trying to remove a texture that was not loaded by the TextureManager."};
+
+        // If this was the only place where the texture is used then either delete it or keep it in the cache
+        if (--(imageIt->second.users) == 0)
         {
-            for (auto& data : dataHolder.second)
+            if (m_memoryBudget > 0)
             {
-                // Check if the pointer points to our texture
-                if (data.data == textureDataToCopy)
-                {
-                    // The texture is now used at multiple places
-                    ++data.users;
-                    return;
-                }
+                imageIt->second.unusedImagesIt = m_unusedImages.insert(m_unusedImages.end(), &imageIt->second);
+                enforceMemoryBudget();
             }
+            else
+                removeImage(imageIt);
         }
+    }
 
-        throw Exception{U"Trying to copy texture data that was not loaded by the TextureManager."};
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setMemoryBudget(std::size_t bytes)
+    {
+        m_memoryBudget = bytes;
+
+        // Without a budget, unused images aren't kept in the cache
+        if (m_memoryBudget == 0)
+        {
+            while (!m_unusedImages.empty())
+                removeLeastRecentlyUsedImage();
+        }
+        else
+            enforceMemoryBudget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextureManager::removeTexture(const std::shared_ptr<TextureData>& textureDataToRemove)
+    std::size_t TextureManager::getMemoryBudget()
     {
-        // Loop all our textures to check which one it is
-        for (auto imageIt = m_imageMap.begin(); imageIt != m_imageMap.end(); ++imageIt)
+        return m_memoryBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureMemoryStatistics TextureManager::getMemoryStatistics()
+    {
+        TextureMemoryStatistics statistics;
+        statistics.cachedImages = m_imageMap.size();
+        statistics.unusedImages = m_unusedImages.size();
+        statistics.memoryBudget = m_memoryBudget;
+
+        for (const auto& pair : m_imageMap)
         {
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
-            {
-                // Check if the pointer points to our texture
-                if (dataIt->data == textureDataToRemove)
-                {
-                    // If this was the only place where the texture is used then delete it
-                    if (--(dataIt->users) == 0)
-                    {
-                        imageIt->second.erase(dataIt);
-                        if (imageIt->second.empty())
-                            m_imageMap.erase(imageIt);
-                    }
-
-                    return;
-                }
-            }
+            const TextureDataHolder& dataHolder = pair.second;
+            if (dataHolder.users == 0)
+                statistics.unusedMemory += dataHolder.memoryUsage;
+
+            statistics.svgRasterMemory += dataHolder.data->svgRasterMemory;
+
+            const auto& backendTexture = dataHolder.data->backendTexture;
+            if (!backendTexture)
+                continue;
+
+            const std::size_t gpuMemory = backendTexture->getGpuMemoryUsage();
+            const std::size_t pixelMemory = backendTexture->getPixelMemoryUsage();
+            statistics.gpuMemory += gpuMemory;
+            statistics.pixelMemory += pixelMemory;
+
+            // Without a mask, a copy of the pixels would need 4 bytes per pixel
+            const Vector2u size = backendTexture->getSize();
+            const std::size_t fullSize = static_cast<std::size_t>(size.x) * size.y * 4;
+            if (!backendTexture->getPixels() && (fullSize > pixelMemory))
+                statistics.pixelMemorySaved += fullSize - pixelMemory;
         }
 
-        throw Exception{U"Trying to remove a texture that was not loaded by the TextureManager."};
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getPixelMemoryUsage()
+    {
+        return getMemoryStatistics().pixelMemory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getPixelMemorySaved()
+    {
+        return getMemoryStatistics().pixelMemorySaved;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::updateMemoryUsage(const std::shared_ptr<TextureData>& textureData)
+    {
+        const auto keyIt = m_imageKeys.find(textureData.get());
+        if ((keyIt == m_imageKeys.end()) || !textureData->backendTexture)
+            return;
+
+        TextureDataHolder& dataHolder = m_imageMap[keyIt->second];
+        m_memoryUsage -= dataHolder.memoryUsage;
+        dataHolder.memoryUsage = textureData->backendTexture->getGpuMemoryUsage() + textureData->backendTexture->getPixelMemoryUsage();
+        m_memoryUsage += dataHolder.memoryUsage;
+
+        // The image may no longer fit in the budget when it uses more memory
+        enforceMemoryBudget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -155,6 +234,37 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeImage(std::unordered_map<ImageKey, TextureDataHolder, ImageKeyHash>::iterator imageIt)
+    {
+        const ImageKey key = imageIt->first;
+        m_memoryUsage -= imageIt->second.memoryUsage;
+        m_imageKeys.erase(imageIt->second.data.get());
+        m_imageMap.erase(imageIt);
+
+        // Only forget the filename when it is no longer needed for the image with the other smooth setting
+        if (m_imageMap.find({key.filename, !key.smooth}) == m_imageMap.end())
+            m_filenames.erase(m_filenames.find(*key.filename));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::enforceMemoryBudget()
+    {
+        while ((m_memoryUsage > m_memoryBudget) && !m_unusedImages.empty())
+            removeLeastRecentlyUsedImage();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeLeastRecentlyUsedImage()
+    {
+        const TextureData* textureData = m_unusedImages.front()->data.get();
+        m_unusedImages.pop_front();
+        removeImage(m_imageMap.find(m_imageKeys.at(textureData)));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,6 +54,7 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::vector<std::shared_ptr<Timer>> Timer::m_activeTimers;
+    Duration Timer::m_currentTime;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -104,21 +105,37 @@ namespace tgui
 
     void Timer::setEnabled(bool enabled)
     {
-        if (m_enabled != enabled)
+        if (m_enabled == enabled)
         {
             if (enabled)
-                m_activeTimers.push_back(shared_from_this());
-            else
-            {
-                const auto it = std::find(m_activeTimers.begin(), m_activeTimers.end(), shared_from_this());
-                if (it != m_activeTimers.end())
-                    m_activeTimers.erase(it);
-            }
+                restart();
+            return;
         }
 
         m_enabled = enabled;
         if (enabled)
-            restart();
+        {
+            m_deadline = m_currentTime + m_interval;
+            m_activeTimers.push_back(nullptr);
+            placeInHeap(shared_from_this(), m_activeTimers.size() - 1);
+            updateHeapPosition(m_heapIndex);
+        }
+        else
+        {
+            TGUI_ASSERT((m_heapIndex < m_activeTimers.size()) && (m_activeTimers[m_heapIndex].get() == this), "Enabled timer has to be in the heap");
+
+            // Keep the timer alive until the end of the function, the heap might hold the last reference to it
+            const auto self = std::move(m_activeTimers[m_heapIndex]);
+            const std::size_t index = m_heapIndex;
+            if (index + 1 < m_activeTimers.size())
+            {
+                placeInHeap(std::move(m_activeTimers.back()), index);
+                m_activeTimers.pop_back();
+                updateHeapPosition(index);
+            }
+            else
+                m_activeTimers.pop_back();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -146,31 +163,55 @@ namespace tgui
 
     void Timer::restart()
     {
-        m_remainingDuration = m_interval;
+        m_deadline = m_currentTime + m_interval;
+        if (m_enabled)
+            updateHeapPosition(m_heapIndex);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Timer::updateTime(Duration elapsedTime)
     {
-        if (m_activeTimers.empty())
+        m_currentTime = m_currentTime + elapsedTime;
+        if (m_activeTimers.empty() || (m_activeTimers[0]->m_deadline > m_currentTime))
             return false;
 
+        // Collect the expired timers first, so that each timer is triggered at most once per update (even when its interval
+        // is 0) and so that timers started by the callbacks aren't triggered yet. Only the part of the heap that contains
+        // expired timers has to be visited.
+        std::vector<std::shared_ptr<Timer>> expiredTimers;
+        std::vector<std::size_t> indicesToVisit{0};
+        while (!indicesToVisit.empty())
+        {
+            const std::size_t index = indicesToVisit.back();
+            indicesToVisit.pop_back();
+            if ((index >= m_activeTimers.size()) || (m_activeTimers[index]->m_deadline > m_currentTime))
+                continue;
+
+            expiredTimers.push_back(m_activeTimers[index]);
+            indicesToVisit.push_back(2 * index + 1);
+            indicesToVisit.push_back(2 * index + 2);
+        }
+
+        std::sort(expiredTimers.begin(), expiredTimers.end(),
+            [](const std::shared_ptr<Timer>& left, const std::shared_ptr<Timer>& right){ return left->m_deadline < right->m_deadline; });
+
         bool timerTriggered = false;
-        auto activeTimers = m_activeTimers; // The callback could start and stop timers, so we need to operate on a copy
-        for (auto& timer : activeTimers)
+        const Duration currentTime = m_currentTime;
+        for (auto& timer : expiredTimers)
         {
-            if (timer->m_remainingDuration > elapsedTime)
-                timer->m_remainingDuration -= elapsedTime;
+            // A callback of an earlier timer could have stopped or restarted this timer
+            if (!timer->m_enabled || (timer->m_deadline > currentTime))
+                continue;
+
+            // The timer is rescheduled before calling the callback, so that the callback can still change the timer
+            if (timer->m_repeats)
+                timer->restart();
             else
-            {
-                timerTriggered = true;
-                timer->m_callback();
-                timer->m_remainingDuration = timer->m_interval;
+                timer->setEnabled(false);
 
-                if (!timer->m_repeats)
-                    timer->setEnabled(false);
-            }
+            timerTriggered = true;
+            timer->m_callback();
         }
 
         return timerTriggered;
@@ -184,22 +225,63 @@ namespace tgui
         if (m_activeTimers.empty())
             return {};
 
-        // Find the timer with the smallest remaining duration
-        Duration minDuration = m_activeTimers[0]->m_remainingDuration;
-        for (std::size_t i = 1; i < m_activeTimers.size(); ++i)
+        // The timer that expires first is always at the top of the heap
+        return m_activeTimers[0]->m_deadline - m_currentTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::clearTimers()
+    {
+        for (auto& timer : m_activeTimers)
+            timer->m_enabled = false;
+
+        m_activeTimers.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::updateHeapPosition(std::size_t index)
+    {
+        auto timer = std::move(m_activeTimers[index]);
+
+        // Move the timer up if it expires before its parent
+        while (index > 0)
         {
-            if (m_activeTimers[i]->m_remainingDuration < minDuration)
-                minDuration = m_activeTimers[i]->m_remainingDuration;
+            const std::size_t parentIndex = (index - 1) / 2;
+            if (m_activeTimers[parentIndex]->m_deadline <= timer->m_deadline)
+                break;
+
+            placeInHeap(std::move(m_activeTimers[parentIndex]), index);
+            index = parentIndex;
         }
 
-        return minDuration;
+        // Move the timer down while one of its children expires earlier
+        while (true)
+        {
+            std::size_t childIndex = 2 * index + 1;
+            if (childIndex >= m_activeTimers.size())
+                break;
+
+            if ((childIndex + 1 < m_activeTimers.size()) && (m_activeTimers[childIndex + 1]->m_deadline < m_activeTimers[childIndex]->m_deadline))
+                ++childIndex;
+
+            if (timer->m_deadline <= m_activeTimers[childIndex]->m_deadline)
+                break;
+
+            placeInHeap(std::move(m_activeTimers[childIndex]), index);
+            index = childIndex;
+        }
+
+        placeInHeap(std::move(timer), index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Timer::clearTimers()
+    void Timer::placeInHeap(std::shared_ptr<Timer> timer, std::size_t index)
     {
-        m_activeTimers.clear();
+        timer->m_heapIndex = index;
+        m_activeTimers[index] = std::move(timer);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
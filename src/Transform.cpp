@@ -27,6 +27,14 @@
 #include <algorithm>
 #include <cmath>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define TGUI_TRANSFORM_SSE2
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define TGUI_TRANSFORM_NEON
+#endif
+
 #if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
     #include <numbers>
 #endif
@@ -37,8 +45,12 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    static_assert(sizeof(Vector2f) == 2 * sizeof(float), "Vector2f must consist of 2 floats to transform arrays of points");
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Transform::Transform() :
-         Transform(1, 0, 0, 0, 1, 0, 0, 0, 1)
+         Transform(1, 0, 0, 0, 1, 0)
     {
     }
 
@@ -46,26 +58,38 @@ namespace tgui
 
     Transform::Transform(float a00, float a01, float a02,
               float a10, float a11, float a12,
-              float a20, float a21, float a22)
+              float a20, float a21, float a22) :
+        Transform(a00, a01, a02, a10, a11, a12)
+    {
+        TGUI_ASSERT((a20 == 0) && (a21 == 0) && (a22 == 1), "Transform only supports affine transformations");
+        (void)a20;
+        (void)a21;
+        (void)a22;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Transform::Transform(float a00, float a01, float a02,
+              float a10, float a11, float a12) :
+        m_matrix{{a00, a10, a01, a11, a02, a12}}
     {
-        m_matrix[0] = a00; m_matrix[4] = a01; m_matrix[8]  = 0.f; m_matrix[12] = a02;
-        m_matrix[1] = a10; m_matrix[5] = a11; m_matrix[9]  = 0.f; m_matrix[13] = a12;
-        m_matrix[2] = 0.f; m_matrix[6] = 0.f; m_matrix[10] = 1.f; m_matrix[14] = 0.f;
-        m_matrix[3] = a20; m_matrix[7] = a21; m_matrix[11] = 0.f; m_matrix[15] = a22;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Transform::Transform(const std::array<float, 16>& matrix) :
-        m_matrix(matrix)
+        m_matrix{{matrix[0], matrix[1], matrix[4], matrix[5], matrix[12], matrix[13]}}
     {
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::array<float, 16>& Transform::getMatrix() const
+    std::array<float, 16> Transform::getMatrix() const
     {
-        return m_matrix;
+        return {{m_matrix[0], m_matrix[1], 0, 0,
+                 m_matrix[2], m_matrix[3], 0, 0,
+                 0,           0,           1, 0,
+                 m_matrix[4], m_matrix[5], 0, 1}};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -73,22 +97,17 @@ namespace tgui
     Transform Transform::getInverse() const
     {
         // Compute the determinant
-        const float det = m_matrix[0] * (m_matrix[15] * m_matrix[5] - m_matrix[7] * m_matrix[13])
-                        - m_matrix[1] * (m_matrix[15] * m_matrix[4] - m_matrix[7] * m_matrix[12])
-                        + m_matrix[3] * (m_matrix[13] * m_matrix[4] - m_matrix[5] * m_matrix[12]);
+        const float det = m_matrix[0] * m_matrix[3] - m_matrix[1] * m_matrix[2];
 
         // Compute the inverse if the determinant is not zero (don't use an epsilon because the determinant may *really* be tiny)
         if (det != 0.f)
         {
-            return { (m_matrix[15] * m_matrix[5] - m_matrix[7] * m_matrix[13]) / det,
-                    -(m_matrix[15] * m_matrix[4] - m_matrix[7] * m_matrix[12]) / det,
-                     (m_matrix[13] * m_matrix[4] - m_matrix[5] * m_matrix[12]) / det,
-                    -(m_matrix[15] * m_matrix[1] - m_matrix[3] * m_matrix[13]) / det,
-                     (m_matrix[15] * m_matrix[0] - m_matrix[3] * m_matrix[12]) / det,
-                    -(m_matrix[13] * m_matrix[0] - m_matrix[1] * m_matrix[12]) / det,
-                     (m_matrix[7]  * m_matrix[1] - m_matrix[3] * m_matrix[5])  / det,
-                    -(m_matrix[7]  * m_matrix[0] - m_matrix[3] * m_matrix[4])  / det,
-                     (m_matrix[5]  * m_matrix[0] - m_matrix[1] * m_matrix[4])  / det};
+            return { m_matrix[3] / det,
+                    -m_matrix[2] / det,
+                     (m_matrix[2] * m_matrix[5] - m_matrix[3] * m_matrix[4]) / det,
+                    -m_matrix[1] / det,
+                     m_matrix[0] / det,
+                    -(m_matrix[0] * m_matrix[5] - m_matrix[1] * m_matrix[4]) / det};
         }
         else
             return {};
@@ -98,8 +117,43 @@ namespace tgui
 
     Vector2f Transform::transformPoint(const Vector2f& point) const
     {
-        return {m_matrix[0] * point.x + m_matrix[4] * point.y + m_matrix[12],
-                m_matrix[1] * point.x + m_matrix[5] * point.y + m_matrix[13]};
+        return {m_matrix[0] * point.x + m_matrix[2] * point.y + m_matrix[4],
+                m_matrix[1] * point.x + m_matrix[3] * point.y + m_matrix[5]};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Transform::transformPoints(const Vector2f* points, Vector2f* result, std::size_t count) const
+    {
+        std::size_t i = 0;
+
+#if defined(TGUI_TRANSFORM_SSE2)
+        // Two points are transformed at once, each register contains {x0, y0, x1, y1}
+        const __m128 column0 = _mm_setr_ps(m_matrix[0], m_matrix[1], m_matrix[0], m_matrix[1]);
+        const __m128 column1 = _mm_setr_ps(m_matrix[2], m_matrix[3], m_matrix[2], m_matrix[3]);
+        const __m128 column2 = _mm_setr_ps(m_matrix[4], m_matrix[5], m_matrix[4], m_matrix[5]);
+        for (; i + 2 <= count; i += 2)
+        {
+            const __m128 pointPair = _mm_loadu_ps(&points[i].x);
+            const __m128 x = _mm_shuffle_ps(pointPair, pointPair, _MM_SHUFFLE(2, 2, 0, 0));
+            const __m128 y = _mm_shuffle_ps(pointPair, pointPair, _MM_SHUFFLE(3, 3, 1, 1));
+            _mm_storeu_ps(&result[i].x, _mm_add_ps(_mm_add_ps(_mm_mul_ps(column0, x), _mm_mul_ps(column1, y)), column2));
+        }
+#elif defined(TGUI_TRANSFORM_NEON)
+        const float32x4_t column0 = {m_matrix[0], m_matrix[1], m_matrix[0], m_matrix[1]};
+        const float32x4_t column1 = {m_matrix[2], m_matrix[3], m_matrix[2], m_matrix[3]};
+        const float32x4_t column2 = {m_matrix[4], m_matrix[5], m_matrix[4], m_matrix[5]};
+        for (; i + 2 <= count; i += 2)
+        {
+            const float32x4_t pointPair = vld1q_f32(&points[i].x);
+            const float32x4_t x = vtrn1q_f32(pointPair, pointPair);
+            const float32x4_t y = vtrn2q_f32(pointPair, pointPair);
+            vst1q_f32(&result[i].x, vaddq_f32(vaddq_f32(vmulq_f32(column0, x), vmulq_f32(column1, y)), column2));
+        }
+#endif
+
+        for (; i < count; ++i)
+            result[i] = transformPoint(points[i]);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -107,13 +161,14 @@ namespace tgui
     FloatRect Transform::transformRect(const FloatRect& rectangle) const
     {
         // Transform the 4 corners of the rectangle
-        const Vector2f points[] =
+        Vector2f points[] =
         {
-            transformPoint({rectangle.left, rectangle.top}),
-            transformPoint({rectangle.left, rectangle.top + rectangle.height}),
-            transformPoint({rectangle.left + rectangle.width, rectangle.top}),
-            transformPoint({rectangle.left + rectangle.width, rectangle.top + rectangle.height})
+            {rectangle.left, rectangle.top},
+            {rectangle.left, rectangle.top + rectangle.height},
+            {rectangle.left + rectangle.width, rectangle.top},
+            {rectangle.left + rectangle.width, rectangle.top + rectangle.height}
         };
+        transformPoints(points, points, 4);
 
         // Compute the bounding rectangle of the transformed points
         const float left = std::min({points[0].x, points[1].x, points[2].x, points[3].x});
@@ -131,15 +186,31 @@ namespace tgui
         const auto& a = m_matrix;
         const auto& b = other.m_matrix;
 
-        *this = Transform(a[0] * b[0]  + a[4] * b[1]  + a[12] * b[3],
-                          a[0] * b[4]  + a[4] * b[5]  + a[12] * b[7],
-                          a[0] * b[12] + a[4] * b[13] + a[12] * b[15],
-                          a[1] * b[0]  + a[5] * b[1]  + a[13] * b[3],
-                          a[1] * b[4]  + a[5] * b[5]  + a[13] * b[7],
-                          a[1] * b[12] + a[5] * b[13] + a[13] * b[15],
-                          a[3] * b[0]  + a[7] * b[1]  + a[15] * b[3],
-                          a[3] * b[4]  + a[7] * b[5]  + a[15] * b[7],
-                          a[3] * b[12] + a[7] * b[13] + a[15] * b[15]);
+        // The translation is calculated first, as the other columns are overwritten afterwards (and other could be *this)
+        const float translationX = a[0] * b[4] + a[2] * b[5] + a[4];
+        const float translationY = a[1] * b[4] + a[3] * b[5] + a[5];
+
+#if defined(TGUI_TRANSFORM_SSE2)
+        // Calculate the first two columns at once: {a00 * b00 + a01 * b10, a10 * b00 + a11 * b10, a00 * b01 + a01 * b11, ...}
+        const __m128 columnsA = _mm_loadu_ps(a.data());
+        const __m128 columnsB = _mm_loadu_ps(b.data());
+        const __m128 column0A = _mm_movelh_ps(columnsA, columnsA);
+        const __m128 column1A = _mm_movehl_ps(columnsA, columnsA);
+        const __m128 row0B = _mm_shuffle_ps(columnsB, columnsB, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 row1B = _mm_shuffle_ps(columnsB, columnsB, _MM_SHUFFLE(3, 3, 1, 1));
+        _mm_storeu_ps(m_matrix.data(), _mm_add_ps(_mm_mul_ps(column0A, row0B), _mm_mul_ps(column1A, row1B)));
+#else
+        const float a00 = a[0] * b[0] + a[2] * b[1];
+        const float a10 = a[1] * b[0] + a[3] * b[1];
+        const float a01 = a[0] * b[2] + a[2] * b[3];
+        const float a11 = a[1] * b[2] + a[3] * b[3];
+        m_matrix[0] = a00;
+        m_matrix[1] = a10;
+        m_matrix[2] = a01;
+        m_matrix[3] = a11;
+#endif
+        m_matrix[4] = translationX;
+        m_matrix[5] = translationY;
         return *this;
     }
 
@@ -147,9 +218,10 @@ namespace tgui
 
     Transform& Transform::translate(const Vector2f& offset)
     {
-        return combine({1, 0, offset.x,
-                        0, 1, offset.y,
-                        0, 0, 1});
+        // Equivalent to combining with a translation matrix, but only the last column changes
+        m_matrix[4] = m_matrix[0] * offset.x + m_matrix[2] * offset.y + m_matrix[4];
+        m_matrix[5] = m_matrix[1] * offset.x + m_matrix[3] * offset.y + m_matrix[5];
+        return *this;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -165,8 +237,7 @@ namespace tgui
         const float cos = std::cos(rad);
         const float sin = std::sin(rad);
         return combine({cos, -sin, center.x * (1 - cos) + center.y * sin,
-                        sin,  cos, center.y * (1 - cos) - center.x * sin,
-                        0,    0,   1});
+                        sin,  cos, center.y * (1 - cos) - center.x * sin});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -174,8 +245,7 @@ namespace tgui
     Transform& Transform::scale(const Vector2f& factors, const Vector2f& center)
     {
         return combine({factors.x, 0,      center.x * (1 - factors.x),
-                        0,      factors.y, center.y * (1 - factors.y),
-                        0,      0,      1});
+                        0,      factors.y, center.y * (1 - factors.y)});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -203,8 +273,8 @@ namespace tgui
 
     void Transform::roundPosition(float pixelScaleX, float pixelScaleY)
     {
-        m_matrix[12] = std::round(m_matrix[12] * pixelScaleX) / pixelScaleX;
-        m_matrix[13] = std::round(m_matrix[13] * pixelScaleY) / pixelScaleY;
+        m_matrix[4] = std::round(m_matrix[4] * pixelScaleX) / pixelScaleX;
+        m_matrix[5] = std::round(m_matrix[5] * pixelScaleY) / pixelScaleY;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -39,25 +39,21 @@ namespace tgui
 
     namespace
     {
-        void finishExistingConflictingAnimations(std::vector<std::unique_ptr<priv::Animation>>& animations, ShowEffectType type)
+        void finishExistingConflictingAnimations(priv::AnimationEngine* animationEngine, const Widget* widget, ShowEffectType type)
         {
+            if (!animationEngine)
+                return;
+
             // Only one animation of each type can be played at the same type. If e.g. a fade animation was already in progress
             // when starting a new one, the old animation is finished immediately.
             // Different types of animations (e.g. fading and moving) can occur at the same time.
-            auto animIt = animations.begin();
-            while (animIt != animations.end())
-            {
-                auto& animation = *animIt;
-                if (((type == ShowEffectType::Fade) && (animation->getType() == AnimationType::Opacity))
-                 || ((type == ShowEffectType::Scale) && (animation->getType() == AnimationType::Resize))
-                 || ((type != ShowEffectType::Fade) && (animation->getType() == AnimationType::Move)))
-                {
-                    animation->finish();
-                    animIt = animations.erase(animIt);
-                }
-                else
-                    ++animIt;
-            }
+            // Move animations are finished first, as the scale effect restores the position when its resize animation finishes.
+            if (type != ShowEffectType::Fade)
+                animationEngine->finishAnimations(widget, AnimationType::Move);
+            if (type == ShowEffectType::Scale)
+                animationEngine->finishAnimations(widget, AnimationType::Resize);
+            if (type == ShowEffectType::Fade)
+                animationEngine->finishAnimations(widget, AnimationType::Opacity);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -149,13 +145,21 @@ namespace tgui
         if (m_renderer)
             m_renderer->unsubscribe(this);
 
-        for (auto& layout : m_boundPositionLayouts)
-            layout->unbindWidget();
+        WidgetRenderer::removePendingChanges(this);
 
-        for (auto& layout : m_boundSizeLayouts)
-            layout->unbindWidget();
+        if (m_rarelyUsedData)
+        {
+            for (auto& layout : m_rarelyUsedData->boundPositionLayouts)
+                layout->unbindWidget();
+
+            for (auto& layout : m_rarelyUsedData->boundSizeLayouts)
+                layout->unbindWidget();
+        }
 
         SignalManager::getSignalManager()->remove(this);
+
+        if (m_parent && m_parent->m_animations)
+            m_parent->m_animations->removeAnimations(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -168,21 +172,16 @@ namespace tgui
         m_size                         {other.m_size},
         m_textSize                     {other.m_textSize},
         m_origin                       {other.m_origin},
-        m_rotationOrigin               {other.m_rotationOrigin},
-        m_scaleOrigin                  {other.m_scaleOrigin},
         m_scaleFactors                 {other.m_scaleFactors},
         m_rotationDeg                  {other.m_rotationDeg},
-        m_boundPositionLayouts         {},
-        m_boundSizeLayouts             {},
         m_enabled                      {other.m_enabled},
         m_visible                      {other.m_visible},
         m_parent                       {nullptr},
         m_parentGui                    {nullptr},
         m_draggableWidget              {other.m_draggableWidget},
         m_containerWidget              {other.m_containerWidget},
-        m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
-        m_showAnimations               {},
+        m_animations                   {},
         m_fontCached                   {other.m_fontCached},
         m_opacityCached                {other.m_opacityCached},
         m_textSizeCached               {other.m_textSizeCached},
@@ -193,6 +192,8 @@ namespace tgui
         m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
+        copyRarelyUsedData(other);
+
         m_renderer->subscribe(this);
     }
 
@@ -212,12 +213,8 @@ namespace tgui
         m_size                         {std::move(other.m_size)},
         m_textSize                     {std::move(other.m_textSize)},
         m_origin                       {std::move(other.m_origin)},
-        m_rotationOrigin               {std::move(other.m_rotationOrigin)},
-        m_scaleOrigin                  {std::move(other.m_scaleOrigin)},
         m_scaleFactors                 {std::move(other.m_scaleFactors)},
         m_rotationDeg                  {std::move(other.m_rotationDeg)},
-        m_boundPositionLayouts         {std::move(other.m_boundPositionLayouts)},
-        m_boundSizeLayouts             {std::move(other.m_boundSizeLayouts)},
         m_enabled                      {std::move(other.m_enabled)},
         m_visible                      {std::move(other.m_visible)},
         m_parent                       {nullptr},
@@ -228,13 +225,13 @@ namespace tgui
         m_animationTimeElapsed         {std::move(other.m_animationTimeElapsed)},
         m_draggableWidget              {std::move(other.m_draggableWidget)},
         m_containerWidget              {std::move(other.m_containerWidget)},
-        m_toolTip                      {std::move(other.m_toolTip)},
         m_renderer                     {other.m_renderer},
-        m_showAnimations               {std::move(other.m_showAnimations)},
+        m_animations                   {std::move(other.m_animations)},
         m_fontCached                   {std::move(other.m_fontCached)},
         m_opacityCached                {std::move(other.m_opacityCached)},
         m_textSizeCached               {std::move(other.m_textSizeCached)},
-        m_mouseCursor                  {std::move(other.m_mouseCursor)}
+        m_mouseCursor                  {std::move(other.m_mouseCursor)},
+        m_rarelyUsedData               {std::move(other.m_rarelyUsedData)}
     {
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -246,6 +243,10 @@ namespace tgui
 
         other.m_renderer = nullptr;
 
+        // Animations that were playing on the other widget itself are not taken over
+        if (m_animations)
+            m_animations->removeAnimations(&other);
+
         if (other.m_parent)
             other.m_parent->remove(other.shared_from_this());
     }
@@ -267,7 +268,8 @@ namespace tgui
             onMouseEnter.disconnectAll();
             onMouseLeave.disconnectAll();
 
-            m_showAnimations.clear();
+            if (m_animations)
+                m_animations->removeAnimations(this);
 
             m_type                 = other.m_type;
             m_name                 = other.m_name;
@@ -275,12 +277,8 @@ namespace tgui
             m_size                 = other.m_size;
             m_textSize             = other.m_textSize;
             m_origin               = other.m_origin;
-            m_rotationOrigin       = other.m_rotationOrigin;
-            m_scaleOrigin          = other.m_scaleOrigin;
             m_scaleFactors         = other.m_scaleFactors;
             m_rotationDeg          = other.m_rotationDeg;
-            m_boundPositionLayouts = {};
-            m_boundSizeLayouts     = {};
             m_enabled              = other.m_enabled;
             m_visible              = other.m_visible;
             m_parent               = nullptr;
@@ -291,13 +289,14 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_draggableWidget      = other.m_draggableWidget;
             m_containerWidget      = other.m_containerWidget;
-            m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
             m_renderer             = other.m_renderer;
             m_fontCached           = other.m_fontCached;
             m_opacityCached        = other.m_opacityCached;
             m_textSizeCached       = other.m_textSizeCached;
             m_mouseCursor          = other.m_mouseCursor;
 
+            copyRarelyUsedData(other);
+
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
             m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
@@ -330,12 +329,8 @@ namespace tgui
             m_size                 = std::move(other.m_size);
             m_textSize             = std::move(other.m_textSize);
             m_origin               = std::move(other.m_origin);
-            m_rotationOrigin       = std::move(other.m_rotationOrigin);
-            m_scaleOrigin          = std::move(other.m_scaleOrigin);
             m_scaleFactors         = std::move(other.m_scaleFactors);
             m_rotationDeg          = std::move(other.m_rotationDeg);
-            m_boundPositionLayouts = std::move(other.m_boundPositionLayouts);
-            m_boundSizeLayouts     = std::move(other.m_boundSizeLayouts);
             m_enabled              = std::move(other.m_enabled);
             m_visible              = std::move(other.m_visible);
             m_parent               = nullptr;
@@ -346,9 +341,9 @@ namespace tgui
             m_animationTimeElapsed = std::move(other.m_animationTimeElapsed);
             m_draggableWidget      = std::move(other.m_draggableWidget);
             m_containerWidget      = std::move(other.m_containerWidget);
-            m_toolTip              = std::move(other.m_toolTip);
             m_renderer             = std::move(other.m_renderer);
-            m_showAnimations       = std::move(other.m_showAnimations);
+            m_animations           = std::move(other.m_animations);
+            m_rarelyUsedData       = std::move(other.m_rarelyUsedData);
             m_fontCached           = std::move(other.m_fontCached);
             m_opacityCached        = std::move(other.m_opacityCached);
             m_textSizeCached       = std::move(other.m_textSizeCached);
@@ -361,6 +356,10 @@ namespace tgui
 
             m_renderer->subscribe(this);
 
+            // Animations that were playing on the other widget itself are not taken over
+            if (m_animations)
+                m_animations->removeAnimations(&other);
+
             if (other.m_parent)
                 SignalManager::getSignalManager()->remove(&other);
 
@@ -467,41 +466,15 @@ namespace tgui
         m_renderer->subscribe(this);
         rendererData->shared = true;
 
-        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value
-        auto oldIt = oldData->propertyValuePairs.begin();
-        auto newIt = rendererData->propertyValuePairs.begin();
-        while (oldIt != oldData->propertyValuePairs.end() && newIt != rendererData->propertyValuePairs.end())
-        {
-            if (oldIt->first < newIt->first)
-            {
-                // Update values that no longer exist in the new renderer and are now reset to the default value
-                rendererChanged(oldIt->first);
-                ++oldIt;
-            }
-            else
-            {
-                // Update changed and new properties
-                rendererChanged(newIt->first);
+        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value.
+        // All properties are passed at once, so that the widget only has to recalculate its layout a single time.
+        RendererPropertyMask changedProperties;
+        for (const RendererPropertyId id : oldData->propertyValuePairs.getIds())
+            changedProperties.set(id);
+        for (const RendererPropertyId id : rendererData->propertyValuePairs.getIds())
+            changedProperties.set(id);
 
-                if (newIt->first < oldIt->first)
-                    ++newIt;
-                else
-                {
-                    ++oldIt;
-                    ++newIt;
-                }
-            }
-        }
-        while (oldIt != oldData->propertyValuePairs.end())
-        {
-            rendererChanged(oldIt->first);
-            ++oldIt;
-        }
-        while (newIt != rendererData->propertyValuePairs.end())
-        {
-            rendererChanged(newIt->first);
-            ++newIt;
-        }
+        rendererPropertiesChanged(changedProperties);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -546,10 +519,10 @@ namespace tgui
             m_prevPosition = getPosition();
             onPositionChange.emit(this, getPosition());
 
-            // Update the connected layouts, but make a copy of the set before iterating over it to prevent issues
-            // with the list being changed during the loop if some layout gets copied in a called setSize or setPosition function.
-            for (auto* layout : std::unordered_set<Layout*>(m_boundPositionLayouts))
-                layout->recalculateValue();
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
+            recalculateBoundPositionLayouts();
         }
     }
 
@@ -566,18 +539,17 @@ namespace tgui
             m_prevSize = getSize();
             onSizeChange.emit(this, getSize());
 
-            // Update the connected layouts, but make a copy of the set before iterating over it to prevent issues
-            // with the list being changed during the loop if some layout gets copied in a called setSize or setPosition function.
-            for (auto* layout : std::unordered_set<Layout*>(m_boundSizeLayouts))
-                layout->recalculateValue();
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
+            recalculateBoundSizeLayouts();
 
             // If the origin isn't in the top left then changing the size also changes the position of the widget.
             // Note that getPosition() will still return the same value (hence we don't trigger onPositionChange), but if a
             // layout was bound the the left or top of the widget as opposed to the X/Y coordinate then it needs to be recalculated.
             if ((m_origin.x != 0) || (m_origin.y != 0))
             {
-                for (auto* layout : std::unordered_set<Layout*>(m_boundPositionLayouts))
-                    layout->recalculateValue();
+                recalculateBoundPositionLayouts();
             }
         }
     }
@@ -628,6 +600,9 @@ namespace tgui
     void Widget::setOrigin(Vector2f origin)
     {
         m_origin = origin;
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -635,7 +610,11 @@ namespace tgui
     void Widget::setScale(Vector2f scaleFactors)
     {
         m_scaleFactors = scaleFactors;
-        m_scaleOrigin.reset();
+        if (m_rarelyUsedData)
+            m_rarelyUsedData->scaleOrigin.reset();
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -643,15 +622,18 @@ namespace tgui
     void Widget::setScale(Vector2f scaleFactors, Vector2f origin)
     {
         m_scaleFactors = scaleFactors;
-        m_scaleOrigin = origin;
+        getRarelyUsedData().scaleOrigin = origin;
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2f Widget::getScaleOrigin() const
     {
-        if (m_scaleOrigin)
-            return *m_scaleOrigin;
+        if (m_rarelyUsedData && m_rarelyUsedData->scaleOrigin)
+            return *m_rarelyUsedData->scaleOrigin;
         else
             return m_origin;
     }
@@ -661,7 +643,11 @@ namespace tgui
     void Widget::setRotation(float angle)
     {
         m_rotationDeg = angle;
-        m_rotationOrigin.reset();
+        if (m_rarelyUsedData)
+            m_rarelyUsedData->rotationOrigin.reset();
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -669,22 +655,25 @@ namespace tgui
     void Widget::setRotation(float angle, Vector2f origin)
     {
         m_rotationDeg = angle;
-        m_rotationOrigin = origin;
+        getRarelyUsedData().rotationOrigin = origin;
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2f Widget::getRotationOrigin() const
     {
-        if (m_rotationOrigin)
-            return *m_rotationOrigin;
+        if (m_rarelyUsedData && m_rarelyUsedData->rotationOrigin)
+            return *m_rarelyUsedData->rotationOrigin;
         else
             return m_origin;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::showWithEffect(ShowEffectType type, Duration duration)
+    void Widget::showWithEffect(ShowEffectType type, Duration duration, EasingType easing)
     {
         setVisible(true);
 
@@ -695,7 +684,7 @@ namespace tgui
         //const Vector2f startPosition = getPosition();
         //const Vector2f startSize = getSize();
 
-        finishExistingConflictingAnimations(m_showAnimations, type);
+        finishExistingConflictingAnimations(getAnimationEngine(false), this, type);
 
         switch (type)
         {
@@ -712,36 +701,36 @@ namespace tgui
                 else // If fading was already in progress then adapt the duration to finish the animation sooner
                     duration *= (startOpacity / endOpacity);
 
-                m_showAnimations.push_back(std::make_unique<priv::FadeAnimation>(shared_from_this(), animStartOpacity, endOpacity, duration,
+                getAnimationEngine(true)->addFadeAnimation(this, animStartOpacity, endOpacity, duration, easing,
                     TGUI_LAMBDA_CAPTURE_EQ_THIS{
                         onAnimationFinish.emit(this, AnimationType::Opacity);
                         onShowEffectFinish.emit(this, type, true);
                     }
-                ));
+                );
                 break;
             }
             case ShowEffectType::Scale:
             {
                 // TODO: Use setScale instead of setSize
-                m_showAnimations.push_back(std::make_unique<priv::MoveAnimation>(shared_from_this(), getPosition() + (getSize() / 2.f), m_position, duration));
-                m_showAnimations.push_back(std::make_unique<priv::ResizeAnimation>(shared_from_this(), Vector2f{0, 0}, m_size, duration,
+                getAnimationEngine(true)->addMoveAnimation(this, getPosition() + (getSize() / 2.f), m_position, duration, easing);
+                getAnimationEngine(true)->addResizeAnimation(this, Vector2f{0, 0}, m_size, duration, easing,
                     TGUI_LAMBDA_CAPTURE_EQ_THIS{
                         onAnimationFinish.emit(this, AnimationType::Resize);
                         onShowEffectFinish.emit(this, type, true);
                     }
-                ));
+                );
                 setPosition(getPosition() + (getSize() / 2.f));
                 setSize(0, 0);
                 break;
             }
             case ShowEffectType::SlideFromLeft:
             {
-                m_showAnimations.push_back(std::make_unique<priv::MoveAnimation>(shared_from_this(), Vector2f{-getFullSize().x, getPosition().y}, m_position, duration,
+                getAnimationEngine(true)->addMoveAnimation(this, Vector2f{-getFullSize().x, getPosition().y}, m_position, duration, easing,
                     TGUI_LAMBDA_CAPTURE_EQ_THIS{
                         onAnimationFinish.emit(this, AnimationType::Move);
                         onShowEffectFinish.emit(this, type, true);
                     }
-                ));
+                );
                 setPosition({-getFullSize().x, getPosition().y});
                 break;
             }
@@ -749,12 +738,12 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    m_showAnimations.push_back(std::make_unique<priv::MoveAnimation>(shared_from_this(), Vector2f{getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, m_position, duration,
+                    getAnimationEngine(true)->addMoveAnimation(this, Vector2f{getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, m_position, duration, easing,
                         TGUI_LAMBDA_CAPTURE_EQ_THIS{
                             onAnimationFinish.emit(this, AnimationType::Move);
                             onShowEffectFinish.emit(this, type, true);
                         }
-                    ));
+                    );
                     setPosition({getParent()->getSize().x + getWidgetOffset().x, getPosition().y});
                 }
                 else
@@ -766,12 +755,12 @@ namespace tgui
             }
             case ShowEffectType::SlideFromTop:
             {
-                m_showAnimations.push_back(std::make_unique<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, -getFullSize().y}, m_position, duration,
+                getAnimationEngine(true)->addMoveAnimation(this, Vector2f{getPosition().x, -getFullSize().y}, m_position, duration, easing,
                     TGUI_LAMBDA_CAPTURE_EQ_THIS{
                         onAnimationFinish.emit(this, AnimationType::Move);
                         onShowEffectFinish.emit(this, type, true);
                     }
-                ));
+                );
                 setPosition({getPosition().x, -getFullSize().y});
                 break;
             }
@@ -779,12 +768,12 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    m_showAnimations.push_back(std::make_unique<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, m_position, duration,
+                    getAnimationEngine(true)->addMoveAnimation(this, Vector2f{getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, m_position, duration, easing,
                         TGUI_LAMBDA_CAPTURE_EQ_THIS{
                             onAnimationFinish.emit(this, AnimationType::Move);
                             onShowEffectFinish.emit(this, type, true);
                         }
-                    ));
+                    );
                     setPosition({getPosition().x, getParent()->getSize().y + getWidgetOffset().y});
                 }
                 else
@@ -799,7 +788,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::hideWithEffect(ShowEffectType type, Duration duration)
+    void Widget::hideWithEffect(ShowEffectType type, Duration duration, EasingType easing)
     {
         // We store the state the widget is currently in. In the event another animation was already playing, we should try to
         // use the current state to start our animation at, but this is not the state that the widget should end at. We must
@@ -808,7 +797,7 @@ namespace tgui
         //const Vector2f startPosition = getPosition();
         //const Vector2f startSize = getSize();
 
-        finishExistingConflictingAnimations(m_showAnimations, type);
+        finishExistingConflictingAnimations(getAnimationEngine(false), this, type);
 
         const Vector2f position = getPosition();
         const Layout2d positionLayout = m_position;
@@ -823,14 +812,14 @@ namespace tgui
                 if (startOpacity != endOpacity)
                     duration *= (startOpacity / endOpacity);
 
-                m_showAnimations.push_back(std::make_unique<priv::FadeAnimation>(shared_from_this(), startOpacity, 0.f, duration,
+                getAnimationEngine(true)->addFadeAnimation(this, startOpacity, 0.f, duration, easing,
                     TGUI_LAMBDA_CAPTURE_EQ_THIS{
                         setVisible(false);
                         setInheritedOpacity(endOpacity);
                         onAnimationFinish.emit(this, AnimationType::Opacity);
                         onShowEffectFinish.emit(this, type, false);
                     }
-                ));
+                );
                 break;
             }
             case ShowEffectType::Scale:
@@ -838,8 +827,8 @@ namespace tgui
                 // TODO: Use setScale instead of setSize
                 const Vector2f size = getSize();
                 const Layout2d sizeLayout = m_size;
-                m_showAnimations.push_back(std::make_unique<priv::MoveAnimation>(shared_from_this(), position, position + (size / 2.f), duration));
-                m_showAnimations.push_back(std::make_unique<priv::ResizeAnimation>(shared_from_this(), size, Vector2f{0, 0}, duration,
+                getAnimationEngine(true)->addMoveAnimation(this, position, position + (size / 2.f), duration, easing);
+                getAnimationEngine(true)->addResizeAnimation(this, size, Vector2f{0, 0}, duration, easing,
                     TGUI_LAMBDA_CAPTURE_EQ_THIS{
                         setVisible(false);
                         setPosition(positionLayout);
@@ -847,21 +836,21 @@ namespace tgui
                         onAnimationFinish.emit(this, AnimationType::Resize);
                         onShowEffectFinish.emit(this, type, false);
                     }
-                ));
+                );
                 break;
             }
             case ShowEffectType::SlideToRight:
             {
                 if (getParent())
                 {
-                    m_showAnimations.push_back(std::make_unique<priv::MoveAnimation>(shared_from_this(), position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration,
+                    getAnimationEngine(true)->addMoveAnimation(this, position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration, easing,
                         TGUI_LAMBDA_CAPTURE_EQ_THIS{
                             setVisible(false);
                             setPosition(positionLayout);
                             onAnimationFinish.emit(this, AnimationType::Move);
                             onShowEffectFinish.emit(this, type, false);
                         }
-                    ));
+                    );
                 }
                 else
                 {
@@ -872,28 +861,28 @@ namespace tgui
             }
             case ShowEffectType::SlideToLeft:
             {
-                m_showAnimations.push_back(std::make_unique<priv::MoveAnimation>(shared_from_this(), position, Vector2f{-getFullSize().x, position.y}, duration,
+                getAnimationEngine(true)->addMoveAnimation(this, position, Vector2f{-getFullSize().x, position.y}, duration, easing,
                     TGUI_LAMBDA_CAPTURE_EQ_THIS{
                         setVisible(false);
                         setPosition(positionLayout);
                         onAnimationFinish.emit(this, AnimationType::Move);
                         onShowEffectFinish.emit(this, type, false);
                     }
-                ));
+                );
                 break;
             }
             case ShowEffectType::SlideToBottom:
             {
                 if (getParent())
                 {
-                    m_showAnimations.push_back(std::make_unique<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration,
+                    getAnimationEngine(true)->addMoveAnimation(this, position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration, easing,
                         TGUI_LAMBDA_CAPTURE_EQ_THIS{
                             setVisible(false);
                             setPosition(positionLayout);
                             onAnimationFinish.emit(this, AnimationType::Move);
                             onShowEffectFinish.emit(this, type, false);
                         }
-                    ));
+                    );
                 }
                 else
                 {
@@ -904,14 +893,14 @@ namespace tgui
             }
             case ShowEffectType::SlideToTop:
             {
-                m_showAnimations.push_back(std::make_unique<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, -getFullSize().y}, duration,
+                getAnimationEngine(true)->addMoveAnimation(this, position, Vector2f{position.x, -getFullSize().y}, duration, easing,
                     TGUI_LAMBDA_CAPTURE_EQ_THIS{
                         setVisible(false);
                         setPosition(positionLayout);
                         onAnimationFinish.emit(this, AnimationType::Move);
                         onShowEffectFinish.emit(this, type, false);
                     }
-                ));
+                );
                 break;
             }
         }
@@ -919,26 +908,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::moveWithAnimation(Layout2d position, Duration duration)
+    void Widget::moveWithAnimation(Layout2d position, Duration duration, EasingType easing)
     {
         position.x.connectWidget(this, true, nullptr);
         position.y.connectWidget(this, false, nullptr);
 
-        m_showAnimations.push_back(std::make_unique<priv::MoveAnimation>(shared_from_this(), getPosition(), position, duration,
+        getAnimationEngine(true)->addMoveAnimation(this, getPosition(), position, duration, easing,
             [this]{ onAnimationFinish.emit(this, AnimationType::Move); }
-        ));
+        );
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::resizeWithAnimation(Layout2d size, Duration duration)
+    void Widget::resizeWithAnimation(Layout2d size, Duration duration, EasingType easing)
     {
         size.x.connectWidget(this, true, nullptr);
         size.y.connectWidget(this, false, nullptr);
 
-        m_showAnimations.push_back(std::make_unique<priv::ResizeAnimation>(shared_from_this(), getSize(), size, duration,
+        getAnimationEngine(true)->addResizeAnimation(this, getSize(), size, duration, easing,
             [this]{ onAnimationFinish.emit(this, AnimationType::Resize); }
-        ));
+        );
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1018,7 +1007,8 @@ namespace tgui
 
     bool Widget::isAnimationPlaying() const
     {
-        return !m_showAnimations.empty();
+        const auto& animationEngine = m_parent ? m_parent->m_animations : m_animations;
+        return animationEngine && animationEngine->hasAnimations(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1092,14 +1082,15 @@ namespace tgui
 
     void Widget::setToolTip(Widget::Ptr toolTip)
     {
-        m_toolTip = std::move(toolTip);
+        if (toolTip || m_rarelyUsedData)
+            getRarelyUsedData().toolTip = std::move(toolTip);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Widget::getToolTip() const
     {
-        return m_toolTip;
+        return m_rarelyUsedData ? m_rarelyUsedData->toolTip : nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1108,9 +1099,11 @@ namespace tgui
     {
         if (m_name != name)
         {
-            m_name = name;
+            const String oldName = std::exchange(m_name, name);
             if (m_parent)
             {
+                m_parent->widgetNameChanged(this, oldName);
+
                 SignalManager::getSignalManager()->remove(this);
                 SignalManager::getSignalManager()->add(shared_from_this());
             }
@@ -1159,10 +1152,9 @@ namespace tgui
 
     void Widget::finishAllAnimations()
     {
-        for (auto& animation : m_showAnimations)
-            animation->finish();
-
-        m_showAnimations.clear();
+        priv::AnimationEngine* animationEngine = getAnimationEngine(false);
+        if (animationEngine)
+            animationEngine->finishAllAnimations(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1215,7 +1207,11 @@ namespace tgui
         else if (!m_parent)
             SignalManager::getSignalManager()->add(shared_from_this());
 
+        // Animations that are still playing are continued by the engine of the new parent
+        priv::AnimationEngine* oldAnimationEngine = getAnimationEngine(false);
         m_parent = parent;
+        if (oldAnimationEngine && oldAnimationEngine->hasAnimations(this))
+            oldAnimationEngine->moveAnimations(this, *getAnimationEngine(true));
 
         // Give the layouts another chance to find widgets to which it refers
         if (parent)
@@ -1233,16 +1229,25 @@ namespace tgui
     {
         m_animationTimeElapsed += elapsedTime;
 
-        const bool screenRefreshRequired = !m_showAnimations.empty();
-        for (auto it = m_showAnimations.begin(); it != m_showAnimations.end();)
-        {
-            if ((*it)->update(elapsedTime))
-                it = m_showAnimations.erase(it);
-            else
-                ++it;
-        }
+        // When the parent is updating all its children, it already played the animations of all of them at once
+        priv::AnimationEngine* animationEngine = getAnimationEngine(false);
+        if (!animationEngine || animationEngine->empty() || animationEngine->isBatchUpdateActive())
+            return false;
+
+        // The callbacks of finished animations could remove the last reference to this widget
+        const auto keepAlive = shared_from_this();
+        return animationEngine->update(elapsedTime, this, this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Optional<Duration> Widget::getTimeUntilNextUpdate() const
+    {
+        // When the widget has a parent, its animations are played by the parent
+        if (!m_parent && m_animations && m_animations->hasPlayingAnimations(this))
+            return Duration{};
 
-        return screenRefreshRequired;
+        return {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1343,7 +1348,7 @@ namespace tgui
 
     Widget::Ptr Widget::askToolTip(Vector2f mousePos)
     {
-        if (m_toolTip && isMouseOnWidget(mousePos))
+        if (m_rarelyUsedData && m_rarelyUsedData->toolTip && isMouseOnWidget(mousePos))
             return getToolTip();
         else
             return nullptr;
@@ -1353,28 +1358,120 @@ namespace tgui
 
     void Widget::bindPositionLayout(Layout* layout)
     {
-        m_boundPositionLayouts.insert(layout);
+        getRarelyUsedData().boundPositionLayouts.insert(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::unbindPositionLayout(Layout* layout)
     {
-        m_boundPositionLayouts.erase(layout);
+        if (m_rarelyUsedData)
+            m_rarelyUsedData->boundPositionLayouts.erase(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::bindSizeLayout(Layout* layout)
     {
-        m_boundSizeLayouts.insert(layout);
+        getRarelyUsedData().boundSizeLayouts.insert(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::unbindSizeLayout(Layout* layout)
     {
-        m_boundSizeLayouts.erase(layout);
+        if (m_rarelyUsedData)
+            m_rarelyUsedData->boundSizeLayouts.erase(layout);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isLayoutUpdatePending() const
+    {
+        return m_position.x.isUpdatePending() || m_position.y.isUpdatePending()
+            || m_size.x.isUpdatePending() || m_size.y.isUpdatePending();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::applyPendingLayoutUpdate()
+    {
+        // The size is updated first as the position can depend on it when the origin isn't in the top left corner.
+        // Calling setSize or setPosition clears the pending state of both layouts on the same axis pair.
+        m_size.x.applyPendingUpdate();
+        m_size.y.applyPendingUpdate();
+        m_position.x.applyPendingUpdate();
+        m_position.y.applyPendingUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::getLayoutDependents(std::vector<Widget*>& dependents) const
+    {
+        if (!m_rarelyUsedData)
+            return;
+
+        for (const auto* layout : m_rarelyUsedData->boundPositionLayouts)
+        {
+            Widget* dependent = layout->getConnectedWidget();
+            if (dependent)
+                dependents.push_back(dependent);
+        }
+
+        for (const auto* layout : m_rarelyUsedData->boundSizeLayouts)
+        {
+            Widget* dependent = layout->getConnectedWidget();
+            if (dependent)
+                dependents.push_back(dependent);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::RarelyUsedData& Widget::getRarelyUsedData()
+    {
+        if (!m_rarelyUsedData)
+            m_rarelyUsedData = std::make_unique<RarelyUsedData>();
+
+        return *m_rarelyUsedData;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::copyRarelyUsedData(const Widget& other)
+    {
+        if (m_rarelyUsedData)
+        {
+            m_rarelyUsedData->toolTip = nullptr;
+            m_rarelyUsedData->rotationOrigin.reset();
+            m_rarelyUsedData->scaleOrigin.reset();
+        }
+
+        if (!other.m_rarelyUsedData)
+            return;
+
+        if (other.m_rarelyUsedData->toolTip)
+            getRarelyUsedData().toolTip = other.m_rarelyUsedData->toolTip->clone();
+        if (other.m_rarelyUsedData->rotationOrigin)
+            getRarelyUsedData().rotationOrigin = other.m_rarelyUsedData->rotationOrigin;
+        if (other.m_rarelyUsedData->scaleOrigin)
+            getRarelyUsedData().scaleOrigin = other.m_rarelyUsedData->scaleOrigin;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::recalculateBoundPositionLayouts()
+    {
+        if (m_rarelyUsedData)
+            Layout::recalculateLayouts(m_rarelyUsedData->boundPositionLayouts);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::recalculateBoundSizeLayouts()
+    {
+        if (m_rarelyUsedData)
+            Layout::recalculateLayouts(m_rarelyUsedData->boundSizeLayouts);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1405,37 +1502,42 @@ namespace tgui
 
     void Widget::rendererChanged(const String& property)
     {
-        if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            if (!m_enabled && (getSharedRenderer()->getOpacityDisabled() != -1))
-                m_opacityCached = getSharedRenderer()->getOpacityDisabled() * m_inheritedOpacity;
-            else
-                m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
-        }
-        else if (property == U"Font")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            if (getSharedRenderer()->getFont())
-                m_fontCached = getSharedRenderer()->getFont();
-            else if (m_inheritedFont)
-                m_fontCached = m_inheritedFont;
-            else
-                m_fontCached = Font::getGlobalFont();
-        }
-        else if (property == U"TextSize")
-        {
-            if (getSharedRenderer()->getTextSize())
-                m_textSizeCached = getSharedRenderer()->getTextSize();
-            else
-                m_textSizeCached = m_textSize;
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                if (!m_enabled && (getSharedRenderer()->getOpacityDisabled() != -1))
+                    m_opacityCached = getSharedRenderer()->getOpacityDisabled() * m_inheritedOpacity;
+                else
+                    m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
+                break;
 
-            updateTextSize();
-        }
-        else if (property == U"TransparentTexture")
-        {
-            m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
+            case RendererProperty::Font:
+                if (getSharedRenderer()->getFont())
+                    m_fontCached = getSharedRenderer()->getFont();
+                else if (m_inheritedFont)
+                    m_fontCached = m_inheritedFont;
+                else
+                    m_fontCached = Font::getGlobalFont();
+                break;
+
+            case RendererProperty::TextSize:
+                if (getSharedRenderer()->getTextSize())
+                    m_textSizeCached = getSharedRenderer()->getTextSize();
+                else
+                    m_textSizeCached = m_textSize;
+
+                updateTextSize();
+                break;
+
+            case RendererProperty::TransparentTexture:
+                m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
+                break;
+
+            default:
+                throw Exception{U"Could not set property '" + property + U"', widget of type '" + getWidgetType() + U"' does not has this property."};
+                break;
         }
-        else
-            throw Exception{U"Could not set property '" + property + U"', widget of type '" + getWidgetType() + U"' does not has this property."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1461,51 +1563,61 @@ namespace tgui
         if (getScale() != Vector2f{1, 1})
         {
             node->propertyValuePairs[U"Scale"] = std::make_unique<DataIO::ValueNode>("(" + String::fromNumber(m_scaleFactors.x) + "," + String::fromNumber(m_scaleFactors.y) + ")");
-            if (m_scaleOrigin)
-                node->propertyValuePairs[U"ScaleOrigin"] = std::make_unique<DataIO::ValueNode>("(" + String::fromNumber(m_scaleOrigin->x) + "," + String::fromNumber(m_scaleOrigin->y) + ")");
+            if (m_rarelyUsedData && m_rarelyUsedData->scaleOrigin)
+            {
+                const Vector2f& scaleOrigin = *m_rarelyUsedData->scaleOrigin;
+                node->propertyValuePairs[U"ScaleOrigin"] = std::make_unique<DataIO::ValueNode>("(" + String::fromNumber(scaleOrigin.x) + "," + String::fromNumber(scaleOrigin.y) + ")");
+            }
         }
         if (getRotation() != 0)
         {
             node->propertyValuePairs[U"Rotation"] = std::make_unique<DataIO::ValueNode>(String::fromNumber(m_rotationDeg));
-            if (m_rotationOrigin)
-                node->propertyValuePairs[U"RotationOrigin"] = std::make_unique<DataIO::ValueNode>("(" + String::fromNumber(m_rotationOrigin->x) + "," + String::fromNumber(m_rotationOrigin->y) + ")");
-        }
-#if TGUI_COMPILED_WITH_CPP_VER >= 17
-        if (m_userData.has_value())
-        {
-            if (m_userData.type() == typeid(String))
-            {
-                const String string = std::any_cast<String>(m_userData);
-                node->propertyValuePairs[U"UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(string));
-            }
-            else if (m_userData.type() == typeid(std::string))
+            if (m_rarelyUsedData && m_rarelyUsedData->rotationOrigin)
             {
-                const String string = std::any_cast<std::string>(m_userData);
-                node->propertyValuePairs[U"UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(string));
-            }
-            else if (m_userData.type() == typeid(const char*))
-            {
-                const String string = std::any_cast<const char*>(m_userData);
-                node->propertyValuePairs[U"UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(string));
+                const Vector2f& rotationOrigin = *m_rarelyUsedData->rotationOrigin;
+                node->propertyValuePairs[U"RotationOrigin"] = std::make_unique<DataIO::ValueNode>("(" + String::fromNumber(rotationOrigin.x) + "," + String::fromNumber(rotationOrigin.y) + ")");
             }
         }
-#else
-        if (m_userData.not_null())
+        if (m_rarelyUsedData)
         {
-            if (m_userData.is<String>())
-            {
-                node->propertyValuePairs[U"UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(m_userData.as<String>()));
-            }
-            else if (m_userData.is<std::string>())
+            const Any& userData = m_rarelyUsedData->userData;
+#if TGUI_COMPILED_WITH_CPP_VER >= 17
+            if (userData.has_value())
             {
-                node->propertyValuePairs[U"UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(String(m_userData.as<std::string>()))) ;
+                if (userData.type() == typeid(String))
+                {
+                    const String string = std::any_cast<String>(userData);
+                    node->propertyValuePairs[U"UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(string));
+                }
+                else if (userData.type() == typeid(std::string))
+                {
+                    const String string = std::any_cast<std::string>(userData);
+                    node->propertyValuePairs[U"UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(string));
+                }
+                else if (userData.type() == typeid(const char*))
+                {
+                    const String string = std::any_cast<const char*>(userData);
+                    node->propertyValuePairs[U"UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(string));
+                }
             }
-            else if (m_userData.is<const char*>())
+#else
+            if (userData.not_null())
             {
-                node->propertyValuePairs[U"UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(m_userData.as<const char*>()));
+                if (userData.is<String>())
+                {
+                    node->propertyValuePairs[U"UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(userData.as<String>()));
+                }
+                else if (userData.is<std::string>())
+                {
+                    node->propertyValuePairs[U"UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(String(userData.as<std::string>()))) ;
+                }
+                else if (userData.is<const char*>())
+                {
+                    node->propertyValuePairs[U"UserData"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(userData.as<const char*>()));
+                }
             }
-        }
 #endif
+        }
         if (m_textSize != 0)
             node->propertyValuePairs[U"TextSize"] = std::make_unique<DataIO::ValueNode>(String::fromNumber(m_textSize));
 
@@ -1586,9 +1698,9 @@ namespace tgui
         if (node->propertyValuePairs[U"UserData"])
         {
 #if TGUI_COMPILED_WITH_CPP_VER >= 17
-            m_userData = std::make_any<String>(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs[U"UserData"]->value).getString());
+            getRarelyUsedData().userData = std::make_any<String>(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs[U"UserData"]->value).getString());
 #else
-            m_userData = tgui::Any(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs[U"UserData"]->value).getString());
+            getRarelyUsedData().userData = tgui::Any(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs[U"UserData"]->value).getString());
 #endif
         }
         if (node->propertyValuePairs[U"TextSize"])
@@ -1716,9 +1828,70 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    priv::AnimationEngine* Widget::getAnimationEngine(bool createIfMissing)
+    {
+        auto& animationEngine = m_parent ? m_parent->m_animations : m_animations;
+        if (!animationEngine && createIfMissing)
+            animationEngine = std::make_unique<priv::AnimationEngine>();
+
+        return animationEngine.get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::rendererChangedCallback(const String& property)
     {
         rendererChanged(property);
+
+        // Properties like borders or text size can change the area that the widget occupies outside its size
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::rendererChangedCallback(const RendererPropertyMask& properties)
+    {
+        rendererPropertiesChanged(properties);
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::rendererPropertiesChanged(const RendererPropertyMask& properties)
+    {
+        // Support nested calls (e.g. when a widget changes its own renderer from within rendererChanged)
+        std::vector<void (Widget::*)()> pendingUpdates;
+        std::vector<void (Widget::*)()>* const oldPendingUpdates = m_pendingRendererUpdates;
+        m_pendingRendererUpdates = &pendingUpdates;
+
+        try
+        {
+            for (const RendererPropertyId id : properties.getIds())
+                rendererChanged(RendererPropertyRegistry::getName(id));
+        }
+        catch (...)
+        {
+            // Leave the widget in a consistent state for the properties that were already processed
+            m_pendingRendererUpdates = oldPendingUpdates;
+            for (const auto& function : pendingUpdates)
+                (this->*function)();
+
+            throw;
+        }
+
+        m_pendingRendererUpdates = oldPendingUpdates;
+        for (const auto& function : pendingUpdates)
+            (this->*function)();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::reapplySize()
+    {
+        setSize(m_size);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
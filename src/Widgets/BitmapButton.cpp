@@ -175,13 +175,18 @@ namespace tgui
 
     void BitmapButton::rendererChanged(const String& property)
     {
-        if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        switch (RendererPropertyRegistry::findId(property))
         {
-            Button::rendererChanged(property);
-            m_imageComponent->setOpacity(m_opacityCached);
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Button::rendererChanged(property);
+                m_imageComponent->setOpacity(m_opacityCached);
+                break;
+
+            default:
+                Button::rendererChanged(property);
+                break;
         }
-        else
-            Button::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
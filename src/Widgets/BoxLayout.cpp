@@ -64,7 +64,7 @@ namespace tgui
     {
         Group::setSize(size);
 
-        updateWidgets();
+        requestWidgetsUpdate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -86,24 +86,19 @@ namespace tgui
             m_widgets.pop_back();
 
             m_widgets.insert(m_widgets.begin() + static_cast<std::ptrdiff_t>(index), widget);
+            updateWidgetIndices(index, m_widgets.size());
         }
         else // Just add the widget to the back
             Group::add(widget, widgetName);
 
-        updateWidgets();
+        requestWidgetsUpdate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool BoxLayout::remove(const Widget::Ptr& widget)
     {
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            if (m_widgets[i] == widget)
-                return remove(i);
-        }
-
-        return false;
+        return remove(findWidgetIndex(widget.get()));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -115,7 +110,7 @@ namespace tgui
 
         Group::remove(m_widgets[index]);
 
-        updateWidgets();
+        requestWidgetsUpdate();
         return true;
     }
 
@@ -133,21 +128,25 @@ namespace tgui
 
     void BoxLayout::rendererChanged(const String& property)
     {
-        if (property == U"SpaceBetweenWidgets")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
+            case RendererProperty::SpaceBetweenWidgets:
+                m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
+                requestWidgetsUpdate();
+                break;
+
+            case RendererProperty::Padding:
+                Group::rendererChanged(property);
+
+                // Update the space between widgets as the padding is used when no space was explicitly set
+                m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
+                requestWidgetsUpdate();
+                break;
+
+            default:
+                Group::rendererChanged(property);
+                break;
         }
-        else if (property == U"Padding")
-        {
-            Group::rendererChanged(property);
-
-            // Update the space between widgets as the padding is used when no space was explicitly set
-            m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
-        }
-        else
-            Group::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -105,13 +105,7 @@ namespace tgui
 
     bool BoxLayoutRatios::setRatio(const Widget::Ptr& widget, float ratio)
     {
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            if (m_widgets[i] == widget)
-                return setRatio(i, ratio);
-        }
-
-        return false;
+        return setRatio(findWidgetIndex(widget.get()), ratio);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -122,7 +116,7 @@ namespace tgui
             return false;
 
         m_ratios[index] = ratio;
-        updateWidgets();
+        requestWidgetsUpdate();
         return true;
     }
 
@@ -130,13 +124,7 @@ namespace tgui
 
     float BoxLayoutRatios::getRatio(const Widget::Ptr& widget) const
     {
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            if (m_widgets[i] == widget)
-                return getRatio(i);
-        }
-
-        return 0;
+        return getRatio(findWidgetIndex(widget.get()));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
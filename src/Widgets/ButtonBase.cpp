@@ -321,119 +321,204 @@ namespace tgui
 
     void ButtonBase::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            background.borders = getSharedRenderer()->getBorders();
-            updateSize();
-        }
-        else if (property == U"RoundedBorderRadius")
-        {
-            background.roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
-        }
-        else if (property == U"TextColor")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColor(), priv::dev::ComponentState::Normal);
-        else if (property == U"TextColorDown")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDown(), priv::dev::ComponentState::Active);
-        else if (property == U"TextColorHover")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"TextColorDownHover")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"TextColorDisabled")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextColorDownDisabled")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"TextColorFocused")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"TextColorDownFocused")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"TextStyle")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyle(), priv::dev::ComponentState::Normal);
-        else if (property == U"TextStyleDown")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDown(), priv::dev::ComponentState::Active);
-        else if (property == U"TextStyleHover")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"TextStyleDownHover")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"TextStyleDisabled")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextStyleDownDisabled")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"TextStyleFocused")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"TextStyleDownFocused")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"Texture")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTexture(), priv::dev::ComponentState::Normal);
-        else if (property == U"TextureDown")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDown(), priv::dev::ComponentState::Active);
-        else if (property == U"TextureHover")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"TextureDownHover")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"TextureDisabled")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextureDownDisabled")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextureFocused")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"TextureDownFocused")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"BorderColor")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColor(), priv::dev::ComponentState::Normal);
-        else if (property == U"BorderColorDown")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDown(), priv::dev::ComponentState::Active);
-        else if (property == U"BorderColorHover")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"BorderColorDownHover")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"BorderColorDisabled")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"BorderColorDownDisabled")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"BorderColorFocused")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"BorderColorDownFocused")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"BackgroundColor")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColor(), priv::dev::ComponentState::Normal);
-        else if (property == U"BackgroundColorDown")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDown(), priv::dev::ComponentState::Active);
-        else if (property == U"BackgroundColorHover")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"BackgroundColorDownHover")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"BackgroundColorDisabled")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"BackgroundColorDownDisabled")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"BackgroundColorFocused")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"BackgroundColorDownFocused")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"TextOutlineThickness")
-        {
-            m_textComponent->setOutlineThickness(getSharedRenderer()->getTextOutlineThickness());
-            updateTextPosition();
-        }
-        else if (property == U"TextOutlineColor")
-        {
-            m_textComponent->setOutlineColor(getSharedRenderer()->getTextOutlineColor());
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            ClickableWidget::rendererChanged(property);
-            m_textComponent->setOpacity(m_opacityCached);
-            m_backgroundComponent->setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            ClickableWidget::rendererChanged(property);
+            case RendererProperty::Borders:
+                background.borders = getSharedRenderer()->getBorders();
+                updateSize();
+                break;
 
-            m_textComponent->setFont(m_fontCached);
-            updateTextSize();
+            case RendererProperty::RoundedBorderRadius:
+                background.roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
+                break;
+
+            case RendererProperty::TextColor:
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColor(), priv::dev::ComponentState::Normal);
+                break;
+
+            case RendererProperty::TextColorDown:
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDown(), priv::dev::ComponentState::Active);
+                break;
+
+            case RendererProperty::TextColorHover:
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorHover(), priv::dev::ComponentState::Hover);
+                break;
+
+            case RendererProperty::TextColorDownHover:
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+
+            case RendererProperty::TextColorDisabled:
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case RendererProperty::TextColorDownDisabled:
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+
+            case RendererProperty::TextColorFocused:
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorFocused(), priv::dev::ComponentState::Focused);
+                break;
+
+            case RendererProperty::TextColorDownFocused:
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+
+            case RendererProperty::TextStyle:
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyle(), priv::dev::ComponentState::Normal);
+                break;
+
+            case RendererProperty::TextStyleDown:
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDown(), priv::dev::ComponentState::Active);
+                break;
+
+            case RendererProperty::TextStyleHover:
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleHover(), priv::dev::ComponentState::Hover);
+                break;
+
+            case RendererProperty::TextStyleDownHover:
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+
+            case RendererProperty::TextStyleDisabled:
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case RendererProperty::TextStyleDownDisabled:
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+
+            case RendererProperty::TextStyleFocused:
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleFocused(), priv::dev::ComponentState::Focused);
+                break;
+
+            case RendererProperty::TextStyleDownFocused:
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+
+            case RendererProperty::Texture:
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTexture(), priv::dev::ComponentState::Normal);
+                break;
+
+            case RendererProperty::TextureDown:
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDown(), priv::dev::ComponentState::Active);
+                break;
+
+            case RendererProperty::TextureHover:
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureHover(), priv::dev::ComponentState::Hover);
+                break;
+
+            case RendererProperty::TextureDownHover:
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+
+            case RendererProperty::TextureDisabled:
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case RendererProperty::TextureDownDisabled:
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case RendererProperty::TextureFocused:
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureFocused(), priv::dev::ComponentState::Focused);
+                break;
+
+            case RendererProperty::TextureDownFocused:
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+
+            case RendererProperty::BorderColor:
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColor(), priv::dev::ComponentState::Normal);
+                break;
+
+            case RendererProperty::BorderColorDown:
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDown(), priv::dev::ComponentState::Active);
+                break;
+
+            case RendererProperty::BorderColorHover:
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorHover(), priv::dev::ComponentState::Hover);
+                break;
+
+            case RendererProperty::BorderColorDownHover:
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+
+            case RendererProperty::BorderColorDisabled:
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case RendererProperty::BorderColorDownDisabled:
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+
+            case RendererProperty::BorderColorFocused:
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorFocused(), priv::dev::ComponentState::Focused);
+                break;
+
+            case RendererProperty::BorderColorDownFocused:
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+
+            case RendererProperty::BackgroundColor:
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColor(), priv::dev::ComponentState::Normal);
+                break;
+
+            case RendererProperty::BackgroundColorDown:
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDown(), priv::dev::ComponentState::Active);
+                break;
+
+            case RendererProperty::BackgroundColorHover:
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorHover(), priv::dev::ComponentState::Hover);
+                break;
+
+            case RendererProperty::BackgroundColorDownHover:
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+
+            case RendererProperty::BackgroundColorDisabled:
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case RendererProperty::BackgroundColorDownDisabled:
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+
+            case RendererProperty::BackgroundColorFocused:
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorFocused(), priv::dev::ComponentState::Focused);
+                break;
+
+            case RendererProperty::BackgroundColorDownFocused:
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+
+            case RendererProperty::TextOutlineThickness:
+                m_textComponent->setOutlineThickness(getSharedRenderer()->getTextOutlineThickness());
+                updateTextPosition();
+                break;
+
+            case RendererProperty::TextOutlineColor:
+                m_textComponent->setOutlineColor(getSharedRenderer()->getTextOutlineColor());
+                break;
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                ClickableWidget::rendererChanged(property);
+                m_textComponent->setOpacity(m_opacityCached);
+                m_backgroundComponent->setOpacity(m_opacityCached);
+                break;
+
+            case RendererProperty::Font:
+                ClickableWidget::rendererChanged(property);
+
+                m_textComponent->setFont(m_fontCached);
+                updateTextSize();
+                break;
+
+            default:
+                ClickableWidget::rendererChanged(property);
+                break;
         }
-        else
-            ClickableWidget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
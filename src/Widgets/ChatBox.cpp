@@ -451,66 +451,73 @@ namespace tgui
 
     void ChatBox::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"Scrollbar")
-        {
-            m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
-
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+            case RendererProperty::Borders:
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateAfterRendererChange(&ChatBox::reapplySize);
+                break;
+
+            case RendererProperty::Padding:
+                m_paddingCached = getSharedRenderer()->getPadding();
+                updateAfterRendererChange(&ChatBox::reapplySize);
+                break;
+
+            case RendererProperty::TextureBackground:
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+
+            case RendererProperty::Scrollbar:
+                m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
+                    updateAfterRendererChange(&ChatBox::reapplySize);
+                }
+                break;
+
+            case RendererProperty::ScrollbarWidth:
             {
-                m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
-                setSize(m_size);
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
+                m_scroll->setSize({width, m_scroll->getSize().y});
+                updateAfterRendererChange(&ChatBox::reapplySize);
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
-            m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_scroll->setInheritedOpacity(m_opacityCached);
+            case RendererProperty::BorderColor:
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
 
-            for (auto& line : m_lines)
-                line.text.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+            case RendererProperty::BackgroundColor:
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Widget::rendererChanged(property);
 
-            for (auto& line : m_lines)
-                line.text.setFont(m_fontCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_scroll->setInheritedOpacity(m_opacityCached);
 
-            recalculateAllLines();
+                for (auto& line : m_lines)
+                    line.text.setOpacity(m_opacityCached);
+                break;
+
+            case RendererProperty::Font:
+                Widget::rendererChanged(property);
+
+                for (auto& line : m_lines)
+                    line.text.setFont(m_fontCached);
+
+                recalculateAllLines();
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
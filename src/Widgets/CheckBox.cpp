@@ -185,10 +185,19 @@ namespace tgui
 
     void CheckBox::rendererChanged(const String& property)
     {
-        if (property == U"TextureUnchecked")
-            m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
-        else if (property == U"TextureChecked")
-            m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
+        switch (RendererPropertyRegistry::findId(property))
+        {
+            case RendererProperty::TextureUnchecked:
+                m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
+                break;
+
+            case RendererProperty::TextureChecked:
+                m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
+                break;
+
+            default:
+                break;
+        }
 
         RadioButton::rendererChanged(property);
     }
@@ -115,8 +115,7 @@ namespace tgui
         m_showTextOnTitleButtonsCached     {other.m_showTextOnTitleButtonsCached}
     {
         // The inner size has changed since the container created the child widgets
-        for (auto& layout : m_boundSizeLayouts)
-            layout->recalculateValue();
+        recalculateBoundSizeLayouts();
 
         connectTitleButtonCallbacks();
     }
@@ -157,8 +156,7 @@ namespace tgui
         m_showTextOnTitleButtonsCached     {std::move(other.m_showTextOnTitleButtonsCached)}
     {
         // The inner size has changed since the container created the child widgets
-        for (auto& layout : m_boundSizeLayouts)
-            layout->recalculateValue();
+        recalculateBoundSizeLayouts();
 
         connectTitleButtonCallbacks();
     }
@@ -204,8 +202,7 @@ namespace tgui
             m_showTextOnTitleButtonsCached      = other.m_showTextOnTitleButtonsCached;
 
             // The inner size has changed since the container created the child widgets
-            for (auto& layout : m_boundSizeLayouts)
-                layout->recalculateValue();
+            recalculateBoundSizeLayouts();
 
             connectTitleButtonCallbacks();
         }
@@ -253,8 +250,7 @@ namespace tgui
             Container::operator=(std::move(other));
 
             // The inner size has changed since the container created the child widgets
-            for (auto& layout : m_boundSizeLayouts)
-                layout->recalculateValue();
+            recalculateBoundSizeLayouts();
 
             connectTitleButtonCallbacks();
         }
@@ -1065,156 +1061,164 @@ namespace tgui
 
     void ChildWindow::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
+        const RendererPropertyId propertyId = RendererPropertyRegistry::findId(property);
+        switch (propertyId)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
+            case RendererProperty::Borders:
+                m_bordersCached = getSharedRenderer()->getBorders();
 
-            if (m_decorationLayoutX && (m_decorationLayoutX == m_size.x.getRightOperand()))
-                m_decorationLayoutX->replaceValue(m_bordersCached.getLeft() + m_bordersCached.getRight());
-            if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
-                m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
-
-            setSize(m_size);
-        }
-        else if (property == U"TitleColor")
-        {
-            m_titleText.setColor(getSharedRenderer()->getTitleColor());
-        }
-        else if ((property == U"TextureTitleBar") || (property == U"TitleBarHeight"))
-        {
-            const float oldTitleBarHeight = m_titleBarHeightCached;
+                if (m_decorationLayoutX && (m_decorationLayoutX == m_size.x.getRightOperand()))
+                    m_decorationLayoutX->replaceValue(m_bordersCached.getLeft() + m_bordersCached.getRight());
+                if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
+                    m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
 
-            if (property == U"TextureTitleBar")
-                m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
+                updateAfterRendererChange(&ChildWindow::reapplySize);
+                break;
 
-            m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
-            updateTitleBarHeight();
+            case RendererProperty::TitleColor:
+                m_titleText.setColor(getSharedRenderer()->getTitleColor());
+                break;
 
-            if (oldTitleBarHeight != m_titleBarHeightCached)
+            case RendererProperty::TextureTitleBar:
+            case RendererProperty::TitleBarHeight:
             {
+                const float oldTitleBarHeight = m_titleBarHeightCached;
+
+                if (propertyId == RendererProperty::TextureTitleBar)
+                    m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
+
+                m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
+                updateTitleBarHeight();
+
+                if (oldTitleBarHeight != m_titleBarHeightCached)
+                {
+                    if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
+                        m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
+
+                    // If the title bar changes in height then the inner size will also change
+                    recalculateBoundSizeLayouts();
+                }
+                break;
+            }
+
+            case RendererProperty::TextureBackground:
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+
+            case RendererProperty::BorderBelowTitleBar:
+                m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
                 if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
                     m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
+                break;
 
-                // If the title bar changes in height then the inner size will also change
-                for (auto& layout : m_boundSizeLayouts)
-                    layout->recalculateValue();
-            }
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"BorderBelowTitleBar")
-        {
-            m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
-            if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
-                m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
-        }
-        else if (property == U"DistanceToSide")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-            setPosition(m_position);
-        }
-        else if (property == U"PaddingBetweenButtons")
-        {
-            m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
-            setPosition(m_position);
-        }
-        else if (property == U"MinimumResizableBorderWidth")
-        {
-            m_minimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
-        }
-        else if (property == U"ShowTextOnTitleButtons")
-        {
-            m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
-            setTitleButtons(m_titleButtons);
-        }
-        else if (property == U"CloseButton")
-        {
-            if (m_closeButton->isVisible())
-            {
-                m_closeButton->setRenderer(getSharedRenderer()->getCloseButton());
-                m_closeButton->setInheritedOpacity(m_opacityCached);
-            }
+            case RendererProperty::DistanceToSide:
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                setPosition(m_position);
+                break;
 
-            updateTitleBarHeight();
-        }
-        else if (property == U"MaximizeButton")
-        {
-            if (m_maximizeButton->isVisible())
-            {
-                auto buttonRenderer = getSharedRenderer()->getMaximizeButton();
-                if (!buttonRenderer || (buttonRenderer->propertyValuePairs.empty() && !buttonRenderer->connectedTheme))
-                    buttonRenderer = getSharedRenderer()->getCloseButton();
+            case RendererProperty::PaddingBetweenButtons:
+                m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
+                setPosition(m_position);
+                break;
 
-                m_maximizeButton->setRenderer(buttonRenderer);
-                m_maximizeButton->setInheritedOpacity(m_opacityCached);
-            }
+            case RendererProperty::MinimumResizableBorderWidth:
+                m_minimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
+                break;
 
-            updateTitleBarHeight();
-        }
-        else if (property == U"MinimizeButton")
-        {
-            if (m_minimizeButton->isVisible())
-            {
-                auto buttonRenderer = getSharedRenderer()->getMinimizeButton();
-                if (!buttonRenderer || (buttonRenderer->propertyValuePairs.empty() && !buttonRenderer->connectedTheme))
-                    buttonRenderer = getSharedRenderer()->getCloseButton();
+            case RendererProperty::ShowTextOnTitleButtons:
+                m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
+                setTitleButtons(m_titleButtons);
+                break;
 
-                m_minimizeButton->setRenderer(buttonRenderer);
-                m_minimizeButton->setInheritedOpacity(m_opacityCached);
-            }
+            case RendererProperty::CloseButton:
+                if (m_closeButton->isVisible())
+                {
+                    m_closeButton->setRenderer(getSharedRenderer()->getCloseButton());
+                    m_closeButton->setInheritedOpacity(m_opacityCached);
+                }
 
-            updateTitleBarHeight();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"TitleBarColor")
-        {
-            m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BorderColorFocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Container::rendererChanged(property);
+                updateAfterRendererChange(&ChildWindow::updateTitleBarHeight);
+                break;
 
-            for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
-            {
-                if (button->isVisible())
-                    button->setInheritedOpacity(m_opacityCached);
-            }
+            case RendererProperty::MaximizeButton:
+                if (m_maximizeButton->isVisible())
+                {
+                    auto buttonRenderer = getSharedRenderer()->getMaximizeButton();
+                    if (!buttonRenderer || (buttonRenderer->propertyValuePairs.empty() && !buttonRenderer->connectedTheme))
+                        buttonRenderer = getSharedRenderer()->getCloseButton();
 
-            m_titleText.setOpacity(m_opacityCached);
-            m_spriteTitleBar.setOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Container::rendererChanged(property);
+                    m_maximizeButton->setRenderer(buttonRenderer);
+                    m_maximizeButton->setInheritedOpacity(m_opacityCached);
+                }
 
-            for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
-            {
-                if (button->isVisible())
-                    button->setInheritedFont(m_fontCached);
-            }
+                updateAfterRendererChange(&ChildWindow::updateTitleBarHeight);
+                break;
 
-            m_titleText.setFont(m_fontCached);
-            if (m_titleTextSize == 0)
-                m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, getSharedRenderer()->getTitleBarHeight() * 0.8f));
+            case RendererProperty::MinimizeButton:
+                if (m_minimizeButton->isVisible())
+                {
+                    auto buttonRenderer = getSharedRenderer()->getMinimizeButton();
+                    if (!buttonRenderer || (buttonRenderer->propertyValuePairs.empty() && !buttonRenderer->connectedTheme))
+                        buttonRenderer = getSharedRenderer()->getCloseButton();
 
-            setPosition(m_position);
+                    m_minimizeButton->setRenderer(buttonRenderer);
+                    m_minimizeButton->setInheritedOpacity(m_opacityCached);
+                }
+
+                updateAfterRendererChange(&ChildWindow::updateTitleBarHeight);
+                break;
+
+            case RendererProperty::BackgroundColor:
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case RendererProperty::TitleBarColor:
+                m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
+                break;
+
+            case RendererProperty::BorderColor:
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case RendererProperty::BorderColorFocused:
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                break;
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Container::rendererChanged(property);
+
+                for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                {
+                    if (button->isVisible())
+                        button->setInheritedOpacity(m_opacityCached);
+                }
+
+                m_titleText.setOpacity(m_opacityCached);
+                m_spriteTitleBar.setOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                break;
+
+            case RendererProperty::Font:
+                Container::rendererChanged(property);
+
+                for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                {
+                    if (button->isVisible())
+                        button->setInheritedFont(m_fontCached);
+                }
+
+                m_titleText.setFont(m_fontCached);
+                if (m_titleTextSize == 0)
+                    m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, getSharedRenderer()->getTitleBarHeight() * 0.8f));
+
+                setPosition(m_position);
+                break;
+
+            default:
+                Container::rendererChanged(property);
+                break;
         }
-        else
-            Container::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
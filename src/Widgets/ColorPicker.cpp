@@ -26,7 +26,9 @@
 #include <TGUI/Widgets/ColorPicker.hpp>
 #include <TGUI/Widgets/EditBox.hpp>
 #include <TGUI/Widgets/Label.hpp>
+#include <TGUI/PixelKernels.hpp>
 #include <cmath>
+#include <cstring>
 
 #if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
     #include <numbers>
@@ -149,31 +151,42 @@ namespace tgui
         setTitleButtons(ChildWindow::TitleButton::None);
         setTextSize(getGlobalTextSize());
 
+        // The colors inside the circle are opaque, so they are calculated as RGB values and then converted to RGBA one row
+        // at a time. The pixels outside the circle are transparent.
+        const auto getWheelPosition = [](unsigned int x, unsigned int y) {
+            return Vector2f{((static_cast<float>(x) / colorWheelSize) - 0.5f) * 2.f,
+                            ((static_cast<float>(y) / colorWheelSize) - 0.5f) * 2.f};
+        };
+        const auto isInsideWheel = [&getWheelPosition](unsigned int x, unsigned int y) {
+            const Vector2f position = getWheelPosition(x, y);
+            return std::sqrt(position.x * position.x + position.y * position.y) <= 1.f;
+        };
+
         auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(static_cast<std::size_t>(colorWheelSize) * colorWheelSize * 4);
+        std::uint8_t rgbRow[colorWheelSize * 3];
         for (unsigned int y = 0; y < colorWheelSize; ++y)
         {
-            for (unsigned int x = 0; x < colorWheelSize; ++x)
+            std::uint8_t* const rowPixels = &pixels[static_cast<std::size_t>(y) * colorWheelSize * 4];
+
+            unsigned int firstX = 0;
+            while ((firstX < colorWheelSize) && !isInsideWheel(firstX, y))
+                ++firstX;
+
+            unsigned int endX = colorWheelSize;
+            while ((endX > firstX) && !isInsideWheel(endX - 1, y))
+                --endX;
+
+            for (unsigned int x = firstX; x < endX; ++x)
             {
-                const Vector2f position = {((static_cast<float>(x) / colorWheelSize) - 0.5f) * 2.f,
-                                           ((static_cast<float>(y) / colorWheelSize) - 0.5f) * 2.f};
-                if (std::sqrt(position.x * position.x + position.y * position.y) <= 1.f)
-                {
-                    const Color pixelColor = calculateColor(position, 1, 1);
-                    const unsigned int pixelIndex = ((y * colorWheelSize) + x) * 4;
-                    pixels[pixelIndex] = pixelColor.getRed();
-                    pixels[pixelIndex+1] = pixelColor.getGreen();
-                    pixels[pixelIndex+2] = pixelColor.getBlue();
-                    pixels[pixelIndex+3] = pixelColor.getAlpha();
-                }
-                else // Pixel lies outside the circle, draw a transparent pixel
-                {
-                    const unsigned int pixelIndex = ((y * colorWheelSize) + x) * 4;
-                    pixels[pixelIndex] = 0;
-                    pixels[pixelIndex+1] = 0;
-                    pixels[pixelIndex+2] = 0;
-                    pixels[pixelIndex+3] = 0;
-                }
+                const Color pixelColor = calculateColor(getWheelPosition(x, y), 1, 1);
+                rgbRow[x * 3] = pixelColor.getRed();
+                rgbRow[x * 3 + 1] = pixelColor.getGreen();
+                rgbRow[x * 3 + 2] = pixelColor.getBlue();
             }
+
+            std::memset(rowPixels, 0, static_cast<std::size_t>(firstX) * 4);
+            PixelKernels::convertRgbToRgba(&rgbRow[firstX * 3], &rowPixels[firstX * 4], endX - firstX);
+            std::memset(&rowPixels[endX * 4], 0, static_cast<std::size_t>(colorWheelSize - endX) * 4);
         }
 
         m_colorWheelTexture.loadFromPixelData({colorWheelSize, colorWheelSize}, pixels.get());
@@ -535,48 +548,59 @@ namespace tgui
 
     void ColorPicker::rendererChanged(const String& property)
     {
-        if (property == U"Button")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            const auto& renderer = getSharedRenderer()->getButton();
+            case RendererProperty::Button:
+            {
+                const auto& renderer = getSharedRenderer()->getButton();
+
+                // During loading from file, the renderer is loaded before the child widgets are loaded.
+                // In this exceptional case, we shouldn't try to set the renderer. The buttons will have their renderer in the form file anyway.
+                if (get("#TGUI_INTERNAL$ColorPickerOK#"))
+                {
+                    get<Button>("#TGUI_INTERNAL$ColorPickerReset#")->setRenderer(renderer);
+                    get<Button>("#TGUI_INTERNAL$ColorPickerOK#")->setRenderer(renderer);
+                    get<Button>("#TGUI_INTERNAL$ColorPickerCancel#")->setRenderer(renderer);
+                }
+                break;
+            }
 
-            // During loading from file, the renderer is loaded before the child widgets are loaded.
-            // In this exceptional case, we shouldn't try to set the renderer. The buttons will have their renderer in the form file anyway.
-            if (get("#TGUI_INTERNAL$ColorPickerOK#"))
+            case RendererProperty::Label:
             {
-                get<Button>("#TGUI_INTERNAL$ColorPickerReset#")->setRenderer(renderer);
-                get<Button>("#TGUI_INTERNAL$ColorPickerOK#")->setRenderer(renderer);
-                get<Button>("#TGUI_INTERNAL$ColorPickerCancel#")->setRenderer(renderer);
+                const auto& renderer = getSharedRenderer()->getLabel();
+
+                for (const auto& it : getWidgets())
+                {
+                    auto label = std::dynamic_pointer_cast<Label>(it);
+                    if (label)
+                        label->setRenderer(renderer);
+                }
+                break;
             }
-        }
-        else if (property == U"Label")
-        {
-            const auto& renderer = getSharedRenderer()->getLabel();
 
-            for (const auto& it : getWidgets())
+            case RendererProperty::Slider:
             {
-                auto label = std::dynamic_pointer_cast<Label>(it);
-                if (label)
-                    label->setRenderer(renderer);
+                const auto& renderer = getSharedRenderer()->getSlider();
+
+                m_red->setRenderer(renderer);
+                m_green->setRenderer(renderer);
+                m_blue->setRenderer(renderer);
+                m_alpha->setRenderer(renderer);
+
+                m_value->setRenderer(renderer);
+                break;
             }
-        }
-        else if (property == U"Slider")
-        {
-            const auto& renderer = getSharedRenderer()->getSlider();
 
-            m_red->setRenderer(renderer);
-            m_green->setRenderer(renderer);
-            m_blue->setRenderer(renderer);
-            m_alpha->setRenderer(renderer);
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                ChildWindow::rendererChanged(property);
+                m_colorWheelSprite.setOpacity(m_opacityCached);
+                break;
 
-            m_value->setRenderer(renderer);
+            default:
+                ChildWindow::rendererChanged(property);
+                break;
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            ChildWindow::rendererChanged(property);
-            m_colorWheelSprite.setOpacity(m_opacityCached);
-        }
-        else
-            ChildWindow::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
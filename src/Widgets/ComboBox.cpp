@@ -639,136 +639,141 @@ namespace tgui
 
     void ComboBox::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            case RendererProperty::Borders:
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateAfterRendererChange(&ComboBox::reapplySize);
+                break;
+
+            case RendererProperty::Padding:
+                m_paddingCached = getSharedRenderer()->getPadding();
+                updateAfterRendererChange(&ComboBox::reapplySize);
+                break;
+
+            case RendererProperty::TextColor:
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                if (m_enabled || !m_textColorDisabledCached.isSet())
+                    m_text.setColor(m_textColorCached);
+                if (!getSharedRenderer()->getDefaultTextColor().isSet())
+                    m_defaultText.setColor(getSharedRenderer()->getTextColor());
+                break;
+
+            case RendererProperty::TextColorDisabled:
+                m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
+                if (!m_enabled && m_textColorDisabledCached.isSet())
+                    m_text.setColor(m_textColorDisabledCached);
+                break;
+
+            case RendererProperty::TextStyle:
+                m_text.setStyle(getSharedRenderer()->getTextStyle());
+                if (!getSharedRenderer()->getDefaultTextStyle().isSet())
+                    m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
+                break;
+
+            case RendererProperty::DefaultTextColor:
+                if (getSharedRenderer()->getDefaultTextColor().isSet())
+                    m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
+                else
+                    m_defaultText.setColor(getSharedRenderer()->getTextColor());
+                break;
+
+            case RendererProperty::DefaultTextStyle:
+                if (getSharedRenderer()->getDefaultTextStyle().isSet())
+                    m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
+                else
+                    m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
+                break;
+
+            case RendererProperty::TextureBackground:
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+
+            case RendererProperty::TextureBackgroundDisabled:
+                m_spriteBackgroundDisabled.setTexture(getSharedRenderer()->getTextureBackgroundDisabled());
+                break;
+
+            case RendererProperty::TextureArrow:
+                m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
+                updateAfterRendererChange(&ComboBox::reapplySize);
+                break;
+
+            case RendererProperty::TextureArrowHover:
+                m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
+                break;
+
+            case RendererProperty::TextureArrowDisabled:
+                m_spriteArrowDisabled.setTexture(getSharedRenderer()->getTextureArrowDisabled());
+                break;
+
+            case RendererProperty::ListBox:
+                m_listBox->setRenderer(getSharedRenderer()->getListBox());
+                break;
+
+            case RendererProperty::BorderColor:
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case RendererProperty::BackgroundColor:
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case RendererProperty::BackgroundColorDisabled:
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+
+            case RendererProperty::ArrowBackgroundColor:
+                m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
+                break;
+
+            case RendererProperty::ArrowBackgroundColorHover:
+                m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
+                break;
+
+            case RendererProperty::ArrowBackgroundColorDisabled:
+                m_arrowBackgroundColorDisabledCached = getSharedRenderer()->getArrowBackgroundColorDisabled();
+                break;
+
+            case RendererProperty::ArrowColor:
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                break;
+
+            case RendererProperty::ArrowColorHover:
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                break;
+
+            case RendererProperty::ArrowColorDisabled:
+                m_arrowColorDisabledCached = getSharedRenderer()->getArrowColorDisabled();
+                break;
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteBackgroundDisabled.setOpacity(m_opacityCached);
+                m_spriteArrow.setOpacity(m_opacityCached);
+                m_spriteArrowHover.setOpacity(m_opacityCached);
+                m_spriteArrowDisabled.setOpacity(m_opacityCached);
+
+                m_text.setOpacity(m_opacityCached);
+                m_defaultText.setOpacity(m_opacityCached);
+                break;
+
+            case RendererProperty::Font:
+                Widget::rendererChanged(property);
+
+                m_text.setFont(m_fontCached);
+                m_defaultText.setFont(m_fontCached);
+                m_listBox->setInheritedFont(m_fontCached);
+
+                updateAfterRendererChange(&ComboBox::reapplySize);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            if (m_enabled || !m_textColorDisabledCached.isSet())
-                m_text.setColor(m_textColorCached);
-            if (!getSharedRenderer()->getDefaultTextColor().isSet())
-                m_defaultText.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == U"TextColorDisabled")
-        {
-            m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
-            if (!m_enabled && m_textColorDisabledCached.isSet())
-                m_text.setColor(m_textColorDisabledCached);
-        }
-        else if (property == U"TextStyle")
-        {
-            m_text.setStyle(getSharedRenderer()->getTextStyle());
-            if (!getSharedRenderer()->getDefaultTextStyle().isSet())
-                m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == U"DefaultTextColor")
-        {
-            if (getSharedRenderer()->getDefaultTextColor().isSet())
-                m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
-            else
-                m_defaultText.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == U"DefaultTextStyle")
-        {
-            if (getSharedRenderer()->getDefaultTextStyle().isSet())
-                m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
-            else
-                m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextureBackgroundDisabled")
-        {
-            m_spriteBackgroundDisabled.setTexture(getSharedRenderer()->getTextureBackgroundDisabled());
-        }
-        else if (property == U"TextureArrow")
-        {
-            m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
-            setSize(m_size);
-        }
-        else if (property == U"TextureArrowHover")
-        {
-            m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
-        }
-        else if (property == U"TextureArrowDisabled")
-        {
-            m_spriteArrowDisabled.setTexture(getSharedRenderer()->getTextureArrowDisabled());
-        }
-        else if (property == U"ListBox")
-        {
-            m_listBox->setRenderer(getSharedRenderer()->getListBox());
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorDisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == U"ArrowBackgroundColor")
-        {
-            m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
-        }
-        else if (property == U"ArrowBackgroundColorHover")
-        {
-            m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
-        }
-        else if (property == U"ArrowBackgroundColorDisabled")
-        {
-            m_arrowBackgroundColorDisabledCached = getSharedRenderer()->getArrowBackgroundColorDisabled();
-        }
-        else if (property == U"ArrowColor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == U"ArrowColorHover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if (property == U"ArrowColorDisabled")
-        {
-            m_arrowColorDisabledCached = getSharedRenderer()->getArrowColorDisabled();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteBackgroundDisabled.setOpacity(m_opacityCached);
-            m_spriteArrow.setOpacity(m_opacityCached);
-            m_spriteArrowHover.setOpacity(m_opacityCached);
-            m_spriteArrowDisabled.setOpacity(m_opacityCached);
-
-            m_text.setOpacity(m_opacityCached);
-            m_defaultText.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
-
-            m_text.setFont(m_fontCached);
-            m_defaultText.setFont(m_fontCached);
-            m_listBox->setInheritedFont(m_fontCached);
-
-            setSize(m_size);
-        }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
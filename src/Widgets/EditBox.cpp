@@ -690,145 +690,154 @@ namespace tgui
 
     void EditBox::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            m_paddingCached.updateParentSize(getSize());
-            updateTextSize();
+            case RendererProperty::Borders:
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateAfterRendererChange(&EditBox::reapplySize);
+                break;
 
-            m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
-        }
-        else if (property == U"CaretWidth")
-        {
-            m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
-            m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
-        }
-        else if ((property == U"TextColor") || (property == U"TextColorDisabled") || (property == U"TextColorFocused"))
-        {
-            updateTextColor();
-        }
-        else if (property == U"SelectedTextColor")
-        {
-            m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
-        }
-        else if (property == U"DefaultTextColor")
-        {
-            m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
-        }
-        else if (property == U"Texture")
-        {
-            m_sprite.setTexture(getSharedRenderer()->getTexture());
-        }
-        else if (property == U"TextureHover")
-        {
-            m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
-        }
-        else if (property == U"TextureDisabled")
-        {
-            m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
-        }
-        else if (property == U"TextureFocused")
-        {
-            m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
-        }
-        else if (property == U"TextStyle")
-        {
-            const TextStyles style = getSharedRenderer()->getTextStyle();
-            m_textBeforeSelection.setStyle(style);
-            m_textAfterSelection.setStyle(style);
-            m_textSelection.setStyle(style);
-            m_textSuffix.setStyle(style);
-            m_textFull.setStyle(style);
-
-            // The width of the text can be different, which requires the text to be realigned if it was centered or right-aligned
-            updateTextSize();
-        }
-        else if (property == U"DefaultTextStyle")
-        {
-            m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BorderColorHover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == U"BorderColorDisabled")
-        {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
-        }
-        else if (property == U"BorderColorFocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == U"BackgroundColorDisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == U"BackgroundColorFocused")
-        {
-            m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
-        }
-        else if (property == U"CaretColor")
-        {
-            m_caretColorCached = getSharedRenderer()->getCaretColor();
-        }
-        else if (property == U"CaretColorHover")
-        {
-            m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
-        }
-        else if (property == U"CaretColorFocused")
-        {
-            m_caretColorFocusedCached = getSharedRenderer()->getCaretColorFocused();
-        }
-        else if (property == U"SelectedTextBackgroundColor")
-        {
-            m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            ClickableWidget::rendererChanged(property);
-
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection.setOpacity(m_opacityCached);
-            m_textSelection.setOpacity(m_opacityCached);
-            m_defaultText.setOpacity(m_opacityCached);
-            m_textSuffix.setOpacity(m_opacityCached);
-
-            m_sprite.setOpacity(m_opacityCached);
-            m_spriteHover.setOpacity(m_opacityCached);
-            m_spriteDisabled.setOpacity(m_opacityCached);
-            m_spriteFocused.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            ClickableWidget::rendererChanged(property);
-
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection.setFont(m_fontCached);
-            m_textAfterSelection.setFont(m_fontCached);
-            m_textSuffix.setFont(m_fontCached);
-            m_textFull.setFont(m_fontCached);
-            m_defaultText.setFont(m_fontCached);
-            updateTextSize();
+            case RendererProperty::Padding:
+                m_paddingCached = getSharedRenderer()->getPadding();
+                m_paddingCached.updateParentSize(getSize());
+                updateTextSize();
+
+                m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
+                break;
+
+            case RendererProperty::CaretWidth:
+                m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
+                m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
+                break;
+
+            case RendererProperty::TextColor:
+            case RendererProperty::TextColorDisabled:
+            case RendererProperty::TextColorFocused:
+                updateTextColor();
+                break;
+
+            case RendererProperty::SelectedTextColor:
+                m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
+                break;
+
+            case RendererProperty::DefaultTextColor:
+                m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
+                break;
+
+            case RendererProperty::Texture:
+                m_sprite.setTexture(getSharedRenderer()->getTexture());
+                break;
+
+            case RendererProperty::TextureHover:
+                m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
+                break;
+
+            case RendererProperty::TextureDisabled:
+                m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
+                break;
+
+            case RendererProperty::TextureFocused:
+                m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
+                break;
+
+            case RendererProperty::TextStyle:
+            {
+                const TextStyles style = getSharedRenderer()->getTextStyle();
+                m_textBeforeSelection.setStyle(style);
+                m_textAfterSelection.setStyle(style);
+                m_textSelection.setStyle(style);
+                m_textSuffix.setStyle(style);
+                m_textFull.setStyle(style);
+
+                // The width of the text can be different, which requires the text to be realigned if it was centered or right-aligned
+                updateAfterRendererChange(&EditBox::updateTextSize);
+                break;
+            }
+
+            case RendererProperty::DefaultTextStyle:
+                m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
+                break;
+
+            case RendererProperty::BorderColor:
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case RendererProperty::BorderColorHover:
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+
+            case RendererProperty::BorderColorDisabled:
+                m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+                break;
+
+            case RendererProperty::BorderColorFocused:
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                break;
+
+            case RendererProperty::BackgroundColor:
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case RendererProperty::BackgroundColorHover:
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+
+            case RendererProperty::BackgroundColorDisabled:
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+
+            case RendererProperty::BackgroundColorFocused:
+                m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
+                break;
+
+            case RendererProperty::CaretColor:
+                m_caretColorCached = getSharedRenderer()->getCaretColor();
+                break;
+
+            case RendererProperty::CaretColorHover:
+                m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
+                break;
+
+            case RendererProperty::CaretColorFocused:
+                m_caretColorFocusedCached = getSharedRenderer()->getCaretColorFocused();
+                break;
+
+            case RendererProperty::SelectedTextBackgroundColor:
+                m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
+                break;
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                ClickableWidget::rendererChanged(property);
+
+                m_textBeforeSelection.setOpacity(m_opacityCached);
+                m_textAfterSelection.setOpacity(m_opacityCached);
+                m_textSelection.setOpacity(m_opacityCached);
+                m_defaultText.setOpacity(m_opacityCached);
+                m_textSuffix.setOpacity(m_opacityCached);
+
+                m_sprite.setOpacity(m_opacityCached);
+                m_spriteHover.setOpacity(m_opacityCached);
+                m_spriteDisabled.setOpacity(m_opacityCached);
+                m_spriteFocused.setOpacity(m_opacityCached);
+                break;
+
+            case RendererProperty::Font:
+                ClickableWidget::rendererChanged(property);
+
+                m_textBeforeSelection.setFont(m_fontCached);
+                m_textSelection.setFont(m_fontCached);
+                m_textAfterSelection.setFont(m_fontCached);
+                m_textSuffix.setFont(m_fontCached);
+                m_textFull.setFont(m_fontCached);
+                m_defaultText.setFont(m_fontCached);
+                updateAfterRendererChange(&EditBox::updateTextSize);
+                break;
+
+            default:
+                ClickableWidget::rendererChanged(property);
+                break;
         }
-        else
-            ClickableWidget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1289,6 +1298,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> EditBox::getTimeUntilNextUpdate() const
+    {
+        // The caret only blinks while the widget is focused
+        if (!m_focused)
+            return ClickableWidget::getTimeUntilNextUpdate();
+
+        const Duration blinkRate = getEditCursorBlinkRate();
+        if (m_animationTimeElapsed >= blinkRate)
+            return Duration{};
+
+        const Optional<Duration> timeUntilNextUpdate = ClickableWidget::getTimeUntilNextUpdate();
+        if (timeUntilNextUpdate && (*timeUntilNextUpdate < blinkRate - m_animationTimeElapsed))
+            return timeUntilNextUpdate;
+
+        return blinkRate - m_animationTimeElapsed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::backspaceKeyPressed()
     {
         if (m_readOnly)
@@ -613,6 +613,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Optional<Duration> FileDialog::getTimeUntilNextUpdate() const
+    {
+        const Optional<Duration> timeUntilNextUpdate = ChildWindow::getTimeUntilNextUpdate();
+        if (!m_iconLoader->isLoading())
+            return timeUntilNextUpdate;
+
+        // The icons are loaded in a background thread, so we have to keep checking whether it has finished
+        const Duration pollInterval = std::chrono::milliseconds(10);
+        if (timeUntilNextUpdate && (*timeUntilNextUpdate < pollInterval))
+            return timeUntilNextUpdate;
+
+        return pollInterval;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void FileDialog::changePath(const Filesystem::Path& path, bool updateHistory)
     {
         if (updateHistory && (m_currentDirectory != path))
@@ -1046,90 +1062,98 @@ namespace tgui
 
     void FileDialog::rendererChanged(const String& property)
     {
-        if (property == U"ListView")
-        {
-            m_listView->setRenderer(getSharedRenderer()->getListView());
-        }
-        else if (property == U"EditBox")
-        {
-            const auto& renderer = getSharedRenderer()->getEditBox();
-            m_editBoxFilename->setRenderer(renderer);
-            m_editBoxPath->setRenderer(renderer);
-        }
-        else if (property == U"Button")
-        {
-            const auto& renderer = getSharedRenderer()->getButton();
-            m_buttonCancel->setRenderer(renderer);
-            m_buttonConfirm->setRenderer(renderer);
-
-            if (!getSharedRenderer()->getBackButton())
-                m_buttonBack->setRenderer(renderer);
-            if (!getSharedRenderer()->getForwardButton())
-                m_buttonForward->setRenderer(renderer);
-            if (!getSharedRenderer()->getUpButton())
-                m_buttonUp->setRenderer(renderer);
-        }
-        else if (property == U"BackButton")
-        {
-            if (getSharedRenderer()->getBackButton())
-                m_buttonBack->setRenderer(getSharedRenderer()->getBackButton());
-            else
-                m_buttonBack->setRenderer(getSharedRenderer()->getButton());
-        }
-        else if (property == U"ForwardButton")
-        {
-            if (getSharedRenderer()->getForwardButton())
-                m_buttonForward->setRenderer(getSharedRenderer()->getForwardButton());
-            else
-                m_buttonForward->setRenderer(getSharedRenderer()->getButton());
-        }
-        else if (property == U"UpButton")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            if (getSharedRenderer()->getUpButton())
-                m_buttonUp->setRenderer(getSharedRenderer()->getUpButton());
-            else
-                m_buttonUp->setRenderer(getSharedRenderer()->getButton());
-        }
-        else if (property == U"FilenameLabel")
-        {
-            m_labelFilename->setRenderer(getSharedRenderer()->getFilenameLabel());
-        }
-        else if (property == U"FileTypeComboBox")
-        {
-            m_comboBoxFileTypes->setRenderer(getSharedRenderer()->getFileTypeComboBox());
-        }
-        else if (property == U"ArrowsOnNavigationButtonsVisible")
-        {
-            if (getSharedRenderer()->getArrowsOnNavigationButtonsVisible())
+            case RendererProperty::ListView:
+                m_listView->setRenderer(getSharedRenderer()->getListView());
+                break;
+
+            case RendererProperty::EditBox:
             {
-                m_buttonBack->setText(U"\u2190");
-                m_buttonForward->setText(U"\u2192");
-                m_buttonUp->setText(U"\u2191");
+                const auto& renderer = getSharedRenderer()->getEditBox();
+                m_editBoxFilename->setRenderer(renderer);
+                m_editBoxPath->setRenderer(renderer);
+                break;
             }
-            else
+
+            case RendererProperty::Button:
             {
-                m_buttonBack->setText(U"");
-                m_buttonForward->setText(U"");
-                m_buttonUp->setText(U"");
+                const auto& renderer = getSharedRenderer()->getButton();
+                m_buttonCancel->setRenderer(renderer);
+                m_buttonConfirm->setRenderer(renderer);
+
+                if (!getSharedRenderer()->getBackButton())
+                    m_buttonBack->setRenderer(renderer);
+                if (!getSharedRenderer()->getForwardButton())
+                    m_buttonForward->setRenderer(renderer);
+                if (!getSharedRenderer()->getUpButton())
+                    m_buttonUp->setRenderer(renderer);
+                break;
             }
+
+            case RendererProperty::BackButton:
+                if (getSharedRenderer()->getBackButton())
+                    m_buttonBack->setRenderer(getSharedRenderer()->getBackButton());
+                else
+                    m_buttonBack->setRenderer(getSharedRenderer()->getButton());
+                break;
+
+            case RendererProperty::ForwardButton:
+                if (getSharedRenderer()->getForwardButton())
+                    m_buttonForward->setRenderer(getSharedRenderer()->getForwardButton());
+                else
+                    m_buttonForward->setRenderer(getSharedRenderer()->getButton());
+                break;
+
+            case RendererProperty::UpButton:
+                if (getSharedRenderer()->getUpButton())
+                    m_buttonUp->setRenderer(getSharedRenderer()->getUpButton());
+                else
+                    m_buttonUp->setRenderer(getSharedRenderer()->getButton());
+                break;
+
+            case RendererProperty::FilenameLabel:
+                m_labelFilename->setRenderer(getSharedRenderer()->getFilenameLabel());
+                break;
+
+            case RendererProperty::FileTypeComboBox:
+                m_comboBoxFileTypes->setRenderer(getSharedRenderer()->getFileTypeComboBox());
+                break;
+
+            case RendererProperty::ArrowsOnNavigationButtonsVisible:
+                if (getSharedRenderer()->getArrowsOnNavigationButtonsVisible())
+                {
+                    m_buttonBack->setText(U"\u2190");
+                    m_buttonForward->setText(U"\u2192");
+                    m_buttonUp->setText(U"\u2191");
+                }
+                else
+                {
+                    m_buttonBack->setText(U"");
+                    m_buttonForward->setText(U"");
+                    m_buttonUp->setText(U"");
+                }
+                break;
+
+            case RendererProperty::Font:
+                ChildWindow::rendererChanged(property);
+
+                m_buttonBack->setInheritedFont(m_fontCached);
+                m_buttonForward->setInheritedFont(m_fontCached);
+                m_buttonUp->setInheritedFont(m_fontCached);
+                m_editBoxPath->setInheritedFont(m_fontCached);
+                m_listView->setInheritedFont(m_fontCached);
+                m_labelFilename->setInheritedFont(m_fontCached);
+                m_editBoxFilename->setInheritedFont(m_fontCached);
+                m_comboBoxFileTypes->setInheritedFont(m_fontCached);
+                m_buttonCancel->setInheritedFont(m_fontCached);
+                m_buttonConfirm->setInheritedFont(m_fontCached);
+                break;
+
+            default:
+                ChildWindow::rendererChanged(property);
+                break;
         }
-        else if (property == U"Font")
-        {
-            ChildWindow::rendererChanged(property);
-
-            m_buttonBack->setInheritedFont(m_fontCached);
-            m_buttonForward->setInheritedFont(m_fontCached);
-            m_buttonUp->setInheritedFont(m_fontCached);
-            m_editBoxPath->setInheritedFont(m_fontCached);
-            m_listView->setInheritedFont(m_fontCached);
-            m_labelFilename->setInheritedFont(m_fontCached);
-            m_editBoxFilename->setInheritedFont(m_fontCached);
-            m_comboBoxFileTypes->setInheritedFont(m_fontCached);
-            m_buttonCancel->setInheritedFont(m_fontCached);
-            m_buttonConfirm->setInheritedFont(m_fontCached);
-        }
-        else
-            ChildWindow::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
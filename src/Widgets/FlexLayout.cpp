@@ -0,0 +1,639 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Widgets/FlexLayout.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+#if TGUI_COMPILED_WITH_CPP_VER < 17
+    constexpr const char FlexLayout::StaticWidgetType[];
+#endif
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::FlexLayout(const char* typeName, bool initRenderer) :
+        BoxLayout{typeName, false}
+    {
+        if (initRenderer)
+        {
+            m_renderer = aurora::makeCopied<BoxLayoutRenderer>();
+            setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::FlexLayout(const FlexLayout& other) :
+        BoxLayout       {other},
+        m_items         {other.m_items},
+        m_direction     {other.m_direction},
+        m_wrap          {other.m_wrap},
+        m_justifyContent{other.m_justifyContent},
+        m_alignItems    {other.m_alignItems}
+    {
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+            connectItem(i);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::FlexLayout(FlexLayout&& other) noexcept :
+        BoxLayout       {std::move(other)},
+        m_items         {std::move(other.m_items)},
+        m_direction     {std::move(other.m_direction)},
+        m_wrap          {std::move(other.m_wrap)},
+        m_justifyContent{std::move(other.m_justifyContent)},
+        m_alignItems    {std::move(other.m_alignItems)}
+    {
+        // The handlers that are connected to the children still refer to the other layout
+        disconnectItems();
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+            connectItem(i);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::~FlexLayout()
+    {
+        disconnectItems();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout& FlexLayout::operator= (const FlexLayout& other)
+    {
+        // Make sure it is not the same widget
+        if (this != &other)
+        {
+            disconnectItems();
+
+            BoxLayout::operator=(other);
+            m_items          = other.m_items;
+            m_direction      = other.m_direction;
+            m_wrap           = other.m_wrap;
+            m_justifyContent = other.m_justifyContent;
+            m_alignItems     = other.m_alignItems;
+
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+                connectItem(i);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout& FlexLayout::operator= (FlexLayout&& other) noexcept
+    {
+        if (this != &other)
+        {
+            disconnectItems();
+            other.disconnectItems();
+
+            BoxLayout::operator=(std::move(other));
+            m_items          = std::move(other.m_items);
+            m_direction      = std::move(other.m_direction);
+            m_wrap           = std::move(other.m_wrap);
+            m_justifyContent = std::move(other.m_justifyContent);
+            m_alignItems     = std::move(other.m_alignItems);
+
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+                connectItem(i);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::Ptr FlexLayout::create(const Layout2d& size)
+    {
+        auto layout = std::make_shared<FlexLayout>();
+        layout->setSize(size);
+        return layout;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::Ptr FlexLayout::copy(const FlexLayout::ConstPtr& layout)
+    {
+        if (layout)
+            return std::static_pointer_cast<FlexLayout>(layout->clone());
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::insert(std::size_t index, const Widget::Ptr& widget, const String& widgetName)
+    {
+        if (index > m_items.size())
+            index = m_items.size();
+
+        // The widgets are only arranged after the preferred size of the new widget is known
+        beginUpdate();
+
+        m_items.insert(m_items.begin() + static_cast<std::ptrdiff_t>(index), Item{});
+        BoxLayout::insert(index, widget, widgetName);
+
+        // The preferred size is measured after the widget has a parent, so that relative sizes are resolved
+        m_items[index].preferredSize = widget->getFullSize();
+        connectItem(index);
+
+        endUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::remove(std::size_t index)
+    {
+        if (index < m_items.size())
+        {
+            m_widgets[index]->onSizeChange.disconnect(m_items[index].sizeChangeConnection);
+            m_items.erase(m_items.begin() + static_cast<std::ptrdiff_t>(index));
+        }
+
+        return BoxLayout::remove(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::removeAllWidgets()
+    {
+        disconnectItems();
+        m_items.clear();
+        BoxLayout::removeAllWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::setDirection(Direction direction)
+    {
+        m_direction = direction;
+        requestWidgetsUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::Direction FlexLayout::getDirection() const
+    {
+        return m_direction;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::setWrap(bool wrap)
+    {
+        m_wrap = wrap;
+        requestWidgetsUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::getWrap() const
+    {
+        return m_wrap;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::setJustifyContent(JustifyContent justify)
+    {
+        m_justifyContent = justify;
+        requestWidgetsUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::JustifyContent FlexLayout::getJustifyContent() const
+    {
+        return m_justifyContent;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::setAlignItems(AlignItems align)
+    {
+        m_alignItems = align;
+        requestWidgetsUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FlexLayout::AlignItems FlexLayout::getAlignItems() const
+    {
+        return m_alignItems;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::setItemGrow(const Widget::Ptr& widget, float grow)
+    {
+        const std::size_t index = findWidgetIndex(widget.get());
+        if (index >= m_items.size())
+            return false;
+
+        m_items[index].grow = std::max(0.f, grow);
+        requestWidgetsUpdate();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float FlexLayout::getItemGrow(const Widget::Ptr& widget) const
+    {
+        const std::size_t index = findWidgetIndex(widget.get());
+        return (index < m_items.size()) ? m_items[index].grow : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::setItemShrink(const Widget::Ptr& widget, float shrink)
+    {
+        const std::size_t index = findWidgetIndex(widget.get());
+        if (index >= m_items.size())
+            return false;
+
+        m_items[index].shrink = std::max(0.f, shrink);
+        requestWidgetsUpdate();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float FlexLayout::getItemShrink(const Widget::Ptr& widget) const
+    {
+        const std::size_t index = findWidgetIndex(widget.get());
+        return (index < m_items.size()) ? m_items[index].shrink : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FlexLayout::setItemBasis(const Widget::Ptr& widget, float basis)
+    {
+        const std::size_t index = findWidgetIndex(widget.get());
+        if (index >= m_items.size())
+            return false;
+
+        m_items[index].basis = (basis < 0) ? -1.f : basis;
+        requestWidgetsUpdate();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float FlexLayout::getItemBasis(const Widget::Ptr& widget) const
+    {
+        const std::size_t index = findWidgetIndex(widget.get());
+        return (index < m_items.size()) ? m_items[index].basis : -1.f;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f FlexLayout::getItemPreferredSize(const Widget::Ptr& widget) const
+    {
+        const std::size_t index = findWidgetIndex(widget.get());
+        return (index < m_items.size()) ? m_items[index].preferredSize : Vector2f{};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::updateWidgets()
+    {
+        // The widgets and items can temporarily differ while the layout is being copied
+        if (m_items.size() != m_widgets.size())
+            return;
+
+        const bool row = (m_direction == Direction::Row);
+        const auto mainOf = [row](Vector2f vec){ return row ? vec.x : vec.y; };
+        const auto crossOf = [row](Vector2f vec){ return row ? vec.y : vec.x; };
+        const auto toVector = [row](float main, float cross){ return row ? Vector2f{main, cross} : Vector2f{cross, main}; };
+
+        const Vector2f contentSize = {getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(),
+                                      getSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()};
+        const float containerMainSize = mainOf(contentSize);
+        const float gap = m_spaceBetweenWidgetsCached;
+
+        m_arrangingWidgets = true;
+
+        float lineCrossOffset = 0;
+        std::size_t lineStart = 0;
+        while (lineStart < m_items.size())
+        {
+            // Find the children that fit on this line and sum their basis sizes
+            float usedMainSize = 0;
+            float totalGrow = 0;
+            float totalScaledShrink = 0;
+            float lineCrossSize = 0;
+            std::size_t lineEnd = lineStart;
+            for (; lineEnd < m_items.size(); ++lineEnd)
+            {
+                Item& item = m_items[lineEnd];
+                item.mainSize = (item.basis >= 0) ? item.basis : mainOf(item.preferredSize);
+
+                const float gapBefore = (lineEnd > lineStart) ? gap : 0;
+                if (m_wrap && (lineEnd > lineStart) && (usedMainSize + gapBefore + item.mainSize > containerMainSize))
+                    break;
+
+                usedMainSize += gapBefore + item.mainSize;
+                totalGrow += item.grow;
+                totalScaledShrink += item.shrink * item.mainSize;
+                lineCrossSize = std::max(lineCrossSize, crossOf(item.preferredSize));
+            }
+
+            if (!m_wrap)
+                lineCrossSize = crossOf(contentSize);
+
+            // Let the children grow or shrink to fill the line
+            const float freeSpace = containerMainSize - usedMainSize;
+            float remainingSpace = freeSpace;
+            for (std::size_t i = lineStart; i < lineEnd; ++i)
+            {
+                Item& item = m_items[i];
+                const float basis = item.mainSize;
+                if ((freeSpace > 0) && (totalGrow > 0))
+                    item.mainSize += freeSpace * (item.grow / totalGrow);
+                else if ((freeSpace < 0) && (totalScaledShrink > 0))
+                    item.mainSize += freeSpace * (item.shrink * item.mainSize / totalScaledShrink);
+
+                item.mainSize = std::max(0.f, item.mainSize);
+                remainingSpace -= item.mainSize - basis;
+            }
+
+            // Distribute the space that is still left between the children
+            const std::size_t itemCount = lineEnd - lineStart;
+            float mainOffset = 0;
+            float extraGap = 0;
+            if (remainingSpace > 0)
+            {
+                switch (m_justifyContent)
+                {
+                case JustifyContent::Start:
+                    break;
+                case JustifyContent::End:
+                    mainOffset = remainingSpace;
+                    break;
+                case JustifyContent::Center:
+                    mainOffset = remainingSpace / 2.f;
+                    break;
+                case JustifyContent::SpaceBetween:
+                    if (itemCount > 1)
+                        extraGap = remainingSpace / static_cast<float>(itemCount - 1);
+                    break;
+                case JustifyContent::SpaceAround:
+                    extraGap = remainingSpace / static_cast<float>(itemCount);
+                    mainOffset = extraGap / 2.f;
+                    break;
+                case JustifyContent::SpaceEvenly:
+                    extraGap = remainingSpace / static_cast<float>(itemCount + 1);
+                    mainOffset = extraGap;
+                    break;
+                }
+            }
+
+            // Position and resize the children
+            for (std::size_t i = lineStart; i < lineEnd; ++i)
+            {
+                const Item& item = m_items[i];
+                auto& widget = m_widgets[i];
+
+                float crossSize = crossOf(item.preferredSize);
+                float crossOffset = 0;
+                switch (m_alignItems)
+                {
+                case AlignItems::Start:
+                    break;
+                case AlignItems::End:
+                    crossOffset = lineCrossSize - crossSize;
+                    break;
+                case AlignItems::Center:
+                    crossOffset = (lineCrossSize - crossSize) / 2.f;
+                    break;
+                case AlignItems::Stretch:
+                    crossSize = lineCrossSize;
+                    break;
+                }
+
+                // The size excludes parts of the widget that lie outside its bounds (e.g. the text next to a checkbox)
+                const Vector2f extraSize = widget->getFullSize() - widget->getSize();
+                const Vector2f newSize = {std::max(0.f, toVector(item.mainSize, crossSize).x - extraSize.x),
+                                          std::max(0.f, toVector(item.mainSize, crossSize).y - extraSize.y)};
+                if (widget->getSize() != newSize)
+                    widget->setSize(newSize);
+
+                const Vector2f newPosition = toVector(mainOffset, lineCrossOffset + crossOffset) - widget->getWidgetOffset();
+                if (widget->getPosition() != newPosition)
+                    widget->setPosition(newPosition);
+
+                mainOffset += item.mainSize + gap + extraGap;
+            }
+
+            lineCrossOffset += lineCrossSize + gap;
+            lineStart = lineEnd;
+        }
+
+        m_arrangingWidgets = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> FlexLayout::save(SavingRenderersMap& renderers) const
+    {
+        auto node = BoxLayout::save(renderers);
+
+        if (m_direction == Direction::Column)
+            node->propertyValuePairs[U"Direction"] = std::make_unique<DataIO::ValueNode>("Column");
+
+        if (m_wrap)
+            node->propertyValuePairs[U"Wrap"] = std::make_unique<DataIO::ValueNode>("true");
+
+        if (m_justifyContent == JustifyContent::End)
+            node->propertyValuePairs[U"JustifyContent"] = std::make_unique<DataIO::ValueNode>("End");
+        else if (m_justifyContent == JustifyContent::Center)
+            node->propertyValuePairs[U"JustifyContent"] = std::make_unique<DataIO::ValueNode>("Center");
+        else if (m_justifyContent == JustifyContent::SpaceBetween)
+            node->propertyValuePairs[U"JustifyContent"] = std::make_unique<DataIO::ValueNode>("SpaceBetween");
+        else if (m_justifyContent == JustifyContent::SpaceAround)
+            node->propertyValuePairs[U"JustifyContent"] = std::make_unique<DataIO::ValueNode>("SpaceAround");
+        else if (m_justifyContent == JustifyContent::SpaceEvenly)
+            node->propertyValuePairs[U"JustifyContent"] = std::make_unique<DataIO::ValueNode>("SpaceEvenly");
+
+        if (m_alignItems == AlignItems::Start)
+            node->propertyValuePairs[U"AlignItems"] = std::make_unique<DataIO::ValueNode>("Start");
+        else if (m_alignItems == AlignItems::End)
+            node->propertyValuePairs[U"AlignItems"] = std::make_unique<DataIO::ValueNode>("End");
+        else if (m_alignItems == AlignItems::Center)
+            node->propertyValuePairs[U"AlignItems"] = std::make_unique<DataIO::ValueNode>("Center");
+
+        if (!m_items.empty())
+        {
+            // The children are saved with the size given by the layout, so their preferred sizes have to be stored as well
+            String growList = "[" + Serializer::serialize(m_items[0].grow);
+            String shrinkList = "[" + Serializer::serialize(m_items[0].shrink);
+            String basisList = "[" + Serializer::serialize(m_items[0].basis);
+            String widthList = "[" + Serializer::serialize(m_items[0].preferredSize.x);
+            String heightList = "[" + Serializer::serialize(m_items[0].preferredSize.y);
+            for (std::size_t i = 1; i < m_items.size(); ++i)
+            {
+                growList += ", " + Serializer::serialize(m_items[i].grow);
+                shrinkList += ", " + Serializer::serialize(m_items[i].shrink);
+                basisList += ", " + Serializer::serialize(m_items[i].basis);
+                widthList += ", " + Serializer::serialize(m_items[i].preferredSize.x);
+                heightList += ", " + Serializer::serialize(m_items[i].preferredSize.y);
+            }
+
+            node->propertyValuePairs[U"Grow"] = std::make_unique<DataIO::ValueNode>(growList + "]");
+            node->propertyValuePairs[U"Shrink"] = std::make_unique<DataIO::ValueNode>(shrinkList + "]");
+            node->propertyValuePairs[U"Basis"] = std::make_unique<DataIO::ValueNode>(basisList + "]");
+            node->propertyValuePairs[U"PreferredWidths"] = std::make_unique<DataIO::ValueNode>(widthList + "]");
+            node->propertyValuePairs[U"PreferredHeights"] = std::make_unique<DataIO::ValueNode>(heightList + "]");
+        }
+
+        return node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers)
+    {
+        beginUpdate();
+        BoxLayout::load(node, renderers);
+
+        if (node->propertyValuePairs[U"Direction"])
+        {
+            const String direction = Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs[U"Direction"]->value).getString();
+            if (direction == U"Column")
+                setDirection(Direction::Column);
+            else if (direction == U"Row")
+                setDirection(Direction::Row);
+            else
+                throw Exception{U"Failed to parse Direction property, found unknown value."};
+        }
+
+        if (node->propertyValuePairs[U"Wrap"])
+            setWrap(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs[U"Wrap"]->value).getBool());
+
+        if (node->propertyValuePairs[U"JustifyContent"])
+        {
+            const String justify = Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs[U"JustifyContent"]->value).getString();
+            if (justify == U"Start")
+                setJustifyContent(JustifyContent::Start);
+            else if (justify == U"End")
+                setJustifyContent(JustifyContent::End);
+            else if (justify == U"Center")
+                setJustifyContent(JustifyContent::Center);
+            else if (justify == U"SpaceBetween")
+                setJustifyContent(JustifyContent::SpaceBetween);
+            else if (justify == U"SpaceAround")
+                setJustifyContent(JustifyContent::SpaceAround);
+            else if (justify == U"SpaceEvenly")
+                setJustifyContent(JustifyContent::SpaceEvenly);
+            else
+                throw Exception{U"Failed to parse JustifyContent property, found unknown value."};
+        }
+
+        if (node->propertyValuePairs[U"AlignItems"])
+        {
+            const String align = Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs[U"AlignItems"]->value).getString();
+            if (align == U"Start")
+                setAlignItems(AlignItems::Start);
+            else if (align == U"End")
+                setAlignItems(AlignItems::End);
+            else if (align == U"Center")
+                setAlignItems(AlignItems::Center);
+            else if (align == U"Stretch")
+                setAlignItems(AlignItems::Stretch);
+            else
+                throw Exception{U"Failed to parse AlignItems property, found unknown value."};
+        }
+
+        const auto loadItemValues = [this,&node](const String& property, const std::function<void(Item&, float)>& setValue){
+            if (!node->propertyValuePairs[property])
+                return;
+
+            if (!node->propertyValuePairs[property]->listNode)
+                throw Exception{U"Failed to parse '" + property + U"' property, expected a list as value"};
+
+            if (node->propertyValuePairs[property]->valueList.size() != m_items.size())
+                throw Exception{U"Amounts of values for '" + property + U"' differs from the amount in child widgets"};
+
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+                setValue(m_items[i], Deserializer::deserialize(ObjectConverter::Type::Number, node->propertyValuePairs[property]->valueList[i]).getNumber());
+        };
+
+        loadItemValues(U"Grow", [](Item& item, float value){ item.grow = value; });
+        loadItemValues(U"Shrink", [](Item& item, float value){ item.shrink = value; });
+        loadItemValues(U"Basis", [](Item& item, float value){ item.basis = value; });
+        loadItemValues(U"PreferredWidths", [](Item& item, float value){ item.preferredSize.x = value; });
+        loadItemValues(U"PreferredHeights", [](Item& item, float value){ item.preferredSize.y = value; });
+
+        requestWidgetsUpdate();
+        endUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr FlexLayout::clone() const
+    {
+        return std::make_shared<FlexLayout>(*this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::connectItem(std::size_t index)
+    {
+        const Widget* widget = m_widgets[index].get();
+        m_items[index].sizeChangeConnection = m_widgets[index]->onSizeChange([this,widget]{ itemSizeChanged(widget); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::disconnectItems()
+    {
+        for (std::size_t i = 0; (i < m_items.size()) && (i < m_widgets.size()); ++i)
+            m_widgets[i]->onSizeChange.disconnect(m_items[i].sizeChangeConnection);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FlexLayout::itemSizeChanged(const Widget* widget)
+    {
+        if (m_arrangingWidgets)
+            return;
+
+        const std::size_t index = findWidgetIndex(widget);
+        if (index >= m_items.size())
+            return;
+
+        m_items[index].preferredSize = m_widgets[index]->getFullSize();
+        requestWidgetsUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
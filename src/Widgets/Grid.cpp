@@ -83,7 +83,7 @@ namespace tgui
 
         m_connectedSizeCallbacks.clear();
         for (auto& widget : m_widgets)
-            m_connectedSizeCallbacks[widget] = widget->onSizeChange([this](){ updateWidgets(); });
+            m_connectedSizeCallbacks[widget] = widget->onSizeChange([this](){ requestWidgetsUpdate(); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -138,7 +138,7 @@ namespace tgui
 
             m_connectedSizeCallbacks.clear();
             for (auto& widget : m_widgets)
-                m_connectedSizeCallbacks[widget] = widget->onSizeChange([this](){ updateWidgets(); });
+                m_connectedSizeCallbacks[widget] = widget->onSizeChange([this](){ requestWidgetsUpdate(); });
         }
 
         return *this;
@@ -266,7 +266,7 @@ namespace tgui
 
         m_connectedSizeCallbacks.clear();
 
-        updateWidgets();
+        requestWidgetsUpdate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -331,10 +331,10 @@ namespace tgui
         m_widgetCells[widget] = std::make_pair(row, col);
 
         // Update the widgets
-        updateWidgets();
+        requestWidgetsUpdate();
 
         // Automatically update the widgets when their size changes
-        m_connectedSizeCallbacks[widget] = widget->onSizeChange([this](){ updateWidgets(); });
+        m_connectedSizeCallbacks[widget] = widget->onSizeChange([this](){ requestWidgetsUpdate(); });
 
         return true;
     }
@@ -379,7 +379,7 @@ namespace tgui
             m_objPadding[row][col] = padding;
 
             // Update all widgets
-            updateWidgets();
+            requestWidgetsUpdate();
         }
     }
 
@@ -661,6 +661,13 @@ namespace tgui
 
     void Grid::updatePositionsOfAllWidgets()
     {
+        // The widgets will be repositioned when the batch of changes ends
+        if (isUpdating())
+        {
+            requestWidgetsUpdate();
+            return;
+        }
+
         Vector2f position;
 
         // Fill the entire space when a size was given
@@ -135,13 +135,17 @@ namespace tgui
 
     void Group::rendererChanged(const String& property)
     {
-        if (property == U"Padding")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            case RendererProperty::Padding:
+                m_paddingCached = getSharedRenderer()->getPadding();
+                updateAfterRendererChange(&Group::reapplySize);
+                break;
+
+            default:
+                Container::rendererChanged(property);
+                break;
         }
-        else
-            Container::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
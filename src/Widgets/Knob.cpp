@@ -469,46 +469,51 @@ namespace tgui
 
     void Knob::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            case RendererProperty::Borders:
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateAfterRendererChange(&Knob::reapplySize);
+                break;
+
+            case RendererProperty::TextureBackground:
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                updateAfterRendererChange(&Knob::reapplySize);
+                break;
+
+            case RendererProperty::TextureForeground:
+                m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
+                updateAfterRendererChange(&Knob::reapplySize);
+                break;
+
+            case RendererProperty::BorderColor:
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case RendererProperty::BackgroundColor:
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case RendererProperty::ThumbColor:
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+
+            case RendererProperty::ImageRotation:
+                m_imageRotationCached = getSharedRenderer()->getImageRotation();
+                break;
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteForeground.setOpacity(m_opacityCached);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-            setSize(m_size);
-        }
-        else if (property == U"TextureForeground")
-        {
-            m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
-            setSize(m_size);
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"ThumbColor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == U"ImageRotation")
-        {
-            m_imageRotationCached = getSharedRenderer()->getImageRotation();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteForeground.setOpacity(m_opacityCached);
-        }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
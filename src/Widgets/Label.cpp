@@ -49,7 +49,6 @@ namespace tgui
             setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
         }
 
-        m_scrollbar->setVisible(false);
         setTextSize(getGlobalTextSize());
     }
 
@@ -105,8 +104,11 @@ namespace tgui
         m_bordersCached.updateParentSize(getSize());
         m_paddingCached.updateParentSize(getSize());
 
-        m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
-                                    getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
+        if (m_spriteBackground)
+        {
+            m_spriteBackground->setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
+                                         getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
+        }
 
         // You are no longer auto-sizing
         m_autoSize = false;
@@ -187,14 +189,14 @@ namespace tgui
 
     void Label::setScrollbarValue(unsigned int value)
     {
-        m_scrollbar->setValue(value);
+        getScrollbarWidget().setValue(value);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int Label::getScrollbarValue() const
     {
-        return m_scrollbar->getValue();
+        return m_scrollbar ? m_scrollbar->getValue() : 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -280,7 +282,7 @@ namespace tgui
 
     void Label::leftMousePressed(Vector2f pos)
     {
-        if (m_scrollbar->isShown() && m_scrollbar->isMouseOnWidget(pos - getPosition()))
+        if (m_scrollbar && m_scrollbar->isShown() && m_scrollbar->isMouseOnWidget(pos - getPosition()))
         {
             m_mouseDown = true;
             m_scrollbar->leftMousePressed(pos - getPosition());
@@ -293,7 +295,7 @@ namespace tgui
 
     void Label::leftMouseReleased(Vector2f pos)
     {
-        if (!m_scrollbar->isShown() || !m_scrollbar->isMouseDown())
+        if (!m_scrollbar || !m_scrollbar->isShown() || !m_scrollbar->isMouseDown())
         {
             const bool mouseDown = m_mouseDown;
             ClickableWidget::leftMouseReleased(pos);
@@ -318,7 +320,7 @@ namespace tgui
         else
             m_mouseDown = false;
 
-        if (m_scrollbar->isShown())
+        if (m_scrollbar && m_scrollbar->isShown())
             m_scrollbar->leftMouseReleased(pos - getPosition());
     }
 
@@ -326,13 +328,13 @@ namespace tgui
 
     void Label::mouseMoved(Vector2f pos)
     {
-        if (m_scrollbar->isShown() && ((m_scrollbar->isMouseDown() && m_scrollbar->isMouseDownOnThumb()) || m_scrollbar->isMouseOnWidget(pos - getPosition())))
+        if (m_scrollbar && m_scrollbar->isShown() && ((m_scrollbar->isMouseDown() && m_scrollbar->isMouseDownOnThumb()) || m_scrollbar->isMouseOnWidget(pos - getPosition())))
             m_scrollbar->mouseMoved(pos - getPosition());
         else
         {
             ClickableWidget::mouseMoved(pos);
 
-            if (m_scrollbar->isShown())
+            if (m_scrollbar && m_scrollbar->isShown())
                 m_scrollbar->mouseNoLongerOnWidget();
         }
     }
@@ -341,7 +343,7 @@ namespace tgui
 
     bool Label::mouseWheelScrolled(float delta, Vector2f pos)
     {
-        if (!m_autoSize && m_scrollbar->isShown())
+        if (!m_autoSize && m_scrollbar && m_scrollbar->isShown())
             return m_scrollbar->mouseWheelScrolled(delta, pos - getPosition());
 
         return false;
@@ -352,7 +354,8 @@ namespace tgui
     void Label::mouseNoLongerOnWidget()
     {
         ClickableWidget::mouseNoLongerOnWidget();
-        m_scrollbar->mouseNoLongerOnWidget();
+        if (m_scrollbar)
+            m_scrollbar->mouseNoLongerOnWidget();
         m_possibleDoubleClick = false;
     }
 
@@ -361,7 +364,8 @@ namespace tgui
     void Label::leftMouseButtonNoLongerDown()
     {
         ClickableWidget::leftMouseButtonNoLongerDown();
-        m_scrollbar->leftMouseButtonNoLongerDown();
+        if (m_scrollbar)
+            m_scrollbar->leftMouseButtonNoLongerDown();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -378,97 +382,131 @@ namespace tgui
 
     void Label::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            m_bordersCached.updateParentSize(getSize());
-            m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
-                                        getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
-            rearrangeText();
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            m_paddingCached.updateParentSize(getSize());
-            rearrangeText();
-        }
-        else if (property == U"TextStyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
-            rearrangeText();
-        }
-        else if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            for (auto& line : m_lines)
-            {
-                for (auto& textPiece : line)
-                    textPiece.setColor(m_textColorCached);
-            }
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextOutlineThickness")
-        {
-            m_textOutlineThicknessCached = getSharedRenderer()->getTextOutlineThickness();
-            rearrangeText();
-        }
-        else if (property == U"TextOutlineColor")
-        {
-            m_textOutlineColorCached = getSharedRenderer()->getTextOutlineColor();
-            for (auto& line : m_lines)
-            {
-                for (auto& textPiece : line)
-                    textPiece.setOutlineColor(m_textOutlineColorCached);
-            }
-        }
-        else if (property == U"Scrollbar")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            case RendererProperty::Borders:
+                m_bordersCached = getSharedRenderer()->getBorders();
+                m_bordersCached.updateParentSize(getSize());
+                if (m_spriteBackground)
+                {
+                    m_spriteBackground->setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
+                                                 getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
+                }
+                updateAfterRendererChange(&Label::rearrangeText);
+                break;
+
+            case RendererProperty::Padding:
+                m_paddingCached = getSharedRenderer()->getPadding();
+                m_paddingCached.updateParentSize(getSize());
+                updateAfterRendererChange(&Label::rearrangeText);
+                break;
+
+            case RendererProperty::TextStyle:
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
+                updateAfterRendererChange(&Label::rearrangeText);
+                break;
+
+            case RendererProperty::TextColor:
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                for (auto& line : m_lines)
+                {
+                    for (auto& textPiece : line)
+                        textPiece.setColor(m_textColorCached);
+                }
+                break;
+
+            case RendererProperty::BorderColor:
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+            case RendererProperty::BackgroundColor:
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case RendererProperty::TextureBackground:
             {
-                m_scrollbar->setSize({m_scrollbar->getDefaultWidth(), m_scrollbar->getSize().y});
-                rearrangeText();
+                const Texture& texture = getSharedRenderer()->getTextureBackground();
+                if (texture.getData())
+                {
+                    if (!m_spriteBackground)
+                    {
+                        m_spriteBackground = aurora::makeCopied<Sprite>();
+                        m_spriteBackground->setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
+                                                     getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
+                        m_spriteBackground->setOpacity(m_opacityCached);
+                    }
+
+                    m_spriteBackground->setTexture(texture);
+                }
+                else
+                    m_spriteBackground = nullptr;
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
-            m_scrollbar->setSize({width, m_scrollbar->getSize().y});
-            rearrangeText();
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
-            rearrangeText();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_scrollbar->setInheritedOpacity(m_opacityCached);
+            case RendererProperty::TextOutlineThickness:
+                m_textOutlineThicknessCached = getSharedRenderer()->getTextOutlineThickness();
+                updateAfterRendererChange(&Label::rearrangeText);
+                break;
+
+            case RendererProperty::TextOutlineColor:
+                m_textOutlineColorCached = getSharedRenderer()->getTextOutlineColor();
+                for (auto& line : m_lines)
+                {
+                    for (auto& textPiece : line)
+                        textPiece.setOutlineColor(m_textOutlineColorCached);
+                }
+                break;
+
+            case RendererProperty::Scrollbar:
+                if (!m_scrollbar)
+                    break;
 
-            for (auto& line : m_lines)
+                m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    m_scrollbar->setSize({m_scrollbar->getDefaultWidth(), m_scrollbar->getSize().y});
+                    updateAfterRendererChange(&Label::rearrangeText);
+                }
+                break;
+
+            case RendererProperty::ScrollbarWidth:
             {
-                for (auto& textPiece : line)
-                    textPiece.setOpacity(m_opacityCached);
+                if (!m_scrollbar)
+                    break;
+
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
+                m_scrollbar->setSize({width, m_scrollbar->getSize().y});
+                updateAfterRendererChange(&Label::rearrangeText);
+                break;
             }
+
+            case RendererProperty::Font:
+                Widget::rendererChanged(property);
+                updateAfterRendererChange(&Label::rearrangeText);
+                break;
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Widget::rendererChanged(property);
+
+                if (m_spriteBackground)
+                    m_spriteBackground->setOpacity(m_opacityCached);
+                if (m_scrollbar)
+                    m_scrollbar->setInheritedOpacity(m_opacityCached);
+
+                for (auto& line : m_lines)
+                {
+                    for (auto& textPiece : line)
+                        textPiece.setOpacity(m_opacityCached);
+                }
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -585,26 +623,7 @@ namespace tgui
 
         const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
 
-        // Show or hide the scrollbar
-        if (m_autoSize)
-            m_scrollbar->setVisible(false);
-        else
-        {
-            if (m_scrollbarPolicy == Scrollbar::Policy::Always)
-            {
-                m_scrollbar->setVisible(true);
-                m_scrollbar->setAutoHide(false);
-            }
-            else if (m_scrollbarPolicy == Scrollbar::Policy::Never)
-            {
-                m_scrollbar->setVisible(false);
-            }
-            else // Scrollbar::Policy::Automatic
-            {
-                m_scrollbar->setVisible(true);
-                m_scrollbar->setAutoHide(true);
-            }
-        }
+        updateScrollbarVisibility();
 
         // Find the maximum width of one line
         float maxWidth;
@@ -657,11 +676,14 @@ namespace tgui
                                    + Text::getExtraVerticalPadding(m_textSizeCached);
             }
 
-            m_scrollbar->setSize(m_scrollbar->getSize().x, static_cast<unsigned int>(getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()));
-            m_scrollbar->setViewportSize(static_cast<unsigned int>(getSize().y - outline.getTop() - outline.getBottom()));
-            m_scrollbar->setMaximum(static_cast<unsigned int>(requiredTextHeight));
-            m_scrollbar->setPosition({getSize().x - m_bordersCached.getRight() - m_scrollbar->getSize().x, m_bordersCached.getTop()});
-            m_scrollbar->setScrollAmount(m_textSizeCached);
+            if (m_scrollbar)
+            {
+                m_scrollbar->setSize(m_scrollbar->getSize().x, static_cast<unsigned int>(getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()));
+                m_scrollbar->setViewportSize(static_cast<unsigned int>(getSize().y - outline.getTop() - outline.getBottom()));
+                m_scrollbar->setMaximum(static_cast<unsigned int>(requiredTextHeight));
+                m_scrollbar->setPosition({getSize().x - m_bordersCached.getRight() - m_scrollbar->getSize().x, m_bordersCached.getTop()});
+                m_scrollbar->setScrollAmount(m_textSizeCached);
+            }
         }
 
         // Split the string in multiple lines
@@ -700,8 +722,11 @@ namespace tgui
             m_bordersCached.updateParentSize(getSize());
             m_paddingCached.updateParentSize(getSize());
 
-            m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
-                                        getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
+            if (m_spriteBackground)
+            {
+                m_spriteBackground->setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
+                                             getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
+            }
         }
 
         updateTextPiecePositions((maxWidth > 0) ? maxWidth : width);
@@ -761,7 +786,7 @@ namespace tgui
             if (lastLineFontHeight > lastLineLineSpacing)
                 totalTextHeight += (lastLineFontHeight - lastLineLineSpacing);
 
-            if (!m_scrollbar->isShown() || (totalTextHeight < totalHeight))
+            if (!m_scrollbar || !m_scrollbar->isShown() || (totalTextHeight < totalHeight))
             {
                 if (m_verticalAlignment == VerticalAlignment::Bottom)
                     pos.y += totalHeight - totalTextHeight;
@@ -835,6 +860,45 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Label::updateScrollbarVisibility()
+    {
+        if (m_autoSize || (m_scrollbarPolicy == Scrollbar::Policy::Never))
+        {
+            if (m_scrollbar)
+                m_scrollbar->setVisible(false);
+        }
+        else
+        {
+            ScrollbarChildWidget& scrollbar = getScrollbarWidget();
+            scrollbar.setVisible(true);
+            scrollbar.setAutoHide(m_scrollbarPolicy == Scrollbar::Policy::Automatic);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ScrollbarChildWidget& Label::getScrollbarWidget()
+    {
+        if (!m_scrollbar)
+        {
+            m_scrollbar = CopiedSharedPtr<ScrollbarChildWidget>{};
+            m_scrollbar->setVisible(false);
+
+            // Only take over the scrollbar renderer when the label has one, getScrollbar() would otherwise add it to our renderer
+            const auto& properties = getSharedRenderer()->getPropertyValuePairs();
+            if (properties.find(RendererProperty::Scrollbar) != properties.end())
+                m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
+            m_scrollbar->setSize({width, m_scrollbar->getSize().y});
+            m_scrollbar->setInheritedOpacity(m_opacityCached);
+        }
+
+        return *m_scrollbar;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::draw(BackendRenderTarget& target, RenderStates states) const
     {
         const RenderStates statesForScrollbar = states;
@@ -850,13 +914,13 @@ namespace tgui
         }
 
         // Draw the background
-        if (m_spriteBackground.isSet())
-            target.drawSprite(states, m_spriteBackground);
+        if (m_spriteBackground)
+            target.drawSprite(states, *m_spriteBackground);
         else if (m_backgroundColorCached.isSet() && (m_backgroundColorCached != Color::Transparent))
             target.drawFilledRect(states, innerSize, Color::applyOpacity(m_backgroundColorCached, m_opacityCached));
 
         // Draw the scrollbar
-        if (m_scrollbar->isVisible())
+        if (m_scrollbar && m_scrollbar->isVisible())
             m_scrollbar->draw(target, statesForScrollbar);
 
         // Draw the text
@@ -875,7 +939,7 @@ namespace tgui
 
             target.addClippingLayer(states, {{m_paddingCached.getLeft(), m_paddingCached.getTop()}, innerSize});
 
-            if (m_scrollbar->isShown())
+            if (m_scrollbar && m_scrollbar->isShown())
                 states.transform.translate({0, -static_cast<float>(m_scrollbar->getValue())});
 
             for (const auto& line : m_lines)
@@ -767,127 +767,134 @@ namespace tgui
 
     void ListBox::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateItemColorsAndStyle();
-        }
-        else if (property == U"TextColorHover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateItemColorsAndStyle();
-        }
-        else if (property == U"SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateItemColorsAndStyle();
-        }
-        else if (property == U"SelectedTextColorHover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateItemColorsAndStyle();
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextStyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
-
-            for (auto& item : m_items)
-                item.text.setStyle(m_textStyleCached);
+            case RendererProperty::Borders:
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateAfterRendererChange(&ListBox::reapplySize);
+                break;
+
+            case RendererProperty::Padding:
+                m_paddingCached = getSharedRenderer()->getPadding();
+                updateAfterRendererChange(&ListBox::reapplySize);
+                break;
+
+            case RendererProperty::TextColor:
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateAfterRendererChange(&ListBox::updateItemColorsAndStyle);
+                break;
+
+            case RendererProperty::TextColorHover:
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateAfterRendererChange(&ListBox::updateItemColorsAndStyle);
+                break;
+
+            case RendererProperty::SelectedTextColor:
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateAfterRendererChange(&ListBox::updateItemColorsAndStyle);
+                break;
+
+            case RendererProperty::SelectedTextColorHover:
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateAfterRendererChange(&ListBox::updateItemColorsAndStyle);
+                break;
+
+            case RendererProperty::TextureBackground:
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+
+            case RendererProperty::TextStyle:
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
 
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_selectedTextStyleCached);
-        }
-        else if (property == U"SelectedTextStyle")
-        {
-            m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
+                for (auto& item : m_items)
+                    item.text.setStyle(m_textStyleCached);
 
-            if (m_selectedItem >= 0)
-            {
-                if (m_selectedTextStyleCached.isSet())
+                if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
                     m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_selectedTextStyleCached);
-                else
-                    m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_textStyleCached);
-            }
-        }
-        else if (property == U"Scrollbar")
-        {
-            m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
+                break;
+
+            case RendererProperty::SelectedTextStyle:
+                m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
+
+                if (m_selectedItem >= 0)
+                {
+                    if (m_selectedTextStyleCached.isSet())
+                        m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_selectedTextStyleCached);
+                    else
+                        m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_textStyleCached);
+                }
+                break;
+
+            case RendererProperty::Scrollbar:
+                m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
+                    updateAfterRendererChange(&ListBox::reapplySize);
+                }
+                break;
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+            case RendererProperty::ScrollbarWidth:
             {
-                m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
-                setSize(m_size);
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
+                m_scroll->setSize({width, m_scroll->getSize().y});
+                updateAfterRendererChange(&ListBox::reapplySize);
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
-            m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == U"SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == U"SelectedBackgroundColorHover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_scroll->setInheritedOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-            for (auto& item : m_items)
-                item.text.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+            case RendererProperty::BorderColor:
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
 
-            for (auto& item : m_items)
-                item.text.setFont(m_fontCached);
+            case RendererProperty::BackgroundColor:
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
 
-            // Recalculate the text size with the new font
-            if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
-            {
-                m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+            case RendererProperty::BackgroundColorHover:
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+
+            case RendererProperty::SelectedBackgroundColor:
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+
+            case RendererProperty::SelectedBackgroundColorHover:
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Widget::rendererChanged(property);
+
+                m_scroll->setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
                 for (auto& item : m_items)
-                    item.text.setCharacterSize(m_textSizeCached);
-            }
+                    item.text.setOpacity(m_opacityCached);
+                break;
 
-            updateItemPositions();
+            case RendererProperty::Font:
+                Widget::rendererChanged(property);
+
+                for (auto& item : m_items)
+                    item.text.setFont(m_fontCached);
+
+                // Recalculate the text size with the new font
+                if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
+                {
+                    m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+                    for (auto& item : m_items)
+                        item.text.setCharacterSize(m_textSizeCached);
+                }
+
+                updateItemPositions();
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
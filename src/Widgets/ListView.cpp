@@ -1659,156 +1659,163 @@ namespace tgui
 
     void ListView::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"TextureHeaderBackground")
-        {
-            m_spriteHeaderBackground.setTexture(getSharedRenderer()->getTextureHeaderBackground());
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateItemColors();
-
-            if (!m_headerTextColorCached.isSet())
-                updateHeaderTextsColor();
-        }
-        else if (property == U"TextColorHover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateItemColors();
-        }
-        else if (property == U"SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateItemColors();
-        }
-        else if (property == U"SelectedTextColorHover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateItemColors();
-        }
-        else if (property == U"Scrollbar")
-        {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+        switch (RendererPropertyRegistry::findId(property))
+        {
+            case RendererProperty::Borders:
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateAfterRendererChange(&ListView::reapplySize);
+                break;
+
+            case RendererProperty::Padding:
+                m_paddingCached = getSharedRenderer()->getPadding();
+                updateAfterRendererChange(&ListView::reapplySize);
+                break;
+
+            case RendererProperty::TextureHeaderBackground:
+                m_spriteHeaderBackground.setTexture(getSharedRenderer()->getTextureHeaderBackground());
+                break;
+
+            case RendererProperty::TextureBackground:
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+
+            case RendererProperty::TextColor:
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateItemColors();
+
+                if (!m_headerTextColorCached.isSet())
+                    updateAfterRendererChange(&ListView::updateHeaderTextsColor);
+                break;
+
+            case RendererProperty::TextColorHover:
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateAfterRendererChange(&ListView::updateItemColors);
+                break;
+
+            case RendererProperty::SelectedTextColor:
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateAfterRendererChange(&ListView::updateItemColors);
+                break;
+
+            case RendererProperty::SelectedTextColorHover:
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateAfterRendererChange(&ListView::updateItemColors);
+                break;
+
+            case RendererProperty::Scrollbar:
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
+                    m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
+                    updateAfterRendererChange(&ListView::reapplySize);
+                }
+                break;
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+            case RendererProperty::ScrollbarWidth:
             {
-                m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
-                m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
-                setSize(m_size);
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
+                m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
+                m_horizontalScrollbar->setSize({m_verticalScrollbar->getSize().x, width});
+                updateAfterRendererChange(&ListView::reapplySize);
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
-            m_horizontalScrollbar->setSize({m_verticalScrollbar->getSize().x, width});
-            setSize(m_size);
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"SeparatorColor")
-        {
-            m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
-        }
-        else if (property == U"GridLinesColor")
-        {
-            m_gridLinesColorCached = getSharedRenderer()->getGridLinesColor();
-        }
-        else if (property == U"HeaderTextColor")
-        {
-            m_headerTextColorCached = getSharedRenderer()->getHeaderTextColor();
-            updateHeaderTextsColor();
-        }
-        else if (property == U"HeaderBackgroundColor")
-        {
-            m_headerBackgroundColorCached = getSharedRenderer()->getHeaderBackgroundColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == U"SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == U"SelectedBackgroundColorHover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+            case RendererProperty::BorderColor:
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
 
-            m_spriteHeaderBackground.setOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
+            case RendererProperty::SeparatorColor:
+                m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
+                break;
 
-            for (auto& column : m_columns)
-                column.text.setOpacity(m_opacityCached);
+            case RendererProperty::GridLinesColor:
+                m_gridLinesColorCached = getSharedRenderer()->getGridLinesColor();
+                break;
 
-            for (auto& item : m_items)
-            {
-                for (auto& text : item.texts)
-                    text.setOpacity(m_opacityCached);
+            case RendererProperty::HeaderTextColor:
+                m_headerTextColorCached = getSharedRenderer()->getHeaderTextColor();
+                updateAfterRendererChange(&ListView::updateHeaderTextsColor);
+                break;
 
-                item.icon.setOpacity(m_opacityCached);
-            }
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+            case RendererProperty::HeaderBackgroundColor:
+                m_headerBackgroundColorCached = getSharedRenderer()->getHeaderBackgroundColor();
+                break;
 
-            for (auto& column : m_columns)
-                column.text.setFont(m_fontCached);
+            case RendererProperty::BackgroundColor:
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
 
-            for (auto& item : m_items)
-            {
-                for (auto& text : item.texts)
-                    text.setFont(m_fontCached);
-            }
+            case RendererProperty::BackgroundColorHover:
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+
+            case RendererProperty::SelectedBackgroundColor:
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+
+            case RendererProperty::SelectedBackgroundColorHover:
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Widget::rendererChanged(property);
+
+                m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+
+                m_spriteHeaderBackground.setOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+
+                for (auto& column : m_columns)
+                    column.text.setOpacity(m_opacityCached);
+
+                for (auto& item : m_items)
+                {
+                    for (auto& text : item.texts)
+                        text.setOpacity(m_opacityCached);
+
+                    item.icon.setOpacity(m_opacityCached);
+                }
+                break;
+
+            case RendererProperty::Font:
+                Widget::rendererChanged(property);
 
-            if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
-            {
-                // Recalculate the text size with the new font
-                updateTextSize();
-            }
-            else
-            {
-                // Recalculate the width of the columns if they depended on the header text
                 for (auto& column : m_columns)
+                    column.text.setFont(m_fontCached);
+
+                for (auto& item : m_items)
                 {
-                    if (column.designWidth == 0)
-                        column.width = calculateAutoColumnWidth(column.text);
+                    for (auto& text : item.texts)
+                        text.setFont(m_fontCached);
                 }
-                updateHorizontalScrollbarMaximum();
-            }
+
+                if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
+                {
+                    // Recalculate the text size with the new font
+                    updateAfterRendererChange(&ListView::updateTextSize);
+                }
+                else
+                {
+                    // Recalculate the width of the columns if they depended on the header text
+                    for (auto& column : m_columns)
+                    {
+                        if (column.designWidth == 0)
+                            column.width = calculateAutoColumnWidth(column.text);
+                    }
+                    updateHorizontalScrollbarMaximum();
+                }
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -749,74 +749,79 @@ namespace tgui
 
     void MenuBar::rendererChanged(const String& property)
     {
-        if (property == U"TextColor")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == U"SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == U"TextColorDisabled")
-        {
-            m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextureItemBackground")
-        {
-            m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
-        }
-        else if (property == U"TextureSelectedItemBackground")
-        {
-            m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == U"DistanceToSide")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-        }
-        else if (property == U"SeparatorColor")
-        {
-            m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
-        }
-        else if (property == U"SeparatorThickness")
-        {
-            m_separatorThicknessCached = getSharedRenderer()->getSeparatorThickness();
-        }
-        else if (property == U"SeparatorVerticalPadding")
-        {
-            m_separatorVerticalPaddingCached = getSharedRenderer()->getSeparatorVerticalPadding();
-        }
-        else if (property == U"SeparatorSidePadding")
-        {
-            m_separatorSidePaddingCached = getSharedRenderer()->getSeparatorSidePadding();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-            updateTextOpacity(m_menus);
-            m_spriteBackground.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
-            updateTextFont(m_menus);
+            case RendererProperty::TextColor:
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateTextColors(m_menus, m_visibleMenu);
+                break;
+
+            case RendererProperty::SelectedTextColor:
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateTextColors(m_menus, m_visibleMenu);
+                break;
+
+            case RendererProperty::TextColorDisabled:
+                m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
+                updateTextColors(m_menus, m_visibleMenu);
+                break;
+
+            case RendererProperty::TextureBackground:
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+
+            case RendererProperty::TextureItemBackground:
+                m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
+                break;
+
+            case RendererProperty::TextureSelectedItemBackground:
+                m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
+                break;
+
+            case RendererProperty::BackgroundColor:
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case RendererProperty::SelectedBackgroundColor:
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+
+            case RendererProperty::DistanceToSide:
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                break;
+
+            case RendererProperty::SeparatorColor:
+                m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
+                break;
+
+            case RendererProperty::SeparatorThickness:
+                m_separatorThicknessCached = getSharedRenderer()->getSeparatorThickness();
+                break;
+
+            case RendererProperty::SeparatorVerticalPadding:
+                m_separatorVerticalPaddingCached = getSharedRenderer()->getSeparatorVerticalPadding();
+                break;
+
+            case RendererProperty::SeparatorSidePadding:
+                m_separatorSidePaddingCached = getSharedRenderer()->getSeparatorSidePadding();
+                break;
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Widget::rendererChanged(property);
+                updateTextOpacity(m_menus);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                break;
+
+            case RendererProperty::Font:
+                Widget::rendererChanged(property);
+                updateTextFont(m_menus);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -402,29 +402,35 @@ namespace tgui
 
     void MessageBox::rendererChanged(const String& property)
     {
-        if (property == U"TextColor")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == U"Button")
-        {
-            const auto& renderer = getSharedRenderer()->getButton();
-            for (auto& button : m_buttons)
-                button->setRenderer(renderer);
-        }
-        else if (property == U"Font")
-        {
-            ChildWindow::rendererChanged(property);
+            case RendererProperty::TextColor:
+                m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
+                break;
 
-            m_label->setInheritedFont(m_fontCached);
+            case RendererProperty::Button:
+            {
+                const auto& renderer = getSharedRenderer()->getButton();
+                for (auto& button : m_buttons)
+                    button->setRenderer(renderer);
+                break;
+            }
 
-            for (auto& button : m_buttons)
-                button->setInheritedFont(m_fontCached);
+            case RendererProperty::Font:
+                ChildWindow::rendererChanged(property);
 
-            rearrange();
+                m_label->setInheritedFont(m_fontCached);
+
+                for (auto& button : m_buttons)
+                    button->setInheritedFont(m_fontCached);
+
+                rearrange();
+                break;
+
+            default:
+                ChildWindow::rendererChanged(property);
+                break;
         }
-        else
-            ChildWindow::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -218,35 +218,39 @@ namespace tgui
 
     void Panel::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            case RendererProperty::Borders:
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateAfterRendererChange(&Panel::reapplySize);
+                break;
+
+            case RendererProperty::RoundedBorderRadius:
+                m_roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
+                break;
+
+            case RendererProperty::BorderColor:
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case RendererProperty::BackgroundColor:
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case RendererProperty::TextureBackground:
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Group::rendererChanged(property);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                break;
+
+            default:
+                Group::rendererChanged(property);
+                break;
         }
-
-        else if (property == U"RoundedBorderRadius")
-        {
-            m_roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Group::rendererChanged(property);
-            m_spriteBackground.setOpacity(m_opacityCached);
-        }
-        else
-            Group::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -177,22 +177,29 @@ namespace tgui
 
     void Picture::rendererChanged(const String& property)
     {
-        if (property == U"Texture")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            const auto& texture = getSharedRenderer()->getTexture();
+            case RendererProperty::Texture:
+            {
+                const auto& texture = getSharedRenderer()->getTexture();
 
-            if (!m_sprite.isSet() && m_size.x.isConstant() && m_size.y.isConstant() && (getSize() == Vector2f{0,0}))
-                setSize(Vector2f{texture.getImageSize()});
+                if (!m_sprite.isSet() && m_size.x.isConstant() && m_size.y.isConstant() && (getSize() == Vector2f{0,0}))
+                    setSize(Vector2f{texture.getImageSize()});
 
-            m_sprite.setTexture(texture);
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-            m_sprite.setOpacity(m_opacityCached);
+                m_sprite.setTexture(texture);
+                break;
+            }
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Widget::rendererChanged(property);
+                m_sprite.setOpacity(m_opacityCached);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
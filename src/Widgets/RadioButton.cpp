@@ -163,6 +163,10 @@ namespace tgui
             m_text.setStyle(m_textStyleCheckedCached);
         else
             m_text.setStyle(m_textStyleCached);
+
+        // The text style can change the full size of the widget
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -170,6 +174,9 @@ namespace tgui
     void RadioButton::setText(const String& text)
     {
         m_text.setString(text);
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -201,6 +208,9 @@ namespace tgui
             m_textSizeCached = Text::findBestTextSize(m_fontCached, getSize().y * 0.8f);
 
         m_text.setCharacterSize(m_textSizeCached);
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -289,165 +299,174 @@ namespace tgui
 
     void RadioButton::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            m_bordersCached.updateParentSize(getSize());
-            updateTextureSizes();
-        }
-        else if ((property == U"TextColor") || (property == U"TextColorHover") || (property == U"TextColorDisabled")
-              || (property == U"TextColorChecked") || (property == U"TextColorCheckedHover") || (property == U"TextColorCheckedDisabled"))
+        switch (RendererPropertyRegistry::findId(property))
         {
-            updateTextColor();
-        }
-        else if (property == U"TextStyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
+            case RendererProperty::Borders:
+                m_bordersCached = getSharedRenderer()->getBorders();
+                m_bordersCached.updateParentSize(getSize());
+                updateAfterRendererChange(&RadioButton::updateTextureSizes);
+                break;
 
-            if (m_checked && m_textStyleCheckedCached.isSet())
-                m_text.setStyle(m_textStyleCheckedCached);
-            else
-                m_text.setStyle(m_textStyleCached);
-        }
-        else if (property == U"TextStyleChecked")
-        {
-            m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
+            case RendererProperty::TextColor:
+            case RendererProperty::TextColorHover:
+            case RendererProperty::TextColorDisabled:
+            case RendererProperty::TextColorChecked:
+            case RendererProperty::TextColorCheckedHover:
+            case RendererProperty::TextColorCheckedDisabled:
+                updateTextColor();
+                break;
 
-            if (m_checked && m_textStyleCheckedCached.isSet())
-                m_text.setStyle(m_textStyleCheckedCached);
-            else
-                m_text.setStyle(m_textStyleCached);
-        }
-        else if (property == U"TextureUnchecked")
-        {
-            m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
-            updateTextureSizes();
-        }
-        else if (property == U"TextureChecked")
-        {
-            m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
-            updateTextureSizes();
-        }
-        else if (property == U"TextureUncheckedHover")
-        {
-            m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
-        }
-        else if (property == U"TextureCheckedHover")
-        {
-            m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
-        }
-        else if (property == U"TextureUncheckedDisabled")
-        {
-            m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
-        }
-        else if (property == U"TextureCheckedDisabled")
-        {
-            m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
-        }
-        else if (property == U"TextureUncheckedFocused")
-        {
-            m_spriteUncheckedFocused.setTexture(getSharedRenderer()->getTextureUncheckedFocused());
-        }
-        else if (property == U"TextureCheckedFocused")
-        {
-            m_spriteCheckedFocused.setTexture(getSharedRenderer()->getTextureCheckedFocused());
-        }
-        else if (property == U"CheckColor")
-        {
-            m_checkColorCached = getSharedRenderer()->getCheckColor();
-        }
-        else if (property == U"CheckColorHover")
-        {
-            m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
-        }
-        else if (property == U"CheckColorDisabled")
-        {
-            m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BorderColorHover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == U"BorderColorDisabled")
-        {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
-        }
-        else if (property == U"BorderColorFocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if (property == U"BorderColorChecked")
-        {
-            m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
-        }
-        else if (property == U"BorderColorCheckedHover")
-        {
-            m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
-        }
-        else if (property == U"BorderColorCheckedDisabled")
-        {
-            m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
-        }
-        else if (property == U"BorderColorCheckedFocused")
-        {
-            m_borderColorCheckedFocusedCached = getSharedRenderer()->getBorderColorCheckedFocused();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == U"BackgroundColorDisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == U"BackgroundColorChecked")
-        {
-            m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
-        }
-        else if (property == U"BackgroundColorCheckedHover")
-        {
-            m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
-        }
-        else if (property == U"BackgroundColorCheckedDisabled")
-        {
-            m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
-        }
-        else if (property == U"TextDistanceRatio")
-        {
-            m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteUnchecked.setOpacity(m_opacityCached);
-            m_spriteChecked.setOpacity(m_opacityCached);
-            m_spriteUncheckedHover.setOpacity(m_opacityCached);
-            m_spriteCheckedHover.setOpacity(m_opacityCached);
-            m_spriteUncheckedDisabled.setOpacity(m_opacityCached);
-            m_spriteCheckedDisabled.setOpacity(m_opacityCached);
-            m_spriteUncheckedFocused.setOpacity(m_opacityCached);
-            m_spriteCheckedFocused.setOpacity(m_opacityCached);
-
-            m_text.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+            case RendererProperty::TextStyle:
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
+
+                if (m_checked && m_textStyleCheckedCached.isSet())
+                    m_text.setStyle(m_textStyleCheckedCached);
+                else
+                    m_text.setStyle(m_textStyleCached);
+                break;
+
+            case RendererProperty::TextStyleChecked:
+                m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
 
-            m_text.setFont(m_fontCached);
-            updateTextSize();
+                if (m_checked && m_textStyleCheckedCached.isSet())
+                    m_text.setStyle(m_textStyleCheckedCached);
+                else
+                    m_text.setStyle(m_textStyleCached);
+                break;
+
+            case RendererProperty::TextureUnchecked:
+                m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
+                updateAfterRendererChange(&RadioButton::updateTextureSizes);
+                break;
+
+            case RendererProperty::TextureChecked:
+                m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
+                updateAfterRendererChange(&RadioButton::updateTextureSizes);
+                break;
+
+            case RendererProperty::TextureUncheckedHover:
+                m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
+                break;
+
+            case RendererProperty::TextureCheckedHover:
+                m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
+                break;
+
+            case RendererProperty::TextureUncheckedDisabled:
+                m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
+                break;
+
+            case RendererProperty::TextureCheckedDisabled:
+                m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
+                break;
+
+            case RendererProperty::TextureUncheckedFocused:
+                m_spriteUncheckedFocused.setTexture(getSharedRenderer()->getTextureUncheckedFocused());
+                break;
+
+            case RendererProperty::TextureCheckedFocused:
+                m_spriteCheckedFocused.setTexture(getSharedRenderer()->getTextureCheckedFocused());
+                break;
+
+            case RendererProperty::CheckColor:
+                m_checkColorCached = getSharedRenderer()->getCheckColor();
+                break;
+
+            case RendererProperty::CheckColorHover:
+                m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
+                break;
+
+            case RendererProperty::CheckColorDisabled:
+                m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
+                break;
+
+            case RendererProperty::BorderColor:
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case RendererProperty::BorderColorHover:
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+
+            case RendererProperty::BorderColorDisabled:
+                m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+                break;
+
+            case RendererProperty::BorderColorFocused:
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                break;
+
+            case RendererProperty::BorderColorChecked:
+                m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
+                break;
+
+            case RendererProperty::BorderColorCheckedHover:
+                m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
+                break;
+
+            case RendererProperty::BorderColorCheckedDisabled:
+                m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
+                break;
+
+            case RendererProperty::BorderColorCheckedFocused:
+                m_borderColorCheckedFocusedCached = getSharedRenderer()->getBorderColorCheckedFocused();
+                break;
+
+            case RendererProperty::BackgroundColor:
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case RendererProperty::BackgroundColorHover:
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+
+            case RendererProperty::BackgroundColorDisabled:
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+
+            case RendererProperty::BackgroundColorChecked:
+                m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
+                break;
+
+            case RendererProperty::BackgroundColorCheckedHover:
+                m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
+                break;
+
+            case RendererProperty::BackgroundColorCheckedDisabled:
+                m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
+                break;
+
+            case RendererProperty::TextDistanceRatio:
+                m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
+                break;
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Widget::rendererChanged(property);
+
+                m_spriteUnchecked.setOpacity(m_opacityCached);
+                m_spriteChecked.setOpacity(m_opacityCached);
+                m_spriteUncheckedHover.setOpacity(m_opacityCached);
+                m_spriteCheckedHover.setOpacity(m_opacityCached);
+                m_spriteUncheckedDisabled.setOpacity(m_opacityCached);
+                m_spriteCheckedDisabled.setOpacity(m_opacityCached);
+                m_spriteUncheckedFocused.setOpacity(m_opacityCached);
+                m_spriteCheckedFocused.setOpacity(m_opacityCached);
+
+                m_text.setOpacity(m_opacityCached);
+                break;
+
+            case RendererProperty::Font:
+                Widget::rendererChanged(property);
+
+                m_text.setFont(m_fontCached);
+                updateAfterRendererChange(&RadioButton::updateTextSize);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -523,91 +523,96 @@ namespace tgui
 
     void RangeSlider::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"TextureTrack")
-        {
-            m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
+            case RendererProperty::Borders:
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateAfterRendererChange(&RangeSlider::reapplySize);
+                break;
 
-            if (m_spriteTrack.getTexture().getImageSize().x < m_spriteTrack.getTexture().getImageSize().y)
-                m_verticalImage = true;
-            else
-                m_verticalImage = false;
+            case RendererProperty::TextureTrack:
+                m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
 
-            setSize(m_size);
-        }
-        else if (property == U"TextureTrackHover")
-        {
-            m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
-        }
-        else if (property == U"TextureThumb")
-        {
-            m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            setSize(m_size);
-        }
-        else if (property == U"TextureThumbHover")
-        {
-            m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
-            setSize(m_size);
-        }
-        else if (property == U"TextureSelectedTrack")
-        {
-            m_spriteSelectedTrack.setTexture(getSharedRenderer()->getTextureSelectedTrack());
-            setSize(m_size);
-        }
-        else if (property == U"TextureSelectedTrackHover")
-        {
-            m_spriteSelectedTrackHover.setTexture(getSharedRenderer()->getTextureSelectedTrackHover());
-            setSize(m_size);
-        }
-        else if (property == U"TrackColor")
-        {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
-        }
-        else if (property == U"TrackColorHover")
-        {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
-        }
-        else if (property == U"SelectedTrackColor")
-        {
-            m_selectedTrackColorCached = getSharedRenderer()->getSelectedTrackColor();
-        }
-        else if (property == U"SelectedTrackColorHover")
-        {
-            m_selectedTrackColorHoverCached = getSharedRenderer()->getSelectedTrackColorHover();
-        }
-        else if (property == U"ThumbColor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == U"ThumbColorHover")
-        {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BorderColorHover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteTrack.setOpacity(m_opacityCached);
-            m_spriteTrackHover.setOpacity(m_opacityCached);
-            m_spriteThumb.setOpacity(m_opacityCached);
-            m_spriteThumbHover.setOpacity(m_opacityCached);
-            m_spriteSelectedTrack.setOpacity(m_opacityCached);
-            m_spriteSelectedTrackHover.setOpacity(m_opacityCached);
+                if (m_spriteTrack.getTexture().getImageSize().x < m_spriteTrack.getTexture().getImageSize().y)
+                    m_verticalImage = true;
+                else
+                    m_verticalImage = false;
+
+                updateAfterRendererChange(&RangeSlider::reapplySize);
+                break;
+
+            case RendererProperty::TextureTrackHover:
+                m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
+                break;
+
+            case RendererProperty::TextureThumb:
+                m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
+                updateAfterRendererChange(&RangeSlider::reapplySize);
+                break;
+
+            case RendererProperty::TextureThumbHover:
+                m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
+                updateAfterRendererChange(&RangeSlider::reapplySize);
+                break;
+
+            case RendererProperty::TextureSelectedTrack:
+                m_spriteSelectedTrack.setTexture(getSharedRenderer()->getTextureSelectedTrack());
+                updateAfterRendererChange(&RangeSlider::reapplySize);
+                break;
+
+            case RendererProperty::TextureSelectedTrackHover:
+                m_spriteSelectedTrackHover.setTexture(getSharedRenderer()->getTextureSelectedTrackHover());
+                updateAfterRendererChange(&RangeSlider::reapplySize);
+                break;
+
+            case RendererProperty::TrackColor:
+                m_trackColorCached = getSharedRenderer()->getTrackColor();
+                break;
+
+            case RendererProperty::TrackColorHover:
+                m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+                break;
+
+            case RendererProperty::SelectedTrackColor:
+                m_selectedTrackColorCached = getSharedRenderer()->getSelectedTrackColor();
+                break;
+
+            case RendererProperty::SelectedTrackColorHover:
+                m_selectedTrackColorHoverCached = getSharedRenderer()->getSelectedTrackColorHover();
+                break;
+
+            case RendererProperty::ThumbColor:
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+
+            case RendererProperty::ThumbColorHover:
+                m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+                break;
+
+            case RendererProperty::BorderColor:
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case RendererProperty::BorderColorHover:
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Widget::rendererChanged(property);
+
+                m_spriteTrack.setOpacity(m_opacityCached);
+                m_spriteTrackHover.setOpacity(m_opacityCached);
+                m_spriteThumb.setOpacity(m_opacityCached);
+                m_spriteThumbHover.setOpacity(m_opacityCached);
+                m_spriteSelectedTrack.setOpacity(m_opacityCached);
+                m_spriteSelectedTrackHover.setOpacity(m_opacityCached);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,13 +76,17 @@ namespace tgui
 
     void RichTextLabel::rendererChanged(const String& property)
     {
-        if (property == U"TextColor")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            rearrangeText();
+            case RendererProperty::TextColor:
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                rearrangeText();
+                break;
+
+            default:
+                Label::rendererChanged(property);
+                break;
         }
-        else
-            Label::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -98,26 +102,7 @@ namespace tgui
 
         const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
 
-        // Show or hide the scrollbar
-        if (m_autoSize)
-            m_scrollbar->setVisible(false);
-        else
-        {
-            if (m_scrollbarPolicy == Scrollbar::Policy::Always)
-            {
-                m_scrollbar->setVisible(true);
-                m_scrollbar->setAutoHide(false);
-            }
-            else if (m_scrollbarPolicy == Scrollbar::Policy::Never)
-            {
-                m_scrollbar->setVisible(false);
-            }
-            else // Scrollbar::Policy::Automatic
-            {
-                m_scrollbar->setVisible(true);
-                m_scrollbar->setAutoHide(true);
-            }
-        }
+        updateScrollbarVisibility();
 
         const Outline outline = {m_paddingCached.getLeft() + m_bordersCached.getLeft(),
                                  m_paddingCached.getTop() + m_bordersCached.getTop(),
@@ -185,11 +170,14 @@ namespace tgui
                 requiredTextHeight = calculateTextHeight(*textPiecesLinesPtr, defaultLineSpacing);
             }
 
-            m_scrollbar->setSize(m_scrollbar->getSize().x, static_cast<unsigned int>(getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()));
-            m_scrollbar->setViewportSize(static_cast<unsigned int>(getSize().y - outline.getTop() - outline.getBottom()));
-            m_scrollbar->setMaximum(static_cast<unsigned int>(requiredTextHeight));
-            m_scrollbar->setPosition({getSize().x - m_bordersCached.getRight() - m_scrollbar->getSize().x, m_bordersCached.getTop()});
-            m_scrollbar->setScrollAmount(m_textSizeCached);
+            if (m_scrollbar)
+            {
+                m_scrollbar->setSize(m_scrollbar->getSize().x, static_cast<unsigned int>(getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()));
+                m_scrollbar->setViewportSize(static_cast<unsigned int>(getSize().y - outline.getTop() - outline.getBottom()));
+                m_scrollbar->setMaximum(static_cast<unsigned int>(requiredTextHeight));
+                m_scrollbar->setPosition({getSize().x - m_bordersCached.getRight() - m_scrollbar->getSize().x, m_bordersCached.getTop()});
+                m_scrollbar->setScrollAmount(m_textSizeCached);
+            }
         }
 
         std::vector<float> lineWidths;
@@ -329,8 +317,11 @@ namespace tgui
             m_bordersCached.updateParentSize(getSize());
             m_paddingCached.updateParentSize(getSize());
 
-            m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
-                                        getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
+            if (m_spriteBackground)
+            {
+                m_spriteBackground->setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
+                                             getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
+            }
         }
 
         // Vertically align the lines if the text is smaller than the box
@@ -338,7 +329,7 @@ namespace tgui
         {
             const float totalHeight = getSize().y - outline.getTop() - outline.getBottom();
 
-            if (!m_scrollbar->isShown() || (requiredTextHeight < totalHeight))
+            if (!m_scrollbar || !m_scrollbar->isShown() || (requiredTextHeight < totalHeight))
             {
                 float verticalOffset;
                 if (m_verticalAlignment == VerticalAlignment::Bottom)
@@ -686,7 +677,7 @@ namespace tgui
 
             target.addClippingLayer(states, {{m_paddingCached.getLeft(), m_paddingCached.getTop()}, innerSize});
 
-            if (m_scrollbar->isShown())
+            if (m_scrollbar && m_scrollbar->isShown())
                 states.transform.translate({0, -static_cast<float>(m_scrollbar->getValue())});
 
             for (const auto& image : m_images)
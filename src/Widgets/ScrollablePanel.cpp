@@ -27,6 +27,7 @@
 #include <TGUI/Vector2.hpp>
 #include <TGUI/Keyboard.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,6 +51,8 @@ namespace tgui
             m_renderer = aurora::makeCopied<ScrollablePanelRenderer>();
             setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
         }
+
+        connectVerticalScrollbar();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -63,9 +66,15 @@ namespace tgui
         m_verticalScrollbarPolicy   {other.m_verticalScrollbarPolicy},
         m_horizontalScrollbarPolicy {other.m_horizontalScrollbarPolicy},
         m_connectedPositionCallbacks{},
-        m_connectedSizeCallbacks    {}
+        m_connectedSizeCallbacks    {},
+        m_virtualItems              {},
+        m_virtualOverscan           {other.m_virtualOverscan}
     {
-        if (m_contentSize == Vector2f{0, 0})
+        connectVerticalScrollbar();
+
+        if (other.m_virtualItems)
+            copyVirtualItems(other);
+        else if (m_contentSize == Vector2f{0, 0})
         {
             for (const auto& widget : m_widgets)
                 connectPositionAndSize(widget);
@@ -83,11 +92,14 @@ namespace tgui
         m_verticalScrollbarPolicy   {std::move(other.m_verticalScrollbarPolicy)},
         m_horizontalScrollbarPolicy {std::move(other.m_horizontalScrollbarPolicy)},
         m_connectedPositionCallbacks{std::move(other.m_connectedPositionCallbacks)},
-        m_connectedSizeCallbacks    {std::move(other.m_connectedSizeCallbacks)}
+        m_connectedSizeCallbacks    {std::move(other.m_connectedSizeCallbacks)},
+        m_virtualItems              {std::move(other.m_virtualItems)},
+        m_virtualOverscan           {std::move(other.m_virtualOverscan)}
     {
         disconnectAllChildWidgets();
+        connectVerticalScrollbar();
 
-        if (m_contentSize == Vector2f{0, 0})
+        if ((m_contentSize == Vector2f{0, 0}) && !m_virtualItems)
         {
             for (const auto& widget : m_widgets)
                 connectPositionAndSize(widget);
@@ -107,10 +119,15 @@ namespace tgui
             m_horizontalScrollbar       = other.m_horizontalScrollbar;
             m_verticalScrollbarPolicy   = other.m_verticalScrollbarPolicy;
             m_horizontalScrollbarPolicy = other.m_horizontalScrollbarPolicy;
+            m_virtualItems              = nullptr;
+            m_virtualOverscan           = other.m_virtualOverscan;
 
             disconnectAllChildWidgets();
+            connectVerticalScrollbar();
 
-            if (m_contentSize == Vector2f{0, 0})
+            if (other.m_virtualItems)
+                copyVirtualItems(other);
+            else if (m_contentSize == Vector2f{0, 0})
             {
                 for (const auto& widget : m_widgets)
                     connectPositionAndSize(widget);
@@ -132,11 +149,14 @@ namespace tgui
             m_horizontalScrollbar       = std::move(other.m_horizontalScrollbar);
             m_verticalScrollbarPolicy   = std::move(other.m_verticalScrollbarPolicy);
             m_horizontalScrollbarPolicy = std::move(other.m_horizontalScrollbarPolicy);
+            m_virtualItems              = std::move(other.m_virtualItems);
+            m_virtualOverscan           = std::move(other.m_virtualOverscan);
             Panel::operator=(std::move(other));
 
             disconnectAllChildWidgets();
+            connectVerticalScrollbar();
 
-            if (m_contentSize == Vector2f{0, 0})
+            if ((m_contentSize == Vector2f{0, 0}) && !m_virtualItems)
             {
                 for (const auto& widget : m_widgets)
                     connectPositionAndSize(widget);
@@ -208,7 +228,7 @@ namespace tgui
     {
         Panel::add(widget, widgetName);
 
-        if (m_contentSize == Vector2f{0, 0})
+        if ((m_contentSize == Vector2f{0, 0}) && !m_virtualItems)
         {
             const Vector2f bottomRight = widget->getPosition() + widget->getFullSize();
             if (bottomRight.x > m_mostBottomRightPosition.x)
@@ -242,7 +262,7 @@ namespace tgui
 
         const bool ret = Panel::remove(widget);
 
-        if (m_contentSize == Vector2f{0, 0})
+        if ((m_contentSize == Vector2f{0, 0}) && !m_virtualItems)
         {
             const Vector2f bottomRight = widget->getPosition() + widget->getFullSize();
             if ((bottomRight.x == m_mostBottomRightPosition.x) || (bottomRight.y == m_mostBottomRightPosition.y))
@@ -259,6 +279,9 @@ namespace tgui
 
     void ScrollablePanel::removeAllWidgets()
     {
+        // Removing the widgets of the virtual items also ends the virtualization
+        m_virtualItems = nullptr;
+
         disconnectAllChildWidgets();
 
         Panel::removeAllWidgets();
@@ -278,7 +301,7 @@ namespace tgui
 
         disconnectAllChildWidgets();
 
-        if (m_contentSize == Vector2f{0, 0})
+        if ((m_contentSize == Vector2f{0, 0}) && !m_virtualItems)
         {
             recalculateMostBottomRightPosition();
 
@@ -306,7 +329,9 @@ namespace tgui
 
     Vector2f ScrollablePanel::getContentSize() const
     {
-        if (m_contentSize != Vector2f{0, 0})
+        if (m_virtualItems)
+            return {getVirtualItemWidth(), m_virtualItems->offsets.back()};
+        else if (m_contentSize != Vector2f{0, 0})
             return m_contentSize;
         else if (m_widgets.empty())
             return getInnerSize();
@@ -464,6 +489,119 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ScrollablePanel::setVirtualItems(std::size_t count, const VirtualItemHeightFunc& heightFunc,
+                                          const VirtualItemCreateFunc& createFunc, const VirtualItemBindFunc& bindFunc)
+    {
+        TGUI_ASSERT(heightFunc && createFunc, "ScrollablePanel::setVirtualItems requires a height and create function");
+
+        disconnectAllChildWidgets();
+        Panel::removeAllWidgets();
+
+        m_virtualItems = std::make_unique<VirtualItems>();
+        m_virtualItems->count = count;
+        m_virtualItems->heightFunc = heightFunc;
+        m_virtualItems->createFunc = createFunc;
+        m_virtualItems->bindFunc = bindFunc;
+        updateVirtualItemOffsets(0);
+
+        // Updating the scrollbars will also create the widgets for the visible items
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::removeVirtualItems()
+    {
+        if (!m_virtualItems)
+            return;
+
+        m_virtualItems = nullptr;
+        Panel::removeAllWidgets();
+
+        recalculateMostBottomRightPosition();
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ScrollablePanel::isVirtualized() const
+    {
+        return m_virtualItems != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::setVirtualItemCount(std::size_t count)
+    {
+        if (!m_virtualItems)
+            return;
+
+        const std::size_t oldCount = m_virtualItems->count;
+        m_virtualItems->count = count;
+        updateVirtualItemOffsets(std::min(oldCount, count));
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ScrollablePanel::getVirtualItemCount() const
+    {
+        return m_virtualItems ? m_virtualItems->count : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::refreshVirtualItems()
+    {
+        if (!m_virtualItems)
+            return;
+
+        updateVirtualItemOffsets(0);
+        updateScrollbars();
+        updateVirtualItems(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::setVirtualOverscan(unsigned int itemCount)
+    {
+        m_virtualOverscan = itemCount;
+        updateVirtualItems(false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ScrollablePanel::getVirtualOverscan() const
+    {
+        return m_virtualOverscan;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr ScrollablePanel::getVirtualItemWidget(std::size_t index) const
+    {
+        if (!m_virtualItems || (index < m_virtualItems->firstActiveIndex))
+            return nullptr;
+
+        const std::size_t activeIndex = index - m_virtualItems->firstActiveIndex;
+        if (activeIndex >= m_virtualItems->activeWidgets.size())
+            return nullptr;
+
+        return m_virtualItems->activeWidgets[activeIndex];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float ScrollablePanel::getVirtualItemPosition(std::size_t index) const
+    {
+        if (!m_virtualItems)
+            return 0;
+
+        return m_virtualItems->offsets[std::min(index, m_virtualItems->count)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr ScrollablePanel::getWidgetAtPosition(Vector2f pos) const
     {
         pos.x += static_cast<float>(m_horizontalScrollbar->getValue());
@@ -618,8 +756,7 @@ namespace tgui
                     return toolTip;
             }
 
-            if (m_toolTip)
-                return getToolTip();
+            return getToolTip();
         }
 
         return nullptr;
@@ -680,29 +817,35 @@ namespace tgui
 
     void ScrollablePanel::rendererChanged(const String& property)
     {
-        if (property == U"Scrollbar")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+            case RendererProperty::Scrollbar:
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    const float width = m_verticalScrollbar->getDefaultWidth();
+                    m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
+                    m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
+                    updateAfterRendererChange(&ScrollablePanel::updateScrollbars);
+                }
+                break;
+
+            case RendererProperty::ScrollbarWidth:
             {
-                const float width = m_verticalScrollbar->getDefaultWidth();
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
                 m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
                 m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-                updateScrollbars();
+                updateAfterRendererChange(&ScrollablePanel::updateScrollbars);
+                break;
             }
+
+            default:
+                Panel::rendererChanged(property);
+                break;
         }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
-            m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-            updateScrollbars();
-        }
-        else
-            Panel::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -821,6 +964,9 @@ namespace tgui
 
         if (m_horizontalScrollAmount == 0)
             setHorizontalScrollAmount(0);
+
+        // The size of the viewport or the width of the items may have changed
+        updateVirtualItems(false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -863,6 +1009,141 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ScrollablePanel::connectVerticalScrollbar()
+    {
+        // The scrollbar is internal, so no other handlers can be connected to it
+        m_verticalScrollbar->onValueChange.disconnectAll();
+        m_verticalScrollbar->onValueChange([this]{ updateVirtualItems(false); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::copyVirtualItems(const ScrollablePanel& other)
+    {
+        // The widgets that were copied from the other panel aren't known by this panel, new widgets will be created instead
+        Panel::removeAllWidgets();
+
+        m_virtualItems = std::make_unique<VirtualItems>();
+        m_virtualItems->count = other.m_virtualItems->count;
+        m_virtualItems->heightFunc = other.m_virtualItems->heightFunc;
+        m_virtualItems->createFunc = other.m_virtualItems->createFunc;
+        m_virtualItems->bindFunc = other.m_virtualItems->bindFunc;
+        m_virtualItems->offsets = other.m_virtualItems->offsets;
+        updateVirtualItems(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::updateVirtualItemOffsets(std::size_t firstIndex)
+    {
+        auto& offsets = m_virtualItems->offsets;
+        offsets.resize(m_virtualItems->count + 1);
+        if (firstIndex == 0)
+            offsets[0] = 0;
+
+        for (std::size_t i = firstIndex; i < m_virtualItems->count; ++i)
+            offsets[i + 1] = offsets[i] + std::max(0.f, m_virtualItems->heightFunc(i));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float ScrollablePanel::getVirtualItemWidth() const
+    {
+        // The items always fit horizontally, so only the vertical scrollbar can take space away from them
+        const Vector2f visibleSize = Panel::getInnerSize();
+        const bool verticalScrollbarShown = m_verticalScrollbar->isVisible()
+            && (!m_verticalScrollbar->getAutoHide()
+                || (static_cast<unsigned int>(m_virtualItems->offsets.back()) > static_cast<unsigned int>(visibleSize.y)));
+
+        if (verticalScrollbarShown)
+            return std::max(0.f, visibleSize.x - getScrollbarWidth());
+        else
+            return visibleSize.x;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::updateVirtualItems(bool rebindAll)
+    {
+        if (!m_virtualItems)
+            return;
+
+        VirtualItems& items = *m_virtualItems;
+
+        // Find the items that are inside the visible area, using a binary search on the item offsets
+        std::size_t first = 0;
+        std::size_t last = 0;
+        if (items.count > 0)
+        {
+            const float top = static_cast<float>(m_verticalScrollbar->getValue());
+            const float bottom = top + Panel::getInnerSize().y;
+
+            first = static_cast<std::size_t>(std::upper_bound(items.offsets.begin() + 1, items.offsets.end(), top) - (items.offsets.begin() + 1));
+            last = static_cast<std::size_t>(std::lower_bound(items.offsets.begin(), items.offsets.end() - 1, bottom) - items.offsets.begin());
+
+            first = (first > m_virtualOverscan) ? (first - m_virtualOverscan) : 0;
+            last = std::min(items.count, last + m_virtualOverscan);
+            first = std::min(first, last);
+        }
+
+        // Keep the widgets of items that remain near the visible area and move the other ones to the pool
+        items.newActiveWidgets.assign(last - first, nullptr);
+        for (std::size_t i = 0; i < items.activeWidgets.size(); ++i)
+        {
+            const std::size_t index = items.firstActiveIndex + i;
+            if ((index >= first) && (index < last))
+                items.newActiveWidgets[index - first] = std::move(items.activeWidgets[i]);
+            else
+            {
+                Panel::remove(items.activeWidgets[i]);
+                items.pool.push_back(std::move(items.activeWidgets[i]));
+            }
+        }
+
+        std::swap(items.activeWidgets, items.newActiveWidgets);
+        items.newActiveWidgets.clear();
+        items.firstActiveIndex = first;
+
+        // Give a widget to the items that don't have one yet and place all widgets at the position of their item
+        const float width = getVirtualItemWidth();
+        for (std::size_t i = 0; i < items.activeWidgets.size(); ++i)
+        {
+            const std::size_t index = first + i;
+            auto& widget = items.activeWidgets[i];
+
+            const bool newWidget = (widget == nullptr);
+            if (newWidget)
+            {
+                if (!items.pool.empty())
+                {
+                    widget = std::move(items.pool.back());
+                    items.pool.pop_back();
+                }
+                else
+                {
+                    widget = items.createFunc();
+                    TGUI_ASSERT(widget != nullptr, "Create function passed to ScrollablePanel::setVirtualItems returned nullptr");
+                }
+            }
+
+            if ((newWidget || rebindAll) && items.bindFunc)
+                items.bindFunc(widget, index);
+
+            const Vector2f size{width, items.offsets[index + 1] - items.offsets[index]};
+            if (widget->getSize() != size)
+                widget->setSize(size);
+
+            const Vector2f position{0, items.offsets[index]};
+            if (widget->getPosition() != position)
+                widget->setPosition(position);
+
+            if (newWidget)
+                Panel::add(widget);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr ScrollablePanel::clone() const
     {
         return std::make_shared<ScrollablePanel>(*this);
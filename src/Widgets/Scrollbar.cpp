@@ -796,99 +796,104 @@ namespace tgui
 
     void Scrollbar::rendererChanged(const String& property)
     {
-        if (property == U"TextureTrack")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
-            if (m_sizeSet)
-                updateSize();
-            else
-            {
-                if (m_verticalScroll)
-                    setSize({getDefaultWidth(), getSize().y});
+            case RendererProperty::TextureTrack:
+                m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
+                if (m_sizeSet)
+                    updateSize();
                 else
-                    setSize({getSize().x, getDefaultWidth()});
+                {
+                    if (m_verticalScroll)
+                        setSize({getDefaultWidth(), getSize().y});
+                    else
+                        setSize({getSize().x, getDefaultWidth()});
 
-                m_sizeSet = false;
-            }
-        }
-        else if (property == U"TextureTrackHover")
-        {
-            m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
-        }
-        else if (property == U"TextureThumb")
-        {
-            m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            updateSize();
-        }
-        else if (property == U"TextureThumbHover")
-        {
-            m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
-        }
-        else if (property == U"TextureArrowUp")
-        {
-            m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
-            updateSize();
-        }
-        else if (property == U"TextureArrowUpHover")
-        {
-            m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
-        }
-        else if (property == U"TextureArrowDown")
-        {
-            m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
-            updateSize();
-        }
-        else if (property == U"TextureArrowDownHover")
-        {
-            m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
-        }
-        else if (property == U"TrackColor")
-        {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
-        }
-        else if (property == U"TrackColorHover")
-        {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
-        }
-        else if (property == U"ThumbColor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == U"ThumbColorHover")
-        {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
-        }
-        else if (property == U"ArrowBackgroundColor")
-        {
-            m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
-        }
-        else if (property == U"ArrowBackgroundColorHover")
-        {
-            m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
-        }
-        else if (property == U"ArrowColor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == U"ArrowColorHover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteTrack.setOpacity(m_opacityCached);
-            m_spriteTrackHover.setOpacity(m_opacityCached);
-            m_spriteThumb.setOpacity(m_opacityCached);
-            m_spriteThumbHover.setOpacity(m_opacityCached);
-            m_spriteArrowUp.setOpacity(m_opacityCached);
-            m_spriteArrowUpHover.setOpacity(m_opacityCached);
-            m_spriteArrowDown.setOpacity(m_opacityCached);
-            m_spriteArrowDownHover.setOpacity(m_opacityCached);
+                    m_sizeSet = false;
+                }
+                break;
+
+            case RendererProperty::TextureTrackHover:
+                m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
+                break;
+
+            case RendererProperty::TextureThumb:
+                m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
+                updateAfterRendererChange(&Scrollbar::updateSize);
+                break;
+
+            case RendererProperty::TextureThumbHover:
+                m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
+                break;
+
+            case RendererProperty::TextureArrowUp:
+                m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
+                updateAfterRendererChange(&Scrollbar::updateSize);
+                break;
+
+            case RendererProperty::TextureArrowUpHover:
+                m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
+                break;
+
+            case RendererProperty::TextureArrowDown:
+                m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
+                updateAfterRendererChange(&Scrollbar::updateSize);
+                break;
+
+            case RendererProperty::TextureArrowDownHover:
+                m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
+                break;
+
+            case RendererProperty::TrackColor:
+                m_trackColorCached = getSharedRenderer()->getTrackColor();
+                break;
+
+            case RendererProperty::TrackColorHover:
+                m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+                break;
+
+            case RendererProperty::ThumbColor:
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+
+            case RendererProperty::ThumbColorHover:
+                m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+                break;
+
+            case RendererProperty::ArrowBackgroundColor:
+                m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
+                break;
+
+            case RendererProperty::ArrowBackgroundColorHover:
+                m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
+                break;
+
+            case RendererProperty::ArrowColor:
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                break;
+
+            case RendererProperty::ArrowColorHover:
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                break;
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Widget::rendererChanged(property);
+
+                m_spriteTrack.setOpacity(m_opacityCached);
+                m_spriteTrackHover.setOpacity(m_opacityCached);
+                m_spriteThumb.setOpacity(m_opacityCached);
+                m_spriteThumbHover.setOpacity(m_opacityCached);
+                m_spriteArrowUp.setOpacity(m_opacityCached);
+                m_spriteArrowUpHover.setOpacity(m_opacityCached);
+                m_spriteArrowDown.setOpacity(m_opacityCached);
+                m_spriteArrowDownHover.setOpacity(m_opacityCached);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
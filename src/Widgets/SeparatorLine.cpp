@@ -89,8 +89,15 @@ namespace tgui
 
     void SeparatorLine::rendererChanged(const String& property)
     {
-        if (property == U"Color")
-            m_colorCached = getSharedRenderer()->getColor();
+        switch (RendererPropertyRegistry::findId(property))
+        {
+            case RendererProperty::Color:
+                m_colorCached = getSharedRenderer()->getColor();
+                break;
+
+            default:
+                break;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
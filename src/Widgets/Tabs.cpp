@@ -551,125 +551,130 @@ namespace tgui
 
     void Tabs::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
+        switch (RendererPropertyRegistry::findId(property))
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            recalculateTabsWidth();
-        }
-        else if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors();
-        }
-        else if (property == U"TextColorHover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateTextColors();
-        }
-        else if (property == U"TextColorDisabled")
-        {
-            m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
-            updateTextColors();
-        }
-        else if (property == U"SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors();
-        }
-        else if (property == U"SelectedTextColorHover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateTextColors();
-        }
-        else if (property == U"TextureTab")
-        {
-            m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
-        }
-        else if (property == U"TextureTabHover")
-        {
-            m_spriteTabHover.setTexture(getSharedRenderer()->getTextureTabHover());
-        }
-        else if (property == U"TextureSelectedTab")
-        {
-            m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
-        }
-        else if (property == U"TextureSelectedTabHover")
-        {
-            m_spriteSelectedTabHover.setTexture(getSharedRenderer()->getTextureSelectedTabHover());
-        }
-        else if (property == U"TextureDisabledTab")
-        {
-            m_spriteDisabledTab.setTexture(getSharedRenderer()->getTextureDisabledTab());
-        }
-        else if (property == U"DistanceToSide")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-            recalculateTabsWidth();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == U"BackgroundColorDisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == U"SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == U"SelectedBackgroundColorHover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BorderColorHover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == U"SelectedBorderColor")
-        {
-            m_selectedBorderColorCached = getSharedRenderer()->getSelectedBorderColor();
-        }
-        else if (property == U"SelectedBorderColorHover")
-        {
-            m_selectedBorderColorHoverCached = getSharedRenderer()->getSelectedBorderColorHover();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+            case RendererProperty::Borders:
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateAfterRendererChange(&Tabs::recalculateTabsWidth);
+                break;
 
-            m_spriteTab.setOpacity(m_opacityCached);
-            m_spriteTabHover.setOpacity(m_opacityCached);
-            m_spriteSelectedTab.setOpacity(m_opacityCached);
-            m_spriteSelectedTabHover.setOpacity(m_opacityCached);
-            m_spriteDisabledTab.setOpacity(m_opacityCached);
+            case RendererProperty::TextColor:
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateAfterRendererChange(&Tabs::updateTextColors);
+                break;
 
-            for (auto& tab : m_tabs)
-                tab.text.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+            case RendererProperty::TextColorHover:
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateAfterRendererChange(&Tabs::updateTextColors);
+                break;
 
-            for (auto& tab : m_tabs)
-                tab.text.setFont(m_fontCached);
+            case RendererProperty::TextColorDisabled:
+                m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
+                updateAfterRendererChange(&Tabs::updateTextColors);
+                break;
 
-            // Recalculate the size when the text is auto sizing
-            if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
-                updateTextSize();
-            else
-                recalculateTabsWidth();
+            case RendererProperty::SelectedTextColor:
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateAfterRendererChange(&Tabs::updateTextColors);
+                break;
+
+            case RendererProperty::SelectedTextColorHover:
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateAfterRendererChange(&Tabs::updateTextColors);
+                break;
+
+            case RendererProperty::TextureTab:
+                m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
+                break;
+
+            case RendererProperty::TextureTabHover:
+                m_spriteTabHover.setTexture(getSharedRenderer()->getTextureTabHover());
+                break;
+
+            case RendererProperty::TextureSelectedTab:
+                m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
+                break;
+
+            case RendererProperty::TextureSelectedTabHover:
+                m_spriteSelectedTabHover.setTexture(getSharedRenderer()->getTextureSelectedTabHover());
+                break;
+
+            case RendererProperty::TextureDisabledTab:
+                m_spriteDisabledTab.setTexture(getSharedRenderer()->getTextureDisabledTab());
+                break;
+
+            case RendererProperty::DistanceToSide:
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                updateAfterRendererChange(&Tabs::recalculateTabsWidth);
+                break;
+
+            case RendererProperty::BackgroundColor:
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case RendererProperty::BackgroundColorHover:
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+
+            case RendererProperty::BackgroundColorDisabled:
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+
+            case RendererProperty::SelectedBackgroundColor:
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+
+            case RendererProperty::SelectedBackgroundColorHover:
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+
+            case RendererProperty::BorderColor:
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case RendererProperty::BorderColorHover:
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+
+            case RendererProperty::SelectedBorderColor:
+                m_selectedBorderColorCached = getSharedRenderer()->getSelectedBorderColor();
+                break;
+
+            case RendererProperty::SelectedBorderColorHover:
+                m_selectedBorderColorHoverCached = getSharedRenderer()->getSelectedBorderColorHover();
+                break;
+
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Widget::rendererChanged(property);
+
+                m_spriteTab.setOpacity(m_opacityCached);
+                m_spriteTabHover.setOpacity(m_opacityCached);
+                m_spriteSelectedTab.setOpacity(m_opacityCached);
+                m_spriteSelectedTabHover.setOpacity(m_opacityCached);
+                m_spriteDisabledTab.setOpacity(m_opacityCached);
+
+                for (auto& tab : m_tabs)
+                    tab.text.setOpacity(m_opacityCached);
+                break;
+
+            case RendererProperty::Font:
+                Widget::rendererChanged(property);
+
+                for (auto& tab : m_tabs)
+                    tab.text.setFont(m_fontCached);
+
+                // Recalculate the size when the text is auto sizing
+                if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
+                    updateTextSize();
+                else
+                    updateAfterRendererChange(&Tabs::recalculateTabsWidth);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -988,124 +988,127 @@ namespace tgui
 
     void TreeView::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == U"BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == U"SelectedBackgroundColorHover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextureBranchExpanded")
-        {
-            m_spriteBranchExpanded.setTexture(getSharedRenderer()->getTextureBranchExpanded());
-            updateIconBounds();
-            markNodesDirty();
-        }
-        else if (property == U"TextureBranchCollapsed")
-        {
-            m_spriteBranchCollapsed.setTexture(getSharedRenderer()->getTextureBranchCollapsed());
-            updateIconBounds();
-            markNodesDirty();
-        }
-        else if (property == U"TextureLeaf")
-        {
-            m_spriteLeaf.setTexture(getSharedRenderer()->getTextureLeaf());
-            updateIconBounds();
-            markNodesDirty();
-        }
-        else if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == U"TextColorHover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == U"SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == U"SelectedTextColorHover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == U"Scrollbar")
-        {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+        switch (RendererPropertyRegistry::findId(property))
+        {
+            case RendererProperty::Borders:
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateAfterRendererChange(&TreeView::reapplySize);
+                break;
+
+            case RendererProperty::Padding:
+                m_paddingCached = getSharedRenderer()->getPadding();
+                updateAfterRendererChange(&TreeView::reapplySize);
+                break;
+
+            case RendererProperty::BackgroundColor:
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case RendererProperty::SelectedBackgroundColor:
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+
+            case RendererProperty::BackgroundColorHover:
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+
+            case RendererProperty::SelectedBackgroundColorHover:
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+
+            case RendererProperty::BorderColor:
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case RendererProperty::TextureBackground:
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+
+            case RendererProperty::TextureBranchExpanded:
+                m_spriteBranchExpanded.setTexture(getSharedRenderer()->getTextureBranchExpanded());
+                updateAfterRendererChange(&TreeView::updateIconBounds);
+                updateAfterRendererChange(&TreeView::markNodesDirty);
+                break;
+
+            case RendererProperty::TextureBranchCollapsed:
+                m_spriteBranchCollapsed.setTexture(getSharedRenderer()->getTextureBranchCollapsed());
+                updateAfterRendererChange(&TreeView::updateIconBounds);
+                updateAfterRendererChange(&TreeView::markNodesDirty);
+                break;
+
+            case RendererProperty::TextureLeaf:
+                m_spriteLeaf.setTexture(getSharedRenderer()->getTextureLeaf());
+                updateAfterRendererChange(&TreeView::updateIconBounds);
+                updateAfterRendererChange(&TreeView::markNodesDirty);
+                break;
+
+            case RendererProperty::TextColor:
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateAfterRendererChange(&TreeView::updateItemColors);
+                break;
+
+            case RendererProperty::TextColorHover:
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateAfterRendererChange(&TreeView::updateItemColors);
+                break;
+
+            case RendererProperty::SelectedTextColor:
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateAfterRendererChange(&TreeView::updateItemColors);
+                break;
+
+            case RendererProperty::SelectedTextColorHover:
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateAfterRendererChange(&TreeView::updateItemColors);
+                break;
+
+            case RendererProperty::Scrollbar:
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    const float width = m_verticalScrollbar->getDefaultWidth();
+                    m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
+                    m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
+                    updateAfterRendererChange(&TreeView::markNodesDirty);
+                }
+                break;
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+            case RendererProperty::ScrollbarWidth:
             {
-                const float width = m_verticalScrollbar->getDefaultWidth();
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
                 m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
                 m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-                markNodesDirty();
+                updateAfterRendererChange(&TreeView::markNodesDirty);
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
-            m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-            markNodesDirty();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            setTextOpacityImpl(m_nodes, m_opacityCached);
+            case RendererProperty::Opacity:
+            case RendererProperty::OpacityDisabled:
+                Widget::rendererChanged(property);
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteBranchExpanded.setOpacity(m_opacityCached);
-            m_spriteBranchCollapsed.setOpacity(m_opacityCached);
-            m_spriteLeaf.setOpacity(m_opacityCached);
+                setTextOpacityImpl(m_nodes, m_opacityCached);
 
-            m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
-            setTextFontImpl(m_nodes, m_fontCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteBranchExpanded.setOpacity(m_opacityCached);
+                m_spriteBranchCollapsed.setOpacity(m_opacityCached);
+                m_spriteLeaf.setOpacity(m_opacityCached);
+
+                m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+                break;
+
+            case RendererProperty::Font:
+                Widget::rendererChanged(property);
+                setTextFontImpl(m_nodes, m_fontCached);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1515,6 +1518,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TreeView::updateItemColors()
+    {
+        updateTextColors(m_nodes);
+        updateSelectedAndHoveringItemColors();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TreeView::updateSelectedAndHoveringItemColors()
     {
         if (m_selectedItem >= 0)
@@ -262,4 +262,108 @@ TEST_CASE("[Animation]")
 
         // TODO: Add tests for simultaneous animations (tests for both same type and different types)
     }
+
+    SECTION("Easing")
+    {
+        for (const auto easing : {tgui::EasingType::Linear, tgui::EasingType::EaseIn, tgui::EasingType::EaseOut, tgui::EasingType::EaseInOut})
+        {
+            REQUIRE(tgui::priv::AnimationEngine::applyEasing(easing, 0) == 0);
+            REQUIRE(tgui::priv::AnimationEngine::applyEasing(easing, 1) == 1);
+        }
+
+        widget->moveWithAnimation({230, 15}, 400, tgui::EasingType::EaseIn);
+        widget->updateTime(std::chrono::milliseconds(200));
+        compareVector2f(widget->getPosition(), {30 + (200 * 0.125f), 15});
+        widget->updateTime(std::chrono::milliseconds(200));
+        REQUIRE(widget->getPosition() == tgui::Vector2f{230, 15});
+
+        widget->resizeWithAnimation({220, 30}, 400, tgui::EasingType::EaseOut);
+        widget->updateTime(std::chrono::milliseconds(200));
+        compareVector2f(widget->getSize(), {120 + (100 * 0.875f), 30});
+        widget->updateTime(std::chrono::milliseconds(200));
+        REQUIRE(widget->getSize() == tgui::Vector2f{220, 30});
+
+        widget->showWithEffect(tgui::ShowEffectType::SlideFromTop, 400, tgui::EasingType::EaseInOut);
+        widget->updateTime(std::chrono::milliseconds(100));
+        compareVector2f(widget->getPosition(), {230, -30 + (45 * 0.0625f)});
+        widget->updateTime(std::chrono::milliseconds(300));
+        REQUIRE(widget->getPosition() == tgui::Vector2f{230, 15});
+    }
+
+    SECTION("Parent plays animations of children")
+    {
+        const tgui::Container::Ptr container = parent;
+        auto widget2 = tgui::ClickableWidget::create({0, 0});
+        parent->add(widget2);
+
+        unsigned int finishCount = 0;
+        widget->onAnimationFinish([&]{ ++finishCount; });
+        widget2->onAnimationFinish([&]{ ++finishCount; });
+
+        widget->moveWithAnimation({230, 15}, 400);
+        widget2->resizeWithAnimation({200, 100}, 200);
+        REQUIRE(widget->isAnimationPlaying());
+        REQUIRE(widget2->isAnimationPlaying());
+
+        // Each animation is only advanced once, even though the parent also updates the time of its children
+        container->updateTime(std::chrono::milliseconds(100));
+        REQUIRE(widget->getPosition() == tgui::Vector2f{80, 15});
+        REQUIRE(widget2->getSize() == tgui::Vector2f{100, 50});
+
+        // Updating a single widget only plays its own animations
+        widget->updateTime(std::chrono::milliseconds(100));
+        REQUIRE(widget->getPosition() == tgui::Vector2f{130, 15});
+        REQUIRE(widget2->getSize() == tgui::Vector2f{100, 50});
+
+        // Animations of invisible children are paused
+        widget->setVisible(false);
+        REQUIRE(container->updateTime(std::chrono::milliseconds(100)));
+        REQUIRE(widget->getPosition() == tgui::Vector2f{130, 15});
+        REQUIRE(widget2->getSize() == tgui::Vector2f{200, 100});
+        REQUIRE(!widget2->isAnimationPlaying());
+        REQUIRE(finishCount == 1);
+
+        // A paused animation doesn't require the screen to be redrawn
+        REQUIRE(!container->updateTime(std::chrono::milliseconds(100)));
+        REQUIRE(widget->getPosition() == tgui::Vector2f{130, 15});
+        REQUIRE(widget->isAnimationPlaying());
+
+        widget->setVisible(true);
+        container->updateTime(std::chrono::milliseconds(200));
+        REQUIRE(widget->getPosition() == tgui::Vector2f{230, 15});
+        REQUIRE(!widget->isAnimationPlaying());
+        REQUIRE(finishCount == 2);
+    }
+
+    SECTION("Changing parent")
+    {
+        const tgui::Container::Ptr container = parent;
+        // An animation started before the widget is added to a parent continues in the new parent
+        auto widget2 = tgui::ClickableWidget::create();
+        widget2->moveWithAnimation({100, 0}, 200);
+        widget2->updateTime(std::chrono::milliseconds(100));
+        REQUIRE(widget2->getPosition() == tgui::Vector2f{50, 0});
+
+        parent->add(widget2);
+        REQUIRE(widget2->isAnimationPlaying());
+        container->updateTime(std::chrono::milliseconds(50));
+        REQUIRE(widget2->getPosition() == tgui::Vector2f{75, 0});
+
+        // Removing the widget from its parent finishes the animations
+        parent->remove(widget2);
+        REQUIRE(!widget2->isAnimationPlaying());
+        REQUIRE(widget2->getPosition() == tgui::Vector2f{100, 0});
+
+        // Removing a widget from its parent inside a callback while the parent plays the animations
+        widget->moveWithAnimation({0, 0}, 100);
+        widget2->setPosition(0, 0);
+        parent->add(widget2);
+        widget2->moveWithAnimation({100, 100}, 200);
+        widget->onAnimationFinish([&]{ parent->remove(widget2); });
+        container->updateTime(std::chrono::milliseconds(100));
+        REQUIRE(widget->getPosition() == tgui::Vector2f{0, 0});
+        REQUIRE(widget2->getPosition() == tgui::Vector2f{100, 100});
+        REQUIRE(widget2->getParent() == nullptr);
+        REQUIRE(!widget2->isAnimationPlaying());
+    }
 }
@@ -26,6 +26,8 @@
 #include <TGUI/Widgets/ChildWindow.hpp>
 #include <TGUI/Widgets/EditBox.hpp>
 #include <TGUI/Widgets/Slider.hpp>
+#include <TGUI/Timer.hpp>
+#include <TGUI/ToolTip.hpp>
 
 #if TGUI_HAS_WINDOW_BACKEND_SFML
     #include <TGUI/Backend/Window/SFML/BackendGuiSFML.hpp>
@@ -1310,4 +1312,164 @@ TEST_CASE("[Backend events]")
         }
     }
 #endif
+
+    SECTION("Coalescing input events")
+    {
+        GuiNull gui;
+
+        auto panel = tgui::Panel::create({50, 50});
+        panel->setPosition({50, 50});
+        gui.add(panel);
+
+        unsigned int mouseEnterCount = 0;
+        unsigned int mouseLeaveCount = 0;
+        panel->onMouseEnter([&]{ ++mouseEnterCount; });
+        panel->onMouseLeave([&]{ ++mouseLeaveCount; });
+
+        auto slider = tgui::Slider::create();
+        slider->setChangeValueOnScroll(true);
+        slider->setPosition({150, 20});
+        slider->setSize({20, 150});
+        slider->setMaximum(10);
+        slider->setValue(3);
+        gui.add(slider);
+
+        const auto moveMouse = [&gui](int x, int y){
+            tgui::Event event;
+            event.type = tgui::Event::Type::MouseMoved;
+            event.mouseMove.x = x;
+            event.mouseMove.y = y;
+            return gui.handleEvent(event);
+        };
+        const auto scrollMouseWheel = [&gui](int x, int y, float delta){
+            tgui::Event event;
+            event.type = tgui::Event::Type::MouseWheelScrolled;
+            event.mouseWheel.x = x;
+            event.mouseWheel.y = y;
+            event.mouseWheel.delta = delta;
+            return gui.handleEvent(event);
+        };
+
+        REQUIRE(!gui.getInputEventsCoalesced());
+        gui.setInputEventsCoalesced(true);
+        REQUIRE(gui.getInputEventsCoalesced());
+
+        // Only the last of the consecutive mouse move events reaches the widgets
+        REQUIRE(!moveMouse(60, 60));
+        REQUIRE(!moveMouse(10, 10));
+        REQUIRE(!moveMouse(70, 70));
+        REQUIRE(mouseEnterCount == 0);
+        REQUIRE(gui.flushInputEvents());
+        REQUIRE(mouseEnterCount == 1);
+        REQUIRE(mouseLeaveCount == 0);
+        REQUIRE(gui.getCoalescedInputEventCount() == 2);
+        REQUIRE(!gui.flushInputEvents());
+
+        // Scrolling at the same position is merged into a single event
+        REQUIRE(!scrollMouseWheel(160, 80, 4));
+        REQUIRE(!scrollMouseWheel(160, 80, -1));
+        REQUIRE(!scrollMouseWheel(160, 80, -1));
+        REQUIRE(slider->getValue() == 3);
+        REQUIRE(gui.flushInputEvents());
+        REQUIRE(slider->getValue() == 5);
+        REQUIRE(gui.getCoalescedInputEventCount() == 4);
+
+        // Other events are only handled after the queued events
+        moveMouse(10, 10);
+        tgui::Event event;
+        event.type = tgui::Event::Type::MouseButtonPressed;
+        event.mouseButton.button = tgui::Event::MouseButton::Left;
+        event.mouseButton.x = 10;
+        event.mouseButton.y = 10;
+        REQUIRE(!gui.handleEvent(event));
+        REQUIRE(mouseLeaveCount == 1);
+        event.type = tgui::Event::Type::MouseButtonReleased;
+        gui.handleEvent(event);
+
+        // In raw mode, all mouse positions are passed to the widgets
+        REQUIRE(!gui.getRawMouseInput());
+        gui.setRawMouseInput(true);
+        REQUIRE(gui.getRawMouseInput());
+        moveMouse(60, 60);
+        moveMouse(10, 10);
+        moveMouse(70, 70);
+        gui.flushInputEvents();
+        REQUIRE(mouseEnterCount == 3);
+        REQUIRE(mouseLeaveCount == 2);
+        REQUIRE(gui.getCoalescedInputEventCount() == 4);
+
+        // Queued events are processed when no longer coalescing events
+        moveMouse(10, 10);
+        REQUIRE(mouseLeaveCount == 2);
+        gui.setInputEventsCoalesced(false);
+        REQUIRE(mouseLeaveCount == 3);
+        REQUIRE(moveMouse(70, 70));
+        REQUIRE(mouseEnterCount == 4);
+    }
+
+    SECTION("Time until next update")
+    {
+        GuiNull gui;
+        tgui::Timer::clearTimers();
+        REQUIRE(!gui.getTimeUntilNextUpdate());
+
+        auto timer = tgui::Timer::create([]{}, std::chrono::milliseconds(300));
+        REQUIRE(gui.getTimeUntilNextUpdate() == tgui::Duration{std::chrono::milliseconds(300)});
+        gui.updateTime(std::chrono::milliseconds(100));
+        REQUIRE(gui.getTimeUntilNextUpdate() == tgui::Duration{std::chrono::milliseconds(200)});
+        timer->setEnabled(false);
+        REQUIRE(!gui.getTimeUntilNextUpdate());
+
+        // The caret only needs to blink when the edit box is focused
+        auto editBox = tgui::EditBox::create();
+        gui.add(editBox);
+        REQUIRE(!gui.getTimeUntilNextUpdate());
+        editBox->setFocused(true);
+        const tgui::Duration blinkRate = tgui::getEditCursorBlinkRate();
+        REQUIRE(gui.getTimeUntilNextUpdate() == blinkRate);
+        gui.updateTime(blinkRate / 4);
+        REQUIRE(gui.getTimeUntilNextUpdate() == blinkRate - (blinkRate / 4));
+        editBox->setVisible(false);
+        REQUIRE(!gui.getTimeUntilNextUpdate());
+
+        // Animations are updated every frame
+        auto panel = tgui::Panel::create();
+        gui.add(panel);
+        panel->showWithEffect(tgui::ShowEffectType::Fade, std::chrono::milliseconds(300));
+        REQUIRE(gui.getTimeUntilNextUpdate() == tgui::Duration{});
+        gui.updateTime(std::chrono::milliseconds(400));
+        REQUIRE(!gui.getTimeUntilNextUpdate());
+
+        // Animations of invisible widgets are paused and don't require updates
+        panel->moveWithAnimation({100, 0}, std::chrono::milliseconds(300));
+        REQUIRE(gui.getTimeUntilNextUpdate() == tgui::Duration{});
+        panel->setVisible(false);
+        REQUIRE(!gui.getTimeUntilNextUpdate());
+        panel->setVisible(true);
+        REQUIRE(gui.getTimeUntilNextUpdate() == tgui::Duration{});
+        gui.updateTime(std::chrono::milliseconds(300));
+        REQUIRE(!gui.getTimeUntilNextUpdate());
+
+        // Posted signals have to be emitted immediately
+        panel->onClick.postEmit(panel.get(), tgui::Vector2f{});
+        REQUIRE(gui.getTimeUntilNextUpdate() == tgui::Duration{});
+        gui.updateTime(tgui::Duration{});
+        REQUIRE(!gui.getTimeUntilNextUpdate());
+
+        // A tool tip may have to be shown after the mouse moved
+        tgui::Event event;
+        event.type = tgui::Event::Type::MouseMoved;
+        event.mouseMove.x = 10;
+        event.mouseMove.y = 10;
+        gui.handleEvent(event);
+        REQUIRE(gui.getTimeUntilNextUpdate() == tgui::ToolTip::getInitialDelay());
+        gui.updateTime(tgui::ToolTip::getInitialDelay());
+        REQUIRE(!gui.getTimeUntilNextUpdate());
+
+        // Nothing is updated while the window isn't focused
+        editBox->setVisible(true);
+        event.type = tgui::Event::Type::LostFocus;
+        gui.handleEvent(event);
+        REQUIRE(!gui.getTimeUntilNextUpdate());
+    }
 }
@@ -0,0 +1,186 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Components.hpp>
+#include <thread>
+
+using tgui::priv::dev::MessageBroker;
+
+TEST_CASE("[Components]")
+{
+    SECTION("MessageBroker")
+    {
+        const std::uint64_t topic = MessageBroker::createTopic();
+        REQUIRE(topic != 0);
+
+        std::vector<int> calls;
+        const std::uint64_t id1 = MessageBroker::subscribe(topic, [&]{ calls.push_back(1); });
+        const std::uint64_t id2 = MessageBroker::subscribe(topic, [&]{ calls.push_back(2); });
+        const std::uint64_t id3 = MessageBroker::subscribe(topic, [&]{ calls.push_back(3); });
+        REQUIRE(id1 != 0);
+        REQUIRE(id1 != id2);
+
+        SECTION("Subscribers are called in order")
+        {
+            MessageBroker::sendEvent(topic);
+            REQUIRE(calls == std::vector<int>{1, 2, 3});
+
+            MessageBroker::unsubscribe(id2);
+            MessageBroker::unsubscribe(id2); // Ids can't be unsubscribed twice
+            MessageBroker::sendEvent(topic);
+            REQUIRE(calls == std::vector<int>{1, 2, 3, 1, 3});
+
+            const std::uint64_t id4 = MessageBroker::subscribe(topic, [&]{ calls.push_back(4); });
+            REQUIRE(id4 != id2); // Ids aren't reused, even when the memory is
+            MessageBroker::unsubscribe(id1);
+            calls.clear();
+            MessageBroker::sendEvent(topic);
+            REQUIRE(calls == std::vector<int>{3, 4});
+
+            MessageBroker::destroyTopic(topic);
+        }
+
+        SECTION("Destroying topic")
+        {
+            MessageBroker::destroyTopic(topic);
+            MessageBroker::sendEvent(topic);
+            REQUIRE(calls.empty());
+
+            // Listeners can still unsubscribe afterwards
+            MessageBroker::unsubscribe(id1);
+
+            // A new topic may reuse the memory, but the old ids don't refer to it
+            const std::uint64_t topic2 = MessageBroker::createTopic();
+            REQUIRE(topic2 != topic);
+            (void)MessageBroker::subscribe(topic2, [&]{ calls.push_back(5); });
+            MessageBroker::unsubscribe(id2);
+            MessageBroker::sendEvent(topic);
+            MessageBroker::sendEvent(topic2);
+            REQUIRE(calls == std::vector<int>{5});
+            MessageBroker::destroyTopic(topic2);
+        }
+
+        SECTION("Changes while sending")
+        {
+            const std::uint64_t topic2 = MessageBroker::createTopic();
+            std::uint64_t id5 = 0;
+            const std::uint64_t id4 = MessageBroker::subscribe(topic2, [&]{
+                calls.push_back(4);
+                MessageBroker::unsubscribe(id1);
+                if (id5 == 0)
+                    id5 = MessageBroker::subscribe(topic, [&]{ calls.push_back(5); });
+                (void)MessageBroker::createTopic(); // Causes the list of topics to grow
+            });
+
+            // Subscribers added while sending are only called the next time
+            MessageBroker::unsubscribe(id2);
+            (void)MessageBroker::subscribe(topic, [&]{ MessageBroker::sendEvent(topic2); });
+            MessageBroker::sendEvent(topic);
+            REQUIRE(calls == std::vector<int>{1, 3, 4});
+
+            calls.clear();
+            MessageBroker::sendEvent(topic);
+            REQUIRE(calls == std::vector<int>{3, 4, 5});
+
+            // The topic can be destroyed while it is being sent
+            calls.clear();
+            MessageBroker::unsubscribe(id4);
+            (void)MessageBroker::subscribe(topic2, [&]{ calls.push_back(6); MessageBroker::destroyTopic(topic2); });
+            (void)MessageBroker::subscribe(topic2, [&]{ calls.push_back(7); });
+            MessageBroker::sendEvent(topic2);
+            MessageBroker::sendEvent(topic2);
+            REQUIRE(calls == std::vector<int>{6});
+
+            MessageBroker::unsubscribe(id3);
+            MessageBroker::unsubscribe(id5);
+            MessageBroker::destroyTopic(topic);
+        }
+
+        SECTION("Posting events from other threads")
+        {
+            std::thread thread([topic]{
+                MessageBroker::postEvent(topic);
+                MessageBroker::postEvent(topic);
+            });
+            thread.join();
+            REQUIRE(calls.empty());
+
+            REQUIRE(MessageBroker::dispatchPostedEvents());
+            REQUIRE(calls == std::vector<int>{1, 2, 3, 1, 2, 3});
+            REQUIRE(!MessageBroker::dispatchPostedEvents());
+
+            // Events for destroyed topics are ignored
+            MessageBroker::postEvent(topic);
+            MessageBroker::destroyTopic(topic);
+            REQUIRE(!MessageBroker::dispatchPostedEvents());
+            REQUIRE(calls.size() == 6);
+        }
+    }
+
+    SECTION("Style changes are propagated")
+    {
+        tgui::priv::dev::StylePropertyBackground style;
+        tgui::priv::dev::BackgroundComponent component1(&style);
+        tgui::priv::dev::BackgroundComponent component2(&style);
+        component1.setSize({100, 50});
+        component2.setSize({100, 50});
+
+        style.borders = tgui::Outline{2};
+        REQUIRE(component1.getBorders() == tgui::Outline{2});
+        REQUIRE(component2.getBorders() == tgui::Outline{2});
+
+        {
+            tgui::priv::dev::BackgroundComponent component3(&style);
+            REQUIRE(component3.getBorders() == tgui::Outline{2});
+        }
+
+        style.padding = tgui::Outline{3};
+        REQUIRE(component1.getPadding() == tgui::Outline{3});
+        REQUIRE(component2.getPadding() == tgui::Outline{3});
+    }
+}
+
+TEST_CASE("[Components] Benchmark", "[.benchmark]")
+{
+    tgui::priv::dev::StylePropertyBackground style;
+    std::vector<std::unique_ptr<tgui::priv::dev::BackgroundComponent>> components;
+    for (unsigned int i = 0; i < 10000; ++i)
+        components.push_back(std::make_unique<tgui::priv::dev::BackgroundComponent>(&style));
+
+    BENCHMARK("Propagating a style change to 10000 components")
+    {
+        style.color = tgui::Color::Red;
+        style.color = tgui::Color::Green;
+        return components.size();
+    };
+
+    BENCHMARK("Creating and destroying 10000 components")
+    {
+        std::vector<std::unique_ptr<tgui::priv::dev::BackgroundComponent>> newComponents;
+        for (unsigned int i = 0; i < 10000; ++i)
+            newComponents.push_back(std::make_unique<tgui::priv::dev::BackgroundComponent>(&style));
+        return newComponents.size();
+    };
+}
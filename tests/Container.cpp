@@ -24,6 +24,32 @@
 
 #include "Tests.hpp"
 #include <TGUI/TGUI.hpp>
+#include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
+
+namespace
+{
+    // Render target that only keeps track of which widgets the containers tried to draw
+    class DrawRecordingRenderTarget : public tgui::BackendRenderTarget
+    {
+    public:
+        void setClearColor(const tgui::Color&) override {}
+        void clearScreen() override {}
+        void drawGui(const std::shared_ptr<tgui::RootContainer>&) override {}
+        void drawVertexArray(const tgui::RenderStates&, const tgui::Vertex*, std::size_t, const unsigned int*, std::size_t,
+                             const std::shared_ptr<tgui::BackendTexture>&) override {}
+
+        void drawWidget(const tgui::RenderStates& states, const std::shared_ptr<tgui::Widget>& widget) override
+        {
+            drawnWidgets.push_back(widget);
+            tgui::BackendRenderTarget::drawWidget(states, widget);
+        }
+
+        std::vector<tgui::Widget::Ptr> drawnWidgets;
+
+    protected:
+        void updateClipping(tgui::FloatRect, tgui::FloatRect) override {}
+    };
+}
 
 TEST_CASE("[Container]")
 {
@@ -162,6 +188,47 @@ TEST_CASE("[Container]")
             child1->remove(child4);
             REQUIRE(container->get("name") == nullptr);
         }
+
+        SECTION("Changing widget tree")
+        {
+            REQUIRE(container->get("w4") == widget4);
+
+            // Renaming a widget
+            widget4->setWidgetName("renamed");
+            REQUIRE(container->get("w4") == nullptr);
+            REQUIRE(container->get("renamed") == widget4);
+            REQUIRE(widget2->get("renamed") == widget4);
+
+            // Only widgets inside the container are found
+            REQUIRE(widget2->get("w1") == nullptr);
+            REQUIRE(widget2->get("w5") == widget5);
+
+            // Widgets inside a removed container are no longer found
+            container->remove(widget2);
+            REQUIRE(container->get("w2") == nullptr);
+            REQUIRE(container->get("renamed") == nullptr);
+            REQUIRE(widget2->get("renamed") == widget4);
+
+            // Names that are changed while the widget isn't part of the tree are used when it is added again
+            widget5->setWidgetName("w6");
+            auto panel = tgui::Panel::create();
+            container->add(panel, "panel");
+            panel->add(widget2);
+            REQUIRE(container->get("w2") == widget2);
+            REQUIRE(container->get("w5") == nullptr);
+            REQUIRE(container->get("w6") == widget5);
+            REQUIRE(panel->get("renamed") == widget4);
+
+            // Widgets in different containers can have the same name
+            auto button = tgui::Button::create();
+            container->add(button, "w6");
+            REQUIRE(container->get("w6") == button);
+            REQUIRE(widget2->get("w6") == widget5);
+
+            container->removeAllWidgets();
+            REQUIRE(container->get("w6") == nullptr);
+            REQUIRE(panel->get("w6") == widget5);
+        }
     }
 
     SECTION("remove")
@@ -278,6 +345,51 @@ TEST_CASE("[Container]")
 
         // No widgets were added or removed while changing z-order
         REQUIRE(container->getWidgets().size() == 5);
+
+        // The indices are still correct after the list of widgets was changed by sorting it
+        widget1->setWidgetName("1");
+        widget2->setWidgetName("2");
+        widget3->setWidgetName("3");
+        widget4->setWidgetName("4");
+        widget5->setWidgetName("5");
+        container->getContainer()->sortWidgets([](const tgui::Widget::Ptr& p, const tgui::Widget::Ptr& p2){ return p->getWidgetName() < p2->getWidgetName(); });
+        REQUIRE(container->getWidgetIndex(widget1) == 0);
+        REQUIRE(container->getWidgetIndex(widget3) == 2);
+        REQUIRE(container->getWidgetIndex(widget5) == 4);
+
+        REQUIRE(container->remove(widget2));
+        REQUIRE(container->getWidgetIndex(widget1) == 0);
+        REQUIRE(container->getWidgetIndex(widget3) == 1);
+        REQUIRE(container->getWidgetIndex(widget4) == 2);
+        REQUIRE(container->getWidgetIndex(widget5) == 3);
+
+        container->moveWidgetToBack(widget5);
+        REQUIRE(container->getWidgetIndex(widget5) == 0);
+        REQUIRE(container->getWidgetIndex(widget4) == 3);
+        container->moveWidgetToFront(widget1);
+        REQUIRE(container->getWidgetIndex(widget1) == 3);
+        REQUIRE(container->getWidgetIndex(widget4) == 2);
+
+        // Bringing every widget to the front in order ends with the original order, and each widget can still be found by name
+        auto panel = tgui::Panel::create();
+        for (unsigned int i = 0; i < 100; ++i)
+            panel->add(tgui::ClickableWidget::create(), "Widget" + tgui::String::fromNumber(i));
+
+        const auto widgets = panel->getWidgets();
+        for (const auto& widget : widgets)
+            panel->moveWidgetToFront(widget);
+        REQUIRE(panel->getWidgets() == widgets);
+        for (std::size_t i = 0; i < widgets.size(); ++i)
+        {
+            REQUIRE(panel->getWidgetIndex(widgets[i]) == static_cast<int>(i));
+            REQUIRE(panel->get("Widget" + tgui::String::fromNumber(i)) == widgets[i]);
+        }
+
+        panel->moveWidgetToBack(widgets[99]);
+        REQUIRE(panel->getWidgetIndex(widgets[99]) == 0);
+        REQUIRE(panel->getWidgetIndex(widgets[0]) == 1);
+        REQUIRE(panel->getWidgetIndex(widgets[98]) == 99);
+        REQUIRE(panel->get("Widget99") == widgets[99]);
     }
 
     SECTION("widget name")
@@ -438,6 +550,192 @@ TEST_CASE("[Container]")
         REQUIRE(container->getWidgetBelowMouseCursor({93, 39}) == w3);
     }
 
+    SECTION("Spatial index")
+    {
+        auto panel = tgui::Panel::create({1000, 1000});
+        container->add(panel);
+
+        std::vector<tgui::ClickableWidget::Ptr> widgets;
+        for (unsigned int i = 0; i < 200; ++i)
+        {
+            auto widget = tgui::ClickableWidget::create({static_cast<float>(10 + 7 * (i % 13)), static_cast<float>(10 + 5 * (i % 7))});
+            widget->setPosition({static_cast<float>((i * 37) % 900), static_cast<float>((i * 53) % 900)});
+            panel->add(widget);
+            widgets.push_back(widget);
+        }
+
+        widgets[5]->setRotation(30);
+        widgets[6]->setScale({2, 3});
+        widgets[7]->setOrigin({0.5f, 0.5f});
+        widgets[8]->setSize({1000, 1000}); // Covers too many cells to be stored in the grid
+        widgets[9]->setVisible(false);
+
+        std::vector<tgui::Widget::Ptr> expectedWidgets;
+        const auto findAllWidgets = [&]{
+            std::vector<tgui::Widget::Ptr> foundWidgets;
+            for (float y = 0; y < 1000; y += 17)
+            {
+                for (float x = 0; x < 1000; x += 13)
+                    foundWidgets.push_back(panel->getWidgetAtPosition({x, y}));
+            }
+            return foundWidgets;
+        };
+        const auto checkIndex = [&]{
+            REQUIRE(!panel->isSpatialIndexEnabled());
+            expectedWidgets = findAllWidgets();
+
+            panel->setSpatialIndexEnabled(true, 64);
+            REQUIRE(panel->isSpatialIndexEnabled());
+            REQUIRE(findAllWidgets() == expectedWidgets);
+
+            panel->setSpatialIndexEnabled(false);
+        };
+
+        checkIndex();
+
+        panel->setSpatialIndexEnabled(true, 64);
+        REQUIRE(findAllWidgets() == expectedWidgets);
+
+        // Changes made while the index is enabled are picked up by the index
+        widgets[10]->setPosition({500, 500});
+        widgets[11]->setSize({300, 40});
+        widgets[12]->moveToFront();
+        widgets[13]->moveToBack();
+        widgets[14]->setRotation(0);
+        widgets[5]->setRotation(0);
+        panel->remove(widgets[15]);
+        panel->add(tgui::ClickableWidget::create({150, 150}));
+        const auto results = findAllWidgets();
+        panel->setSpatialIndexEnabled(false);
+        checkIndex();
+        REQUIRE(results == expectedWidgets);
+
+        // Copying the panel keeps the index enabled
+        panel->setSpatialIndexEnabled(true);
+        auto panelCopy = tgui::Panel::copy(panel);
+        REQUIRE(panelCopy->isSpatialIndexEnabled());
+        REQUIRE(panelCopy->getWidgetAtPosition({505, 505}) != nullptr);
+        REQUIRE(panelCopy->getWidgetAtPosition({505, 505}) != panel->getWidgetAtPosition({505, 505}));
+
+        panel->removeAllWidgets();
+        REQUIRE(panel->getWidgetAtPosition({505, 505}) == nullptr);
+
+        // Changes to the parts of a widget that lie outside its size are also picked up
+        auto radioButton = tgui::RadioButton::create();
+        radioButton->setPosition({100, 100});
+        radioButton->setSize({20, 20});
+        panel->add(radioButton);
+        REQUIRE(panel->getWidgetAtPosition({150, 110}) == nullptr);
+
+        radioButton->setText("Some long text");
+        REQUIRE(panel->getWidgetAtPosition({150, 110}) == radioButton);
+        REQUIRE(panel->getWidgetAtPosition({450, 110}) == nullptr);
+
+        radioButton->setTextSize(60);
+        REQUIRE(panel->getWidgetAtPosition({450, 110}) == radioButton);
+
+        radioButton->getRenderer()->setTextSize(12);
+        REQUIRE(panel->getWidgetAtPosition({450, 110}) == nullptr);
+    }
+
+    SECTION("Culling children")
+    {
+        auto panel = tgui::Panel::create({2000, 2000});
+        panel->setPosition({-300, -200});
+        for (unsigned int i = 0; i < 400; ++i)
+        {
+            auto widget = tgui::ClickableWidget::create({50, 50});
+            widget->setPosition({static_cast<float>((i % 20) * 100), static_cast<float>((i / 20) * 100)});
+            panel->add(widget);
+        }
+
+        auto rotatedWidget = tgui::ClickableWidget::create({50, 50});
+        rotatedWidget->setPosition({1900, 1900});
+        rotatedWidget->setRotation(45);
+        panel->add(rotatedWidget);
+
+        auto group = tgui::Group::create({400, 300});
+        group->add(panel);
+
+        DrawRecordingRenderTarget target;
+        target.setView({0, 0, 400, 300}, {0, 0, 400, 300}, {400, 300});
+
+        const auto getDrawnChildren = [&]{
+            target.drawnWidgets.clear();
+            target.drawWidget({}, group);
+            REQUIRE(target.drawnWidgets.size() >= 2);
+            REQUIRE(target.drawnWidgets[0] == group);
+            REQUIRE(target.drawnWidgets[1] == panel);
+            return std::vector<tgui::Widget::Ptr>(target.drawnWidgets.begin() + 2, target.drawnWidgets.end());
+        };
+
+        // Only the children in the visible area (x from 300 to 700 and y from 200 to 500) and rotated widgets are considered
+        auto drawnChildren = getDrawnChildren();
+        REQUIRE(drawnChildren.size() == 5*4 + 1);
+        REQUIRE(drawnChildren[0] == panel->getWidgets()[2*20 + 3]);
+        REQUIRE(drawnChildren.back() == rotatedWidget);
+
+        panel->setSpatialIndexEnabled(true, 64);
+        REQUIRE(getDrawnChildren() == drawnChildren);
+
+        panel->getWidgets()[2*20 + 3]->setPosition({0, 0});
+        drawnChildren.erase(drawnChildren.begin());
+        REQUIRE(getDrawnChildren() == drawnChildren);
+
+        // Nothing is skipped when the panel itself is rotated
+        panel->setRotation(1);
+        REQUIRE(getDrawnChildren().size() == panel->getWidgets().size());
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
+
+TEST_CASE("[Container] Benchmark", "[.benchmark]")
+{
+    // Tree with 6 levels of groups that each have 4 children, of which the last one is rotated
+    std::function<void(const tgui::Container::Ptr&, unsigned int)> addChildren = [&](const tgui::Container::Ptr& parent, unsigned int depth){
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            tgui::Widget::Ptr child;
+            if (depth < 6)
+            {
+                auto group = tgui::Group::create({200, 200});
+                addChildren(group, depth + 1);
+                child = group;
+            }
+            else
+                child = tgui::ClickableWidget::create({20, 20});
+
+            child->setPosition({static_cast<float>(i), static_cast<float>(i)});
+            if (i == 3)
+                child->setRotation(10);
+
+            parent->add(child);
+        }
+    };
+
+    auto root = tgui::Group::create({200, 200});
+    addChildren(root, 1);
+
+    DrawRecordingRenderTarget target;
+    target.setView({0, 0, 200, 200}, {0, 0, 200, 200}, {200, 200});
+
+    BENCHMARK("Drawing a deep widget tree")
+    {
+        target.drawnWidgets.clear();
+        target.drawWidget({}, root);
+        return target.drawnWidgets.size();
+    };
+
+    BENCHMARK("Finding widgets in a deep widget tree")
+    {
+        std::size_t widgetsFound = 0;
+        for (float pos = 0; pos < 30; pos += 0.1f)
+        {
+            if (root->getWidgetAtPosition({pos, pos}))
+                ++widgetsFound;
+        }
+        return widgetsFound;
+    };
+}
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Group.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <iostream>
 
@@ -451,6 +452,131 @@ TEST_CASE("[Layouts]")
         }
     }
 
+    SECTION("Recalculation")
+    {
+        auto panel = tgui::Panel::create({400, 300});
+
+        Layout layout = bindMin(bindWidth(panel) - 20, bindHeight(panel) * 0.5f);
+        REQUIRE(layout.getValue() == 150);
+
+        panel->setSize({200, 600});
+        REQUIRE(layout.getValue() == 180);
+        REQUIRE(layout.getLeftOperand()->getValue() == 180);
+        REQUIRE(layout.getRightOperand()->getValue() == 300);
+
+        // A widget that is bound several times by the same layout only updates that layout once
+        auto button = tgui::Button::create();
+        button->setSize({bindWidth(panel) + bindHeight(panel), bindWidth(panel) - bindHeight(panel)});
+        REQUIRE(button->getSize() == tgui::Vector2f(800, -400));
+
+        unsigned int sizeChangeCount = 0;
+        button->onSizeChange([&]{ sizeChangeCount++; });
+        panel->setSize({300, 500});
+        REQUIRE(button->getSize() == tgui::Vector2f(800, -200));
+        REQUIRE(sizeChangeCount == 1);
+
+        // Operands that bound a destroyed widget are replaced by 0
+        auto button2 = tgui::Button::create();
+        button2->setSize(100, 50);
+        button->setPosition(bindRight(button2) + 10, bindPosY(button2));
+        REQUIRE(button->getPosition() == tgui::Vector2f(110, 0));
+        button2 = nullptr;
+        REQUIRE(button->getPosition() == tgui::Vector2f(10, 0));
+    }
+
+    SECTION("Deferred updates")
+    {
+        GuiNull gui;
+
+        auto panel = tgui::Panel::create({200, 100});
+        gui.add(panel);
+
+        auto button1 = tgui::Button::create();
+        button1->setSize({bindWidth(panel) / 2, bindHeight(panel)});
+        gui.add(button1);
+
+        // Button2 depends on the panel both directly and via button1
+        auto button2 = tgui::Button::create();
+        button2->setPosition({bindRight(button1), bindTop(button1)});
+        button2->setSize({bindWidth(button1) + bindWidth(panel), 20});
+        gui.add(button2);
+
+        unsigned int button1SizeChangeCount = 0;
+        unsigned int sizeChangeCount = 0;
+        button1->onSizeChange([&]{ button1SizeChangeCount++; });
+        button2->onSizeChange([&]{ sizeChangeCount++; });
+
+        REQUIRE(!gui.getLayoutUpdatesDeferred());
+        gui.setLayoutUpdatesDeferred(true);
+        REQUIRE(gui.getLayoutUpdatesDeferred());
+
+        // The widgets that depend on the panel are only resized when the layout is flushed
+        panel->setSize({400, 50});
+        REQUIRE(panel->getSize() == tgui::Vector2f(400, 50));
+        REQUIRE(button1SizeChangeCount == 0);
+        REQUIRE(sizeChangeCount == 0);
+
+        gui.flushLayout();
+        REQUIRE(button1->getSize() == tgui::Vector2f(200, 50));
+        REQUIRE(button2->getPosition() == tgui::Vector2f(200, 0));
+        REQUIRE(button2->getSize() == tgui::Vector2f(600, 20));
+        REQUIRE(button1SizeChangeCount == 1);
+        REQUIRE(sizeChangeCount == 1);
+
+        gui.flushLayout();
+        REQUIRE(sizeChangeCount == 1);
+
+        // Pending changes are applied when layouts are no longer deferred
+        panel->setSize({100, 50});
+        REQUIRE(sizeChangeCount == 1);
+        gui.setLayoutUpdatesDeferred(false);
+        REQUIRE(button2->getSize() == tgui::Vector2f(150, 20));
+        REQUIRE(sizeChangeCount == 2);
+
+        panel->setSize({200, 50});
+        REQUIRE(button1->getSize() == tgui::Vector2f(100, 50));
+
+        // Resizing the gui always updates the widgets in a single pass
+        button1->setSize({bindWidth(gui) / 2, bindHeight(gui) / 10});
+        button2->setSize({bindWidth(button1) + bindWidth(gui), 20});
+        REQUIRE(button2->getSize() == tgui::Vector2f(300, 20));
+
+        sizeChangeCount = 0;
+        gui.setAbsoluteView({0, 0, 400, 300});
+        REQUIRE(button1->getSize() == tgui::Vector2f(200, 30));
+        REQUIRE(button2->getPosition() == tgui::Vector2f(200, 0));
+        REQUIRE(button2->getSize() == tgui::Vector2f(600, 20));
+        REQUIRE(sizeChangeCount == 1);
+
+        // A chain of widgets that are each placed below the previous one is positioned correctly in a single flush
+        auto form = tgui::Panel::create({400, 400});
+        gui.add(form);
+
+        std::vector<tgui::Button::Ptr> rows;
+        for (unsigned int i = 0; i < 40; ++i)
+        {
+            auto row = tgui::Button::create();
+            if (!rows.empty())
+                row->setPosition({bindLeft(rows.back()), bindBottom(rows.back())});
+            row->setSize({bindWidth(form) - 20, bindHeight(form) / 40});
+            form->add(row);
+            rows.push_back(row);
+        }
+        REQUIRE(rows.back()->getPosition() == tgui::Vector2f(0, 390));
+
+        unsigned int lastRowMoveCount = 0;
+        rows.back()->onPositionChange([&]{ lastRowMoveCount++; });
+
+        gui.setLayoutUpdatesDeferred(true);
+        form->setSize({800, 800});
+        REQUIRE(rows.back()->getPosition() == tgui::Vector2f(0, 390));
+        gui.flushLayout();
+        REQUIRE(rows.back()->getPosition() == tgui::Vector2f(0, 780));
+        REQUIRE(rows.back()->getSize() == tgui::Vector2f(780, 20));
+        REQUIRE(lastRowMoveCount == 1);
+        gui.setLayoutUpdatesDeferred(false);
+    }
+
     SECTION("Bug Fixes")
     {
         SECTION("Setting negative size and reverting back to positive (https://github.com/texus/TGUI/issues/54)")
@@ -495,3 +621,47 @@ TEST_CASE("[Layouts]")
         }
     }
 }
+
+TEST_CASE("[Layouts] Benchmark", "[.benchmark]")
+{
+    float height = 400;
+
+    // Layouts that aren't connected to a widget, only their evaluation is measured when the bound widget changes
+    auto group = tgui::Group::create({400, 300});
+    std::vector<Layout> layouts;
+    layouts.reserve(100);
+    for (unsigned int i = 0; i < 100; ++i)
+        layouts.push_back(bindMin(bindWidth(group) - 20, bindHeight(group) * 0.5f) + bindMax(bindInnerWidth(group) / 4, bindLeft(group) + 10));
+
+    BENCHMARK("Recalculate 100 layouts bound to a resized widget")
+    {
+        height = (height == 400) ? 800.f : 400.f;
+        group->setSize({height, height});
+        return layouts.back().getValue();
+    };
+
+    auto stringPanel = tgui::Panel::create({400, 300});
+    std::vector<tgui::Button::Ptr> buttons;
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        auto button = tgui::Button::create();
+        button->setSize({"min(&.width - 20, parent.height * 0.5)", "max(&.ih / 4, 10) + 5 * 2"});
+        button->setPosition({"(&.w - width) / 2", "&.h * 10%"});
+        stringPanel->add(button);
+        buttons.push_back(button);
+    }
+
+    BENCHMARK("Resize panel with 100 string layouts")
+    {
+        height = (height == 400) ? 800.f : 400.f;
+        stringPanel->setSize({height, height});
+        return buttons.back()->getPosition().x;
+    };
+
+    BENCHMARK("Set string layouts on 100 widgets")
+    {
+        for (auto& button : buttons)
+            button->setSize({"min(&.width - 20, parent.height * 0.5)", "max(&.ih / 4, 10) + 5 * 2"});
+        return buttons.back()->getSize().x;
+    };
+}
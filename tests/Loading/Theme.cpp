@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Loading/WidgetFactory.hpp>
 #include <TGUI/Widgets/Label.hpp>
 
 // TODO: Reloading theme
@@ -65,6 +66,33 @@ TEST_CASE("[Theme]")
             tgui::Theme theme2("resources/Black.txt");
             REQUIRE_THROWS_AS(theme2.getRenderer("nonexistent_section"), tgui::Exception);
         }
+
+        SECTION("Values are deserialized once")
+        {
+            tgui::Theme theme("resources/Black.txt");
+            auto chatBoxRenderer = theme.getRenderer("ChatBox");
+            auto listBoxRenderer = theme.getRenderer("ListBox");
+
+            // Both sections contain the same texture, which is only loaded once
+            REQUIRE(chatBoxRenderer->propertyValuePairs["TextureBackground"].getType() == tgui::ObjectConverter::Type::Texture);
+            REQUIRE(listBoxRenderer->propertyValuePairs["TextureBackground"].getType() == tgui::ObjectConverter::Type::Texture);
+            REQUIRE(chatBoxRenderer->propertyValuePairs["TextureBackground"].getTexture().getData()
+                    == listBoxRenderer->propertyValuePairs["TextureBackground"].getTexture().getData());
+
+            REQUIRE(listBoxRenderer->propertyValuePairs["Padding"].getType() == tgui::ObjectConverter::Type::Outline);
+            REQUIRE(listBoxRenderer->propertyValuePairs["Padding"].getOutline() == tgui::Padding{3});
+
+            // Nested renderers are only deserialized when needed, each section gets its own copy
+            tgui::Theme theme2("resources/ThemeNested.txt");
+            auto nestedListBoxRenderer = theme2.getRenderer("ListBox1");
+            REQUIRE(nestedListBoxRenderer->propertyValuePairs["BackgroundColor"].getType() == tgui::ObjectConverter::Type::Color);
+            REQUIRE(nestedListBoxRenderer->propertyValuePairs["Scrollbar"].getType() == tgui::ObjectConverter::Type::String);
+
+            // Global properties are deserialized as well
+            tgui::Theme theme3("resources/TransparentGrey.txt");
+            REQUIRE(theme3.getGlobalProperty("TextColor").getType() == tgui::ObjectConverter::Type::Color);
+            REQUIRE(theme3.getGlobalProperty("TextColor").getColor() == tgui::Color{255, 255, 255, 215});
+        }
     }
 
     SECTION("Adding and removing renderers")
@@ -206,3 +234,31 @@ TEST_CASE("[Theme]")
         REQUIRE(loader->loadCount == 2);
     }
 }
+
+TEST_CASE("[Theme] Benchmark", "[.benchmark]")
+{
+    const std::vector<tgui::String> types = {"Button", "Label", "EditBox", "ListView", "CheckBox", "ComboBox", "Slider", "ChildWindow", "TextArea", "ProgressBar"};
+
+    std::vector<tgui::Widget::Ptr> widgets;
+    for (unsigned int i = 0; i < 1000; ++i)
+        widgets.push_back(tgui::WidgetFactory::getConstructFunction(types[i % types.size()])());
+
+    BENCHMARK("Loading TransparentGrey theme onto 1000 widgets")
+    {
+        auto theme = tgui::Theme::create("resources/TransparentGrey.txt");
+        for (std::size_t i = 0; i < widgets.size(); ++i)
+            widgets[i]->setRenderer(theme->getRenderer(types[i % types.size()]));
+        return widgets.size();
+    };
+
+    BENCHMARK("Loading TransparentGrey theme onto 1000 widgets with their own renderer copy")
+    {
+        auto theme = tgui::Theme::create("resources/TransparentGrey.txt");
+        for (std::size_t i = 0; i < widgets.size(); ++i)
+        {
+            widgets[i]->setRenderer(theme->getRenderer(types[i % types.size()]));
+            widgets[i]->getRenderer()->setOpacity(1);
+        }
+        return widgets.size();
+    };
+}
@@ -0,0 +1,153 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Group.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/Widgets/ProgressBar.hpp>
+#include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/Widgets/Slider.hpp>
+#include <iostream>
+#include <iomanip>
+
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 33)))
+    #include <malloc.h>
+    #define TGUI_TEST_HEAP_USAGE_AVAILABLE 1
+#else
+    #define TGUI_TEST_HEAP_USAGE_AVAILABLE 0
+#endif
+
+namespace
+{
+    // Returns the amount of bytes that are currently allocated on the heap, or 0 when it can't be measured on this platform
+    std::size_t getHeapUsage()
+    {
+#if TGUI_TEST_HEAP_USAGE_AVAILABLE
+        const auto info = mallinfo2();
+        return info.uordblks + info.hblkhd;
+#else
+        return 0;
+#endif
+    }
+
+    struct MemoryUsage
+    {
+        std::size_t objectSize = 0;     // sizeof of the widget class
+        std::size_t bytesPerWidget = 0; // Heap memory per widget (including the widget itself), 0 when it can't be measured
+    };
+
+    template <typename WidgetType, typename CreateFunc>
+    MemoryUsage measureMemoryUsage(const CreateFunc& createFunc)
+    {
+        const std::size_t count = 1000;
+        std::vector<tgui::Widget::Ptr> widgets;
+        widgets.reserve(count);
+
+        const std::size_t heapUsageBefore = getHeapUsage();
+        for (std::size_t i = 0; i < count; ++i)
+            widgets.push_back(createFunc());
+        const std::size_t heapUsageAfter = getHeapUsage();
+
+        MemoryUsage usage;
+        usage.objectSize = sizeof(WidgetType);
+        if (heapUsageAfter > heapUsageBefore)
+            usage.bytesPerWidget = (heapUsageAfter - heapUsageBefore) / count;
+        return usage;
+    }
+
+    void printMemoryUsage(const char* name, const MemoryUsage& usage)
+    {
+        std::cout << std::left << std::setw(28) << name << std::right << std::setw(10) << usage.objectSize;
+        if (TGUI_TEST_HEAP_USAGE_AVAILABLE)
+            std::cout << std::setw(16) << usage.bytesPerWidget;
+        std::cout << "\n";
+    }
+
+    // Gives access to the parts of the label that are only allocated when needed
+    class LabelWithOptionalParts : public tgui::Label
+    {
+    public:
+        bool hasScrollbar() const
+        {
+            return m_scrollbar;
+        }
+
+        bool hasBackgroundSprite() const
+        {
+            return m_spriteBackground != nullptr;
+        }
+    };
+}
+
+TEST_CASE("[MemoryUsage]")
+{
+    SECTION("Label only allocates a scrollbar when it can show one")
+    {
+        auto label = std::make_shared<LabelWithOptionalParts>();
+        label->setText("Line 1\nLine 2\nLine 3\nLine 4\nLine 5");
+        REQUIRE(!label->hasScrollbar());
+
+        label->setScrollbarPolicy(tgui::Scrollbar::Policy::Always);
+        REQUIRE(!label->hasScrollbar());
+
+        label->setSize({100, 20});
+        REQUIRE(label->hasScrollbar());
+    }
+
+    SECTION("Label only allocates a background sprite when it has a background texture")
+    {
+        auto label = std::make_shared<LabelWithOptionalParts>();
+        REQUIRE(!label->hasBackgroundSprite());
+
+        label->getRenderer()->setTextureBackground("resources/Texture1.png");
+        REQUIRE(label->hasBackgroundSprite());
+    }
+}
+
+TEST_CASE("[MemoryUsage] Report", "[.benchmark]")
+{
+    if (!TGUI_TEST_HEAP_USAGE_AVAILABLE)
+        std::cout << "Heap usage can't be measured on this platform, only the object sizes are reported\n";
+
+    std::cout << std::left << std::setw(28) << "Widget" << std::right << std::setw(10) << "sizeof";
+    if (TGUI_TEST_HEAP_USAGE_AVAILABLE)
+        std::cout << std::setw(16) << "bytes/widget";
+    std::cout << "\n";
+    printMemoryUsage("ClickableWidget", measureMemoryUsage<tgui::ClickableWidget>([]{ return tgui::ClickableWidget::create(); }));
+    printMemoryUsage("Label", measureMemoryUsage<tgui::Label>([]{ return tgui::Label::create(); }));
+    printMemoryUsage("Label with text", measureMemoryUsage<tgui::Label>([]{ return tgui::Label::create("Label 12345"); }));
+    printMemoryUsage("Button", measureMemoryUsage<tgui::Button>([]{ return tgui::Button::create("Button"); }));
+    printMemoryUsage("CheckBox", measureMemoryUsage<tgui::CheckBox>([]{ return tgui::CheckBox::create(); }));
+    printMemoryUsage("EditBox", measureMemoryUsage<tgui::EditBox>([]{ return tgui::EditBox::create(); }));
+    printMemoryUsage("Picture", measureMemoryUsage<tgui::Picture>([]{ return tgui::Picture::create(); }));
+    printMemoryUsage("Panel", measureMemoryUsage<tgui::Panel>([]{ return tgui::Panel::create(); }));
+    printMemoryUsage("Group", measureMemoryUsage<tgui::Group>([]{ return tgui::Group::create(); }));
+    printMemoryUsage("Scrollbar", measureMemoryUsage<tgui::Scrollbar>([]{ return tgui::Scrollbar::create(); }));
+    printMemoryUsage("Slider", measureMemoryUsage<tgui::Slider>([]{ return tgui::Slider::create(); }));
+    printMemoryUsage("ProgressBar", measureMemoryUsage<tgui::ProgressBar>([]{ return tgui::ProgressBar::create(); }));
+}
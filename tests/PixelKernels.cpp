@@ -0,0 +1,101 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/PixelKernels.hpp>
+#include <TGUI/Loading/ImageLoader.hpp>
+#include <vector>
+
+namespace
+{
+    std::vector<std::uint8_t> createTestPixels(std::size_t byteCount)
+    {
+        // Pseudo-random values that include 0 and 255, every 5th alpha value is 0
+        std::vector<std::uint8_t> pixels(byteCount);
+        for (std::size_t i = 0; i < byteCount; ++i)
+            pixels[i] = ((i % 4 == 3) && (i % 20 == 3)) ? 0 : static_cast<std::uint8_t>((i * 37 + 11) % 256);
+        return pixels;
+    }
+}
+
+TEST_CASE("[PixelKernels]")
+{
+    const std::string instructionSet = tgui::PixelKernels::getInstructionSet();
+    REQUIRE((instructionSet == "AVX2" || instructionSet == "SSE2" || instructionSet == "NEON" || instructionSet == "Scalar"));
+
+    // Test different pixel counts to make sure that the pixels that don't fill an entire vector are also processed
+    const std::size_t pixelCounts[] = {0, 1, 7, 8, 15, 16, 17, 31, 32, 33, 75};
+    for (const std::size_t pixelCount : pixelCounts)
+    {
+        SECTION("convertRgbToRgba (" + std::to_string(pixelCount) + " pixels)")
+        {
+            const std::vector<std::uint8_t> rgb = createTestPixels(pixelCount * 3);
+            std::vector<std::uint8_t> rgba(pixelCount * 4 + 1, 123);
+            tgui::PixelKernels::convertRgbToRgba(rgb.data(), rgba.data(), pixelCount);
+            for (std::size_t i = 0; i < pixelCount; ++i)
+            {
+                REQUIRE(rgba[4*i + 0] == rgb[3*i + 0]);
+                REQUIRE(rgba[4*i + 1] == rgb[3*i + 1]);
+                REQUIRE(rgba[4*i + 2] == rgb[3*i + 2]);
+                REQUIRE(rgba[4*i + 3] == 255);
+            }
+            REQUIRE(rgba.back() == 123);
+        }
+
+        SECTION("extractTransparencyMask (" + std::to_string(pixelCount) + " pixels)")
+        {
+            const std::vector<std::uint8_t> pixels = createTestPixels(pixelCount * 4);
+            std::vector<std::uint8_t> mask((pixelCount + 7) / 8, 0xFF);
+            const std::size_t transparentPixelCount = tgui::PixelKernels::extractTransparencyMask(pixels.data(), pixelCount, mask.data());
+
+            std::size_t expectedTransparentPixelCount = 0;
+            for (std::size_t i = 0; i < pixelCount; ++i)
+            {
+                const bool transparent = (pixels[4*i + 3] == 0);
+                REQUIRE((((mask[i / 8] >> (i % 8)) & 1) != 0) == transparent);
+                if (transparent)
+                    ++expectedTransparentPixelCount;
+            }
+            REQUIRE(transparentPixelCount == expectedTransparentPixelCount);
+
+            // Unused bits in the last byte are set to 0
+            if (pixelCount % 8 != 0)
+                REQUIRE((mask.back() >> (pixelCount % 8)) == 0);
+        }
+    }
+
+    SECTION("Loading RGB image")
+    {
+        tgui::Vector2u imageSize;
+        const auto pixels = tgui::ImageLoader::loadFromFile("resources/image.jpg", imageSize);
+        REQUIRE(pixels != nullptr);
+        REQUIRE(imageSize == tgui::Vector2u{50, 50});
+
+        bool opaque = true;
+        for (unsigned int i = 0; i < imageSize.x * imageSize.y; ++i)
+            opaque = opaque && (pixels[i*4 + 3] == 255);
+        REQUIRE(opaque);
+    }
+}
@@ -0,0 +1,305 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/RendererProperties.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/ListView.hpp>
+#include <algorithm>
+
+namespace
+{
+    class LabelRecordingRendererChanges : public tgui::Label
+    {
+    public:
+        std::vector<tgui::String> changedProperties;
+
+    protected:
+        void rendererChanged(const tgui::String& property) override
+        {
+            changedProperties.push_back(property);
+            Label::rendererChanged(property);
+        }
+    };
+}
+
+TEST_CASE("[RendererProperties]")
+{
+    SECTION("Registry")
+    {
+        SECTION("Builtin properties")
+        {
+            REQUIRE(tgui::RendererPropertyRegistry::getName(tgui::RendererProperty::Borders) == "Borders");
+            REQUIRE(tgui::RendererPropertyRegistry::getName(tgui::RendererProperty::TextColorHover) == "TextColorHover");
+            REQUIRE(tgui::RendererPropertyRegistry::getId("Opacity") == tgui::RendererProperty::Opacity);
+            REQUIRE(tgui::RendererPropertyRegistry::findId("TextureBackground") == tgui::RendererProperty::TextureBackground);
+
+            // Ids are assigned alphabetically and every name maps back to its own id
+            for (tgui::RendererPropertyId id = 0; id < tgui::RendererProperty::BuiltinCount; ++id)
+            {
+                const tgui::String& name = tgui::RendererPropertyRegistry::getName(id);
+                REQUIRE(tgui::RendererPropertyRegistry::findId(name) == id);
+                REQUIRE(tgui::RendererPropertyRegistry::findId(tgui::String(name)) == id);
+                if (id > 0)
+                    REQUIRE(tgui::RendererPropertyRegistry::getName(id - 1) < name);
+            }
+        }
+
+        SECTION("Types")
+        {
+            REQUIRE(tgui::RendererPropertyRegistry::getType(tgui::RendererProperty::TextColor) == tgui::ObjectConverter::Type::Color);
+            REQUIRE(tgui::RendererPropertyRegistry::getType(tgui::RendererProperty::Borders) == tgui::ObjectConverter::Type::Outline);
+            REQUIRE(tgui::RendererPropertyRegistry::getType(tgui::RendererProperty::TextureBackground) == tgui::ObjectConverter::Type::Texture);
+            REQUIRE(tgui::RendererPropertyRegistry::getType(tgui::RendererProperty::TextSize) == tgui::ObjectConverter::Type::Number);
+            REQUIRE(tgui::RendererPropertyRegistry::getType(tgui::RendererProperty::Font) == tgui::ObjectConverter::Type::Font);
+            REQUIRE(tgui::RendererPropertyRegistry::getType(tgui::RendererProperty::TransparentTexture) == tgui::ObjectConverter::Type::Bool);
+            REQUIRE(tgui::RendererPropertyRegistry::getType(tgui::RendererProperty::TextStyle) == tgui::ObjectConverter::Type::TextStyle);
+            REQUIRE(tgui::RendererPropertyRegistry::getType(tgui::RendererProperty::Scrollbar) == tgui::ObjectConverter::Type::RendererData);
+
+            REQUIRE(tgui::RendererPropertyRegistry::getType(tgui::RendererPropertyRegistry::getId("TypeTestProperty")) == tgui::ObjectConverter::Type::None);
+            REQUIRE(tgui::RendererPropertyRegistry::getType(tgui::RendererPropertyRegistry::InvalidId) == tgui::ObjectConverter::Type::None);
+        }
+
+        SECTION("Runtime properties")
+        {
+            REQUIRE(tgui::RendererPropertyRegistry::findId("RegistryTestProperty") == tgui::RendererPropertyRegistry::InvalidId);
+
+            const tgui::RendererPropertyId id = tgui::RendererPropertyRegistry::getId("RegistryTestProperty");
+            REQUIRE(id >= tgui::RendererProperty::BuiltinCount);
+            REQUIRE(id != tgui::RendererPropertyRegistry::InvalidId);
+            REQUIRE(tgui::RendererPropertyRegistry::getId("RegistryTestProperty") == id);
+            REQUIRE(tgui::RendererPropertyRegistry::findId("RegistryTestProperty") == id);
+            REQUIRE(tgui::RendererPropertyRegistry::getName(id) == "RegistryTestProperty");
+        }
+    }
+
+    SECTION("RendererPropertyMap")
+    {
+        tgui::RendererPropertyMap map;
+        REQUIRE(map.empty());
+        REQUIRE(map.find("Borders") == map.end());
+
+        map["TextColor"] = tgui::Color::Red;
+        map[tgui::RendererProperty::Borders] = tgui::Borders{2};
+        map["MapTestProperty"] = 5;
+        map["BackgroundColor"] = tgui::Color::Green;
+        REQUIRE(map.size() == 4);
+
+        SECTION("Sorted on id")
+        {
+            std::vector<tgui::String> names;
+            for (const auto& pair : map)
+                names.push_back(pair.first);
+
+            REQUIRE(names == std::vector<tgui::String>{"BackgroundColor", "Borders", "TextColor", "MapTestProperty"});
+            REQUIRE(std::is_sorted(map.getIds().begin(), map.getIds().end()));
+        }
+
+        SECTION("Find")
+        {
+            REQUIRE(map.find(tgui::RendererProperty::TextColor)->second.getColor() == tgui::Color::Red);
+            REQUIRE(map.find("Borders")->second.getOutline() == tgui::Borders{2});
+            REQUIRE(map.find("MapTestProperty")->second.getNumber() == 5);
+            REQUIRE(map.find("BorderColor") == map.end());
+            REQUIRE(map.find("NonexistentProperty") == map.end());
+            REQUIRE(map.count("BackgroundColor") == 1);
+            REQUIRE(map.count("BorderColor") == 0);
+        }
+
+        SECTION("References remain valid")
+        {
+            tgui::ObjectConverter& value = map["TextColor"];
+            map["Padding"] = tgui::Padding{1};
+            map["Font"] = tgui::Font{};
+            map.erase("BackgroundColor");
+            REQUIRE(&value == &map["TextColor"]);
+            REQUIRE(value.getColor() == tgui::Color::Red);
+        }
+
+        SECTION("Erase")
+        {
+            REQUIRE(map.erase("Borders") == 1);
+            REQUIRE(map.erase("Borders") == 0);
+            REQUIRE(map.size() == 3);
+
+            auto it = map.erase(map.find("BackgroundColor"));
+            REQUIRE(it->first == "TextColor");
+            REQUIRE(map.size() == 2);
+
+            map.clear();
+            REQUIRE(map.empty());
+            REQUIRE(map.begin() == map.end());
+        }
+
+        SECTION("Copying")
+        {
+            tgui::RendererPropertyMap copy = map;
+            copy["TextColor"] = tgui::Color::Blue;
+            REQUIRE(map["TextColor"].getColor() == tgui::Color::Red);
+            REQUIRE(copy["TextColor"].getColor() == tgui::Color::Blue);
+            REQUIRE(copy.getIds() == map.getIds());
+        }
+
+        SECTION("Converting from and to std::map")
+        {
+            std::map<tgui::String, tgui::ObjectConverter> stdMap = map;
+            REQUIRE(stdMap.size() == 4);
+            REQUIRE(stdMap.at("Borders").getOutline() == tgui::Borders{2});
+
+            const tgui::RendererPropertyMap map2 = stdMap;
+            REQUIRE(map2.getIds() == map.getIds());
+        }
+    }
+
+    SECTION("RendererPropertyMask")
+    {
+        tgui::RendererPropertyMask mask;
+        REQUIRE(mask.empty());
+        REQUIRE(!mask.test(tgui::RendererProperty::TextColor));
+
+        const tgui::RendererPropertyId runtimeId = tgui::RendererPropertyRegistry::getId("MaskTestProperty");
+        mask.set(runtimeId);
+        mask.set(tgui::RendererProperty::TextColor);
+        mask.set(tgui::RendererProperty::Borders);
+        mask.set(tgui::RendererProperty::TextColor);
+        REQUIRE(!mask.empty());
+        REQUIRE(mask.test(tgui::RendererProperty::TextColor));
+        REQUIRE(mask.test(runtimeId));
+        REQUIRE(!mask.test(tgui::RendererProperty::Padding));
+        REQUIRE(mask.getIds() == std::vector<tgui::RendererPropertyId>{tgui::RendererProperty::Borders, tgui::RendererProperty::TextColor, runtimeId});
+
+        tgui::RendererPropertyMask mask2;
+        mask2.set(tgui::RendererProperty::Padding);
+        mask2 |= mask;
+        REQUIRE(mask2.getIds().size() == 4);
+        REQUIRE(mask2.test(tgui::RendererProperty::Padding));
+        REQUIRE(mask2.test(runtimeId));
+
+        mask.clear();
+        REQUIRE(mask.empty());
+        REQUIRE(mask.getIds().empty());
+    }
+
+    SECTION("Widgets are notified")
+    {
+        auto label = tgui::Label::create("Text");
+        auto renderer = label->getRenderer();
+
+        renderer->setProperty(tgui::RendererProperty::TextColor, tgui::Color::Red);
+        REQUIRE(renderer->getTextColor() == tgui::Color::Red);
+        REQUIRE(renderer->getProperty("TextColor").getColor() == tgui::Color::Red);
+
+        renderer->setProperty("BorderColor", tgui::Color::Green);
+        REQUIRE(renderer->getBorderColor() == tgui::Color::Green);
+
+        REQUIRE_THROWS_AS(renderer->setProperty("NonexistentProperty", tgui::Color::Blue), tgui::Exception);
+        REQUIRE(renderer->getProperty("NonexistentProperty").getType() == tgui::ObjectConverter::Type::None);
+    }
+
+    SECTION("Batch updates")
+    {
+        auto label = std::make_shared<LabelRecordingRendererChanges>();
+        auto renderer = label->getRenderer();
+        label->changedProperties.clear();
+
+        REQUIRE(!tgui::WidgetRenderer::isBatchUpdateActive());
+
+        SECTION("Changes are combined")
+        {
+            tgui::WidgetRenderer::beginBatchUpdate();
+            REQUIRE(tgui::WidgetRenderer::isBatchUpdateActive());
+
+            renderer->setTextColor(tgui::Color::Red);
+            renderer->setBorders({2});
+            renderer->setTextColor(tgui::Color::Green);
+            renderer->setPadding({3});
+
+            // Values can already be read, but the widget hasn't been informed yet
+            REQUIRE(renderer->getTextColor() == tgui::Color::Green);
+            REQUIRE(label->changedProperties.empty());
+
+            tgui::WidgetRenderer::beginBatchUpdate();
+            renderer->setBorders({4});
+            tgui::WidgetRenderer::endBatchUpdate();
+            REQUIRE(label->changedProperties.empty());
+
+            tgui::WidgetRenderer::endBatchUpdate();
+            REQUIRE(!tgui::WidgetRenderer::isBatchUpdateActive());
+            REQUIRE(label->changedProperties == std::vector<tgui::String>{"Borders", "Padding", "TextColor"});
+            REQUIRE(renderer->getBorders() == tgui::Borders{4});
+
+            // Outside a batch, the widget is informed immediately again
+            renderer->setOpacity(0.5f);
+            REQUIRE(label->changedProperties.size() == 4);
+            REQUIRE(label->changedProperties.back() == "Opacity");
+        }
+
+        SECTION("Unknown property")
+        {
+            tgui::WidgetRenderer::beginBatchUpdate();
+            REQUIRE_NOTHROW(renderer->setProperty("NonexistentProperty", tgui::Color::Blue));
+            renderer->setTextColor(tgui::Color::Red);
+            REQUIRE_THROWS_AS(tgui::WidgetRenderer::endBatchUpdate(), tgui::Exception);
+            REQUIRE(!tgui::WidgetRenderer::isBatchUpdateActive());
+
+            // The rejected property is rolled back while the valid one is kept
+            REQUIRE(renderer->getProperty("NonexistentProperty").getType() == tgui::ObjectConverter::Type::None);
+            REQUIRE(renderer->getTextColor() == tgui::Color::Red);
+            REQUIRE(std::count(label->changedProperties.begin(), label->changedProperties.end(), "TextColor") > 0);
+        }
+
+        SECTION("Invalid value")
+        {
+            renderer->setBorderColor(tgui::Color::Green);
+            label->changedProperties.clear();
+
+            tgui::WidgetRenderer::beginBatchUpdate();
+            renderer->setProperty(tgui::RendererProperty::BorderColor, tgui::String{"NotAColor"});
+            renderer->setTextColor(tgui::Color::Red);
+            REQUIRE_THROWS_AS(tgui::WidgetRenderer::endBatchUpdate(), tgui::Exception);
+
+            // The properties after the rejected one are still passed to the widget
+            REQUIRE(renderer->getBorderColor() == tgui::Color::Green);
+            REQUIRE(renderer->getTextColor() == tgui::Color::Red);
+            REQUIRE(label->changedProperties.back() == "TextColor");
+        }
+
+        SECTION("Widget destroyed during batch")
+        {
+            auto label2 = std::make_shared<LabelRecordingRendererChanges>();
+            label2->setRenderer(renderer->getData());
+            label->changedProperties.clear();
+
+            tgui::WidgetRenderer::beginBatchUpdate();
+            renderer->setTextColor(tgui::Color::Red);
+            label2 = nullptr;
+            tgui::WidgetRenderer::endBatchUpdate();
+
+            REQUIRE(label->changedProperties == std::vector<tgui::String>{"TextColor"});
+        }
+    }
+}
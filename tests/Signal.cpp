@@ -24,6 +24,8 @@
 
 #include "Tests.hpp"
 #include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/ChildWindow.hpp>
+#include <thread>
 
 TEST_CASE("[Signal]")
 {
@@ -139,4 +141,210 @@ TEST_CASE("[Signal]")
         signal.emit(nullptr);
         REQUIRE(x == 5);
     }
+
+    SECTION("Changing handlers while emitting")
+    {
+        tgui::Signal signal{"Test"};
+        REQUIRE(signal.getName() == "Test");
+        REQUIRE(!signal.emit(nullptr));
+
+        std::vector<int> calls;
+        unsigned int id1 = 0;
+        unsigned int id3 = 0;
+        id1 = signal.connect([&]{
+            calls.push_back(1);
+            signal.disconnect(id1); // Handler disconnects itself
+            signal.disconnect(id3); // Handler that didn't get called yet is disconnected
+            signal.connect([&]{ calls.push_back(4); }); // Handler is only called the next time
+        });
+        signal.connect([&]{ calls.push_back(2); });
+        id3 = signal.connect([&]{ calls.push_back(3); });
+
+        REQUIRE(signal.emit(nullptr));
+        REQUIRE(calls == std::vector<int>{1, 2});
+
+        calls.clear();
+        REQUIRE(signal.emit(nullptr));
+        REQUIRE(calls == std::vector<int>{2, 4});
+
+        // Emitting the signal again from inside a handler
+        calls.clear();
+        signal.disconnectAll();
+        unsigned int depth = 0;
+        signal.connect([&]{
+            calls.push_back(static_cast<int>(++depth));
+            if (depth < 3)
+                signal.emit(nullptr);
+        });
+        signal.emit(nullptr);
+        REQUIRE(calls == std::vector<int>{1, 2, 3});
+
+        // Disconnecting all handlers while emitting
+        calls.clear();
+        signal.disconnectAll();
+        signal.connect([&]{ calls.push_back(1); signal.disconnectAll(); });
+        signal.connect([&]{ calls.push_back(2); });
+        REQUIRE(signal.emit(nullptr));
+        REQUIRE(!signal.emit(nullptr));
+        REQUIRE(calls == std::vector<int>{1});
+    }
+
+    SECTION("Widget destroyed while emitting")
+    {
+        auto button = tgui::Button::create();
+        unsigned int count = 0;
+        button->onSizeChange([&]{ ++count; button = nullptr; });
+        button->onSizeChange([&]{ ++count; });
+
+        tgui::Button* const buttonPtr = button.get();
+        REQUIRE(buttonPtr->onSizeChange.emit(buttonPtr, {100, 25}));
+        REQUIRE(button == nullptr);
+        REQUIRE(count == 2);
+    }
+
+    SECTION("Nested emits with different parameters")
+    {
+        tgui::SignalInt signalInt{"Int"};
+        tgui::SignalString signalString{"String"};
+
+        std::vector<int> ints;
+        std::vector<tgui::String> strings;
+        signalString.connect([&](const tgui::String& str){
+            strings.push_back(str);
+            if (str == "outer")
+                signalInt.emit(nullptr, 2);
+            strings.push_back(str);
+        });
+        signalInt.connect([&](int value){
+            ints.push_back(value);
+            if (value == 1)
+                signalString.emit(nullptr, "outer");
+            else if (value == 2)
+                signalString.emit(nullptr, "inner");
+            ints.push_back(value);
+        });
+
+        REQUIRE(signalInt.emit(nullptr, 1));
+        REQUIRE(ints == std::vector<int>{1, 2, 2, 1});
+        REQUIRE(strings == std::vector<tgui::String>{"outer", "inner", "inner", "outer"});
+    }
+
+    SECTION("postEmit")
+    {
+        tgui::SignalInt signal{"Test"};
+        std::vector<int> values;
+        signal.connect([&](int value){ values.push_back(value); });
+
+        std::thread thread([&signal]{
+            for (int i = 0; i < 10; ++i)
+                signal.postEmit(nullptr, i);
+        });
+        thread.join();
+
+        REQUIRE(values.empty());
+        REQUIRE(tgui::Signal::dispatchPostedEmits());
+        REQUIRE(values == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        REQUIRE(!tgui::Signal::dispatchPostedEmits());
+
+        // The gui dispatches the posted emits when its time is updated
+        values.clear();
+        signal.postEmit(nullptr, 5);
+        globalGui->updateTime(tgui::Duration{});
+        REQUIRE(values == std::vector<int>{5});
+
+        // Emits that are posted while dispatching are only emitted the next time
+        values.clear();
+        tgui::SignalItem signalItem{"Item"};
+        signalItem.connect([&](const tgui::String& item, const tgui::String& id){
+            REQUIRE(item == "Item");
+            REQUIRE(id == "Id");
+        });
+        signalItem.connect([&](int index){
+            values.push_back(index);
+            signalItem.postEmit(nullptr, index + 1, "Item", "Id");
+        });
+        signalItem.postEmit(nullptr, 1, "Item", "Id");
+        REQUIRE(tgui::Signal::dispatchPostedEmits());
+        REQUIRE(values == std::vector<int>{1});
+        REQUIRE(tgui::Signal::dispatchPostedEmits());
+        REQUIRE(values == std::vector<int>{1, 2});
+        signalItem.disconnectAll();
+        REQUIRE(!tgui::Signal::dispatchPostedEmits());
+
+        // Destroying the signal cancels the posted emits
+        values.clear();
+        {
+            tgui::Signal tempSignal{"Temp"};
+            tempSignal.connect([&]{ values.push_back(0); });
+            tempSignal.postEmit(nullptr);
+            signal.postEmit(nullptr, 3);
+        }
+        REQUIRE(tgui::Signal::dispatchPostedEmits());
+        REQUIRE(values == std::vector<int>{3});
+
+        // Signals with their own parameter types pass all their parameters to the handlers
+        auto childWindow = tgui::ChildWindow::create();
+        tgui::SignalChildWindow signalChildWindow{"ChildWindow"};
+        signalChildWindow.connect([&](const tgui::ChildWindow::Ptr& window){ REQUIRE(window == childWindow); values.push_back(4); });
+        signalChildWindow.postEmit(childWindow.get());
+
+        tgui::SignalFileDialogPaths signalPaths{"Paths"};
+        signalPaths.connect([&](const std::vector<tgui::Filesystem::Path>& paths){ REQUIRE(paths.size() == 2); values.push_back(5); });
+        signalPaths.postEmit(nullptr, {tgui::Filesystem::Path{"a.txt"}, tgui::Filesystem::Path{"b.txt"}});
+
+        tgui::SignalShowEffect signalShowEffect{"ShowEffect"};
+        signalShowEffect.connect([&](tgui::ShowEffectType type, bool visible){ REQUIRE(type == tgui::ShowEffectType::Scale); REQUIRE(visible); values.push_back(6); });
+        signalShowEffect.postEmit(nullptr, tgui::ShowEffectType::Scale, true);
+
+        tgui::SignalAnimationType signalAnimationType{"AnimationType"};
+        signalAnimationType.connect([&](tgui::AnimationType type){ REQUIRE(type == tgui::AnimationType::Resize); values.push_back(7); });
+        signalAnimationType.postEmit(nullptr, tgui::AnimationType::Resize);
+
+        tgui::SignalItemHierarchy signalItemHierarchy{"ItemHierarchy"};
+        signalItemHierarchy.connect([&](const std::vector<tgui::String>& fullItem){ REQUIRE(fullItem == std::vector<tgui::String>{"Parent", "Leaf"}); values.push_back(8); });
+        signalItemHierarchy.postEmit(nullptr, "Leaf", {"Parent", "Leaf"});
+
+        values.clear();
+        REQUIRE(tgui::Signal::dispatchPostedEmits());
+        REQUIRE(values == std::vector<int>{4, 5, 6, 7, 8});
+    }
+}
+
+TEST_CASE("[Signal] Benchmark", "[.benchmark]")
+{
+    std::vector<tgui::Widget::Ptr> widgets;
+    widgets.reserve(100000);
+    for (unsigned int i = 0; i < 100000; ++i)
+        widgets.push_back(tgui::ClickableWidget::create());
+
+    const auto resizeWidgets = [&widgets]{
+        float size = widgets[0]->getSize().x;
+        for (const auto& widget : widgets)
+        {
+            size = (size > 50) ? 10.f : size + 1;
+            widget->setSize({size, size});
+        }
+        return size;
+    };
+
+    BENCHMARK("Resizing 100k widgets without onSizeChange handlers")
+    {
+        return resizeWidgets();
+    };
+
+    unsigned int handlersCalled = 0;
+    for (const auto& widget : widgets)
+        widget->onSizeChange([&handlersCalled]{ ++handlersCalled; });
+
+    BENCHMARK("Resizing 100k widgets with an onSizeChange handler")
+    {
+        return resizeWidgets();
+    };
+
+    BENCHMARK("Emitting onSizeChange on 100k widgets")
+    {
+        for (const auto& widget : widgets)
+            widget->onSizeChange.emit(widget.get(), widget->getSize());
+        return handlersCalled;
+    };
 }
@@ -501,3 +501,46 @@ TEST_CASE("[Sprite]")
         }
     }
 }
+
+TEST_CASE("[Sprite] Vertices")
+{
+    tgui::Sprite sprite;
+    REQUIRE(sprite.getVertexCount() == 0);
+    REQUIRE(sprite.getIndices().empty());
+
+    sprite.setTexture({"resources/image.png", {}, {10, 5, 30, 40}});
+    sprite.setSize({100, 100});
+    REQUIRE(sprite.getScalingType() == tgui::Sprite::ScalingType::NineSlice);
+    REQUIRE(sprite.getVertexCount() == 16);
+    REQUIRE(sprite.getIndices().size() == 54);
+    REQUIRE(sprite.getVertices()[0].position == tgui::Vector2f{0, 0});
+    REQUIRE(sprite.getVertices()[15].position == tgui::Vector2f{100, 100});
+
+    // All sprites with the same scaling type share their indices
+    tgui::Sprite sprite2{sprite.getTexture()};
+    sprite2.setSize({200, 150});
+    REQUIRE(&sprite2.getIndices() == &sprite.getIndices());
+
+    sprite.setSize({9, 1});
+    REQUIRE(sprite.getScalingType() == tgui::Sprite::ScalingType::Normal);
+    REQUIRE(sprite.getVertexCount() == 4);
+    REQUIRE(sprite.getIndices().size() == 6);
+    REQUIRE(sprite.getVertices()[3].position == tgui::Vector2f{9, 1});
+    REQUIRE(sprite.getVertices()[3].texCoords == tgui::Vector2f{1, 1});
+}
+
+TEST_CASE("[Sprite] Benchmark", "[.benchmark]")
+{
+    const tgui::Texture texture{"resources/image.png", {}, {10, 5, 30, 40}};
+    std::vector<tgui::Sprite> sprites(10000, tgui::Sprite{texture});
+
+    float size = 100;
+    BENCHMARK("Resizing 10000 9-slice sprites")
+    {
+        size = (size < 200) ? (size + 1) : 100;
+        for (auto& sprite : sprites)
+            sprite.setSize({size, size / 2});
+
+        return sprites.back().getVertexCount();
+    };
+}
@@ -43,6 +43,13 @@
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
 
+// Removes the widgets from the gui at the end of a draw test, so that they don't keep their textures alive in later tests
+struct DrawTestGuiCleaner
+{
+    tgui::BackendGui& gui;
+    ~DrawTestGuiCleaner() { gui.removeAllWidgets(); }
+};
+
 #if TGUI_HAS_BACKEND_SFML_GRAPHICS
     #include <SFML/Graphics/RenderTexture.hpp>
     #include <TGUI/Backend/SFML-Graphics.hpp>
@@ -60,6 +67,7 @@
                         guiPtr = guiUniquePtr.get(); \
                     } \
                     tgui::BackendGui& gui{*guiPtr}; \
+                    DrawTestGuiCleaner guiCleaner{gui}; \
                     gui.removeAllWidgets(); \
                     gui.add(widget);
     #else
@@ -75,6 +83,7 @@
                         guiPtr = guiUniquePtr.get(); \
                     } \
                     tgui::BackendGui& gui{*guiPtr}; \
+                    DrawTestGuiCleaner guiCleaner{gui}; \
                     gui.removeAllWidgets(); \
                     gui.add(widget);
     #endif
@@ -109,6 +118,7 @@
     // set but the BackendRendererSFML isn't being used at runtime.
     #define TEST_DRAW_INIT(width, height, widget) \
                 tgui::BackendGui& gui{*globalGui}; \
+                DrawTestGuiCleaner guiCleaner{gui}; \
                 gui.removeAllWidgets(); \
                 gui.add(widget);
 
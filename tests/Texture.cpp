@@ -26,6 +26,7 @@
 #include <TGUI/Exception.hpp>
 #include <TGUI/Texture.hpp>
 #include <TGUI/TextureManager.hpp>
+#include <TGUI/Loading/ImageLoader.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
 
 #if TGUI_HAS_BACKEND_SFML_GRAPHICS
@@ -211,6 +212,87 @@ TEST_CASE("[Texture]")
         REQUIRE(tgui::Texture("resources/image.png").isSmooth());
     }
 
+    SECTION("Mipmapped")
+    {
+        tgui::Texture texture{"resources/image.png"};
+        REQUIRE(!texture.isMipmapped());
+
+        tgui::BackendTexture backendTexture;
+        REQUIRE(!backendTexture.isMipmapped());
+
+        backendTexture.setMipmapped(true);
+        REQUIRE(backendTexture.isMipmapped());
+        REQUIRE(backendTexture.load({8, 4}, tgui::MakeUniqueForOverwrite<std::uint8_t[]>(8 * 4 * 4), true));
+        REQUIRE(backendTexture.hasMipmaps());
+        REQUIRE(backendTexture.getGpuMemoryUsage() == (32 + 8 + 2 + 1) * 4);
+
+        backendTexture.setMipmapped(false);
+        REQUIRE(!backendTexture.isMipmapped());
+        REQUIRE(!backendTexture.hasMipmaps());
+        REQUIRE(backendTexture.getGpuMemoryUsage() == 32 * 4);
+    }
+
+    SECTION("Downscaled")
+    {
+        tgui::Vector2u imageSize;
+        REQUIRE(tgui::ImageLoader::loadFromFile("resources/image.png", {20, 20}, imageSize) != nullptr);
+        REQUIRE(imageSize == tgui::Vector2u{25, 25});
+
+        REQUIRE(tgui::ImageLoader::loadFromFile("resources/image.jpg", {10, 10}, imageSize) != nullptr);
+        REQUIRE(imageSize == tgui::Vector2u{12, 12});
+
+        // The image is never made smaller than the requested size
+        REQUIRE(tgui::ImageLoader::loadFromFile("resources/image.png", {30, 10}, imageSize) != nullptr);
+        REQUIRE(imageSize == tgui::Vector2u{50, 50});
+
+        REQUIRE(tgui::ImageLoader::loadFromFile("NonExistent.png", {10, 10}, imageSize) == nullptr);
+
+        auto pixels = tgui::ImageLoader::loadFromFile("resources/image.png", {10, 20}, imageSize);
+        REQUIRE(imageSize == tgui::Vector2u{25, 25});
+
+        tgui::Texture texture;
+        texture.loadFromPixelData(imageSize, pixels.get());
+        REQUIRE(texture.getImageSize() == tgui::Vector2u{25, 25});
+    }
+
+    SECTION("TransparentPixel")
+    {
+        tgui::BackendTexture backendTexture;
+
+        // Left half of the image is transparent, except for a single pixel
+        const tgui::Vector2u size{300, 4};
+        auto pixels = tgui::MakeUniqueForOverwrite<std::uint8_t[]>(size.x * size.y * 4);
+        for (unsigned int i = 0; i < size.x * size.y; ++i)
+        {
+            pixels[i*4 + 0] = 255;
+            pixels[i*4 + 1] = 0;
+            pixels[i*4 + 2] = 0;
+            pixels[i*4 + 3] = ((i % size.x) < size.x / 2) ? 0 : 255;
+        }
+        pixels[(2 * size.x + 10) * 4 + 3] = 100;
+
+        SECTION("Pixels kept")
+        {
+            REQUIRE(backendTexture.load(size, std::move(pixels), true, true));
+            REQUIRE(backendTexture.getPixels() != nullptr);
+            REQUIRE(backendTexture.getPixelMemoryUsage() >= size.x * size.y * 4);
+        }
+        SECTION("Transparency mask")
+        {
+            REQUIRE(backendTexture.load(size, std::move(pixels), true));
+            REQUIRE(backendTexture.getPixels() == nullptr);
+            REQUIRE(backendTexture.getPixelMemoryUsage() < size.x * size.y / 8);
+        }
+
+        REQUIRE(backendTexture.isTransparentPixel({0, 0}));
+        REQUIRE(backendTexture.isTransparentPixel({149, 3}));
+        REQUIRE(!backendTexture.isTransparentPixel({150, 0}));
+        REQUIRE(!backendTexture.isTransparentPixel({299, 3}));
+        REQUIRE(!backendTexture.isTransparentPixel({10, 2}));
+        REQUIRE(backendTexture.isTransparentPixel({10, 1}));
+        REQUIRE(backendTexture.isTransparentPixel({11, 2}));
+    }
+
     SECTION("Color")
     {
         tgui::Texture texture{"resources/image.png"};
@@ -26,6 +26,7 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 #include <TGUI/Texture.hpp>
+#include <TGUI/Sprite.hpp>
 
 TEST_CASE("[TextureManager]")
 {
@@ -44,6 +45,14 @@ TEST_CASE("[TextureManager]")
     REQUIRE(textureData1 == textureData2);
     REQUIRE(textureData1 != textureData3);
 
+    // Only a transparency mask is kept in memory for the loaded images, not the pixels themselves
+    REQUIRE(textureData1->backendTexture->getPixels() == nullptr);
+    REQUIRE(textureData1->backendTexture->getPixelMemoryUsage() < 50 * 50 * 4);
+    REQUIRE(tgui::TextureManager::getPixelMemorySaved() > 0);
+    REQUIRE(tgui::TextureManager::getPixelMemorySaved() == tgui::TextureManager::getMemoryStatistics().pixelMemorySaved);
+    REQUIRE(tgui::TextureManager::getPixelMemoryUsage() == tgui::TextureManager::getMemoryStatistics().pixelMemory);
+    REQUIRE(tgui::TextureManager::getMemoryStatistics().gpuMemory >= 2 * 50 * 50 * 4);
+
     REQUIRE_THROWS_AS(tgui::TextureManager::copyTexture(nullptr), tgui::Exception);
     REQUIRE_THROWS_AS(tgui::TextureManager::copyTexture(std::make_shared<tgui::TextureData>()), tgui::Exception);
     REQUIRE_NOTHROW(tgui::TextureManager::copyTexture(textureData1));
@@ -55,4 +64,73 @@ TEST_CASE("[TextureManager]")
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
 
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData3));
+
+    SECTION("Memory budget")
+    {
+        const std::size_t cachedImagesCount = tgui::TextureManager::getCachedImagesCount();
+        REQUIRE(tgui::TextureManager::getMemoryBudget() == 0);
+
+        // Unused images are kept in the cache while the memory budget isn't exceeded
+        tgui::TextureManager::setMemoryBudget(1024 * 1024);
+        REQUIRE(tgui::TextureManager::getMemoryBudget() == 1024 * 1024);
+        {
+            tgui::Texture texture4{"resources/image.png"};
+            REQUIRE(tgui::TextureManager::getMemoryStatistics().unusedImages == 0);
+        }
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == cachedImagesCount + 1);
+        REQUIRE(tgui::TextureManager::getMemoryStatistics().unusedImages == 1);
+        REQUIRE(tgui::TextureManager::getMemoryStatistics().unusedMemory > 0);
+
+        // The cached image is reused
+        {
+            tgui::Texture texture5{"resources/image.png"};
+            REQUIRE(tgui::TextureManager::getMemoryStatistics().unusedImages == 0);
+        }
+        REQUIRE(tgui::TextureManager::getMemoryStatistics().unusedImages == 1);
+
+        // Unused images are removed when they no longer fit in the budget
+        tgui::TextureManager::setMemoryBudget(1);
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == cachedImagesCount);
+        REQUIRE(tgui::TextureManager::getMemoryStatistics().unusedImages == 0);
+
+        tgui::TextureManager::setMemoryBudget(0);
+    }
+
+    SECTION("Mipmapped memory")
+    {
+        tgui::TextureManager::setMemoryBudget(1024 * 1024);
+        {
+            tgui::Texture texture4{"resources/image.png"};
+        }
+        const std::size_t unusedMemory = tgui::TextureManager::getMemoryStatistics().unusedMemory;
+
+        // The memory accounted for the cached image grows when mipmaps are generated
+        {
+            tgui::Texture texture5{"resources/image.png"};
+            texture5.setMipmapped(true);
+        }
+        REQUIRE(tgui::TextureManager::getMemoryStatistics().unusedMemory > unusedMemory);
+
+        {
+            tgui::Texture texture6{"resources/image.png"};
+            texture6.setMipmapped(false);
+        }
+        REQUIRE(tgui::TextureManager::getMemoryStatistics().unusedMemory == unusedMemory);
+
+        tgui::TextureManager::setMemoryBudget(0);
+    }
+
+    SECTION("Svg raster memory")
+    {
+        const std::size_t svgRasterMemory = tgui::TextureManager::getMemoryStatistics().svgRasterMemory;
+        {
+            tgui::Sprite sprite{"resources/SFML.svg"};
+            sprite.setSize({20, 10});
+            REQUIRE(tgui::TextureManager::getMemoryStatistics().svgRasterMemory >= svgRasterMemory + 20 * 10 * 4);
+
+            tgui::Sprite spriteCopy{sprite};
+            REQUIRE(tgui::TextureManager::getMemoryStatistics().svgRasterMemory >= svgRasterMemory + 2 * 20 * 10 * 4);
+        }
+        REQUIRE(tgui::TextureManager::getMemoryStatistics().svgRasterMemory == svgRasterMemory);
+    }
 }
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Timer.hpp>
+#include <algorithm>
 #include <chrono>
 
 TEST_CASE("[Timer]")
@@ -170,4 +171,60 @@ TEST_CASE("[Timer]")
         duration = tgui::Timer::getNextScheduledTime();
         REQUIRE(!duration); // No active timers
     }
+
+    SECTION("Many timers")
+    {
+        std::vector<unsigned int> triggeredTimers;
+        std::vector<std::shared_ptr<tgui::Timer>> timers;
+        for (unsigned int i = 0; i < 50; ++i)
+        {
+            // Intervals of 10, 40, 20, 50, 30, 10, ... ms
+            const int interval = 10 * static_cast<int>(((i * 3) % 5) + 1);
+            timers.push_back(tgui::Timer::create([&triggeredTimers,i]{ triggeredTimers.push_back(i); }, interval));
+        }
+
+        // Stop some timers in a random order
+        for (unsigned int i = 0; i < 50; i += 7)
+            timers[(i * 13) % 50]->setEnabled(false);
+
+        for (unsigned int step = 1; step <= 12; ++step)
+        {
+            triggeredTimers.clear();
+            REQUIRE(*tgui::Timer::getNextScheduledTime() == std::chrono::milliseconds(10));
+            tgui::Timer::updateTime(std::chrono::milliseconds(10));
+
+            std::vector<unsigned int> expectedTimers;
+            for (unsigned int i = 0; i < 50; ++i)
+            {
+                if (timers[i]->isEnabled() && (step % (((i * 3) % 5) + 1) == 0))
+                    expectedTimers.push_back(i);
+            }
+
+            std::sort(triggeredTimers.begin(), triggeredTimers.end());
+            REQUIRE(triggeredTimers == expectedTimers);
+        }
+
+        // A callback stopping another timer that expired at the same time prevents that timer from being triggered
+        count = 0;
+        std::shared_ptr<tgui::Timer> timer2;
+        auto timer1 = tgui::Timer::create([&]{ ++count; timer2->setEnabled(false); }, 100);
+        timer2 = tgui::Timer::create([&]{ ++count; timer1->setEnabled(false); }, 100);
+        for (auto& timer : timers)
+            timer->setEnabled(false);
+
+        REQUIRE(tgui::Timer::updateTime(std::chrono::milliseconds(100)));
+        REQUIRE(count == 1);
+        REQUIRE(timer1->isEnabled() != timer2->isEnabled());
+        REQUIRE(*tgui::Timer::getNextScheduledTime() == std::chrono::milliseconds(100));
+
+        // No callback is called and nothing is reported until the remaining timer expires
+        REQUIRE(!tgui::Timer::updateTime(std::chrono::milliseconds(99)));
+        REQUIRE(count == 1);
+        REQUIRE(tgui::Timer::updateTime(std::chrono::milliseconds(1)));
+        REQUIRE(count == 2);
+
+        timer1->setEnabled(false);
+        timer2->setEnabled(false);
+        REQUIRE(!tgui::Timer::getNextScheduledTime());
+    }
 }
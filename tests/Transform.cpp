@@ -0,0 +1,155 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Transform.hpp>
+
+namespace
+{
+    void requirePointsEqual(tgui::Vector2f left, tgui::Vector2f right)
+    {
+        REQUIRE(left.x == Approx(right.x).margin(0.0001));
+        REQUIRE(left.y == Approx(right.y).margin(0.0001));
+    }
+}
+
+TEST_CASE("[Transform]")
+{
+    SECTION("Identity")
+    {
+        const tgui::Transform transform;
+        REQUIRE(transform.getAffineMatrix() == std::array<float, 6>{{1, 0, 0, 1, 0, 0}});
+        REQUIRE(transform.transformPoint({12, -5}) == tgui::Vector2f{12, -5});
+    }
+
+    SECTION("Matrix")
+    {
+        const tgui::Transform transform{1, 2, 3, 4, 5, 6};
+        REQUIRE(transform.getAffineMatrix() == std::array<float, 6>{{1, 4, 2, 5, 3, 6}});
+        REQUIRE(transform.getMatrix() == std::array<float, 16>{{1, 4, 0, 0, 2, 5, 0, 0, 0, 0, 1, 0, 3, 6, 0, 1}});
+        REQUIRE(tgui::Transform{transform.getMatrix()}.getAffineMatrix() == transform.getAffineMatrix());
+        REQUIRE(tgui::Transform(1, 2, 3, 4, 5, 6, 0, 0, 1).getAffineMatrix() == transform.getAffineMatrix());
+        REQUIRE(transform.transformPoint({10, 20}) == tgui::Vector2f{53, 146});
+    }
+
+    SECTION("Translate, rotate and scale")
+    {
+        tgui::Transform transform;
+        transform.translate({10, 20});
+        requirePointsEqual(transform.transformPoint({1, 2}), {11, 22});
+
+        transform.rotate(90);
+        requirePointsEqual(transform.transformPoint({1, 2}), {8, 21});
+
+        transform.scale({2, 3});
+        requirePointsEqual(transform.transformPoint({1, 2}), {4, 22});
+
+        tgui::Transform transform2;
+        transform2.rotate(90, {5, 5});
+        requirePointsEqual(transform2.transformPoint({5, 5}), {5, 5});
+        requirePointsEqual(transform2.transformPoint({6, 5}), {5, 6});
+
+        transform2.scale({2, 2}, {5, 6});
+        requirePointsEqual(transform2.transformPoint({5, 6}), {4, 5});
+    }
+
+    SECTION("Combine")
+    {
+        tgui::Transform transform1;
+        transform1.translate({3, -4}).rotate(30).scale({2, 0.5f});
+
+        tgui::Transform transform2;
+        transform2.rotate(-75, {10, 10}).translate({7, 1});
+
+        const tgui::Transform combined = transform1 * transform2;
+        for (const tgui::Vector2f point : {tgui::Vector2f{0, 0}, tgui::Vector2f{15, -2}, tgui::Vector2f{-8, 40}})
+            requirePointsEqual(combined.transformPoint(point), transform1.transformPoint(transform2.transformPoint(point)));
+
+        // Combining a transform with itself
+        tgui::Transform squared = transform1;
+        squared *= squared;
+        requirePointsEqual(squared.transformPoint({15, -2}), transform1.transformPoint(transform1.transformPoint({15, -2})));
+    }
+
+    SECTION("Inverse")
+    {
+        tgui::Transform transform;
+        transform.translate({3, -4}).rotate(30).scale({2, 0.5f});
+
+        const tgui::Transform inverse = transform.getInverse();
+        requirePointsEqual(inverse.transformPoint(transform.transformPoint({15, -2})), {15, -2});
+
+        tgui::Transform singular;
+        singular.scale({0, 1});
+        REQUIRE(singular.getInverse().getAffineMatrix() == tgui::Transform().getAffineMatrix());
+    }
+
+    SECTION("transformPoints")
+    {
+        tgui::Transform transform;
+        transform.translate({3, -4}).rotate(30).scale({2, 0.5f});
+
+        std::vector<tgui::Vector2f> points;
+        for (unsigned int i = 0; i < 7; ++i)
+            points.emplace_back(static_cast<float>(i) * 3.5f, 10.f - static_cast<float>(i * i));
+
+        std::vector<tgui::Vector2f> transformedPoints(points.size());
+        transform.transformPoints(points.data(), transformedPoints.data(), points.size());
+        for (std::size_t i = 0; i < points.size(); ++i)
+            REQUIRE(transformedPoints[i] == transform.transformPoint(points[i]));
+
+        // Transforming the points in-place
+        transform.transformPoints(points.data(), points.data(), points.size());
+        REQUIRE(points == transformedPoints);
+
+        const tgui::FloatRect rect = transform.transformRect({1, 2, 3, 4});
+        requirePointsEqual(rect.getPosition(), {transform.transformPoint({1, 6}).x, transform.transformPoint({1, 2}).y});
+    }
+}
+
+TEST_CASE("[Transform] Benchmark", "[.benchmark]")
+{
+    std::vector<tgui::Vector2f> points(10000, {5, 8});
+
+    tgui::Transform transform;
+    transform.rotate(30, {5, 5});
+
+    BENCHMARK("Composing 10000 transforms")
+    {
+        tgui::Transform result;
+        for (const auto& point : points)
+        {
+            result = transform;
+            result.translate(point);
+            result.scale({2, 2}, point);
+        }
+        return result;
+    };
+
+    BENCHMARK("Transforming 10000 points")
+    {
+        transform.transformPoints(points.data(), points.data(), points.size());
+        return points.back();
+    };
+}
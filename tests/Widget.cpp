@@ -344,6 +344,34 @@ TEST_CASE("[Widget]")
         REQUIRE_THROWS_AS(widget->getUserData<std::string>(), std::bad_cast);
     }
 
+    SECTION("Copying rarely used data")
+    {
+        auto toolTip = tgui::Label::create("Tip");
+        widget->setToolTip(toolTip);
+        widget->setRotation(45, {0.2f, 0.3f});
+        widget->setScale(2, {0.4f, 0.5f});
+        widget->setUserData(5);
+
+        auto other = tgui::ClickableWidget::create();
+        other->setSize({tgui::bindWidth(widget), 20});
+
+        auto copy = widget->clone();
+        REQUIRE(copy->getToolTip() != nullptr);
+        REQUIRE(copy->getToolTip() != toolTip);
+        REQUIRE(copy->getRotationOrigin() == tgui::Vector2f(0.2f, 0.3f));
+        REQUIRE(copy->getScaleOrigin() == tgui::Vector2f(0.4f, 0.5f));
+        REQUIRE(!copy->hasUserData());
+
+        widget->setToolTip(nullptr);
+        REQUIRE(widget->getToolTip() == nullptr);
+        REQUIRE(copy->getToolTip() != nullptr);
+
+        // Layouts that were bound to the original widget aren't bound to the copy
+        copy->setSize({50, 60});
+        widget->setSize({70, 80});
+        REQUIRE(other->getSize() == tgui::Vector2f(70, 20));
+    }
+
     SECTION("WidgetName")
     {
         auto w1 = tgui::ClickableWidget::create();
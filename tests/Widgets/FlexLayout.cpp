@@ -0,0 +1,260 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/FlexLayout.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+
+TEST_CASE("[FlexLayout]")
+{
+    auto layout = tgui::FlexLayout::create({600, 100});
+    layout->getRenderer()->setSpaceBetweenWidgets(10);
+
+    auto widget1 = tgui::ClickableWidget::create({100, 50});
+    auto widget2 = tgui::ClickableWidget::create({200, 50});
+    auto widget3 = tgui::ClickableWidget::create({100, 30});
+    layout->add(widget1);
+    layout->add(widget2);
+    layout->add(widget3);
+
+    SECTION("WidgetType")
+    {
+        REQUIRE(layout->getWidgetType() == "FlexLayout");
+    }
+
+    SECTION("Properties")
+    {
+        REQUIRE(layout->getDirection() == tgui::FlexLayout::Direction::Row);
+        REQUIRE(!layout->getWrap());
+        REQUIRE(layout->getJustifyContent() == tgui::FlexLayout::JustifyContent::Start);
+        REQUIRE(layout->getAlignItems() == tgui::FlexLayout::AlignItems::Stretch);
+
+        REQUIRE(layout->getItemGrow(widget1) == 0);
+        REQUIRE(layout->getItemShrink(widget1) == 1);
+        REQUIRE(layout->getItemBasis(widget1) < 0);
+        REQUIRE(layout->getItemPreferredSize(widget1) == tgui::Vector2f(100, 50));
+
+        REQUIRE(layout->setItemGrow(widget1, 2));
+        REQUIRE(layout->setItemShrink(widget1, 3));
+        REQUIRE(layout->setItemBasis(widget1, 40));
+        REQUIRE(layout->getItemGrow(widget1) == 2);
+        REQUIRE(layout->getItemShrink(widget1) == 3);
+        REQUIRE(layout->getItemBasis(widget1) == 40);
+
+        auto otherWidget = tgui::ClickableWidget::create();
+        REQUIRE(!layout->setItemGrow(otherWidget, 1));
+        REQUIRE(layout->getItemGrow(otherWidget) == 0);
+    }
+
+    SECTION("Grow and shrink")
+    {
+        REQUIRE(widget1->getPosition() == tgui::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == tgui::Vector2f(110, 0));
+        REQUIRE(widget3->getPosition() == tgui::Vector2f(320, 0));
+        REQUIRE(widget1->getSize() == tgui::Vector2f(100, 100));
+        REQUIRE(widget2->getSize() == tgui::Vector2f(200, 100));
+        REQUIRE(widget3->getSize() == tgui::Vector2f(100, 100));
+
+        layout->setItemGrow(widget2, 1);
+        REQUIRE(widget2->getSize() == tgui::Vector2f(380, 100));
+        REQUIRE(widget3->getPosition() == tgui::Vector2f(500, 0));
+
+        layout->setItemBasis(widget1, 20);
+        REQUIRE(widget1->getSize() == tgui::Vector2f(20, 100));
+        REQUIRE(widget2->getSize() == tgui::Vector2f(460, 100));
+
+        // Shrinking is weighted by the basis of the children
+        layout->setItemBasis(widget1, -1);
+        layout->setSize({300, 100});
+        REQUIRE(widget1->getSize() == tgui::Vector2f(70, 100));
+        REQUIRE(widget2->getSize() == tgui::Vector2f(140, 100));
+        REQUIRE(widget3->getSize() == tgui::Vector2f(70, 100));
+        REQUIRE(widget2->getPosition() == tgui::Vector2f(80, 0));
+        REQUIRE(widget3->getPosition() == tgui::Vector2f(230, 0));
+
+        layout->setItemShrink(widget2, 0);
+        REQUIRE(widget1->getSize() == tgui::Vector2f(40, 100));
+        REQUIRE(widget2->getSize() == tgui::Vector2f(200, 100));
+        REQUIRE(widget3->getSize() == tgui::Vector2f(40, 100));
+
+        // The preferred sizes aren't changed by the layout
+        REQUIRE(layout->getItemPreferredSize(widget1) == tgui::Vector2f(100, 50));
+        REQUIRE(layout->getItemPreferredSize(widget2) == tgui::Vector2f(200, 50));
+    }
+
+    SECTION("JustifyContent")
+    {
+        layout->setJustifyContent(tgui::FlexLayout::JustifyContent::End);
+        REQUIRE(widget1->getPosition() == tgui::Vector2f(180, 0));
+        REQUIRE(widget3->getPosition() == tgui::Vector2f(500, 0));
+
+        layout->setJustifyContent(tgui::FlexLayout::JustifyContent::Center);
+        REQUIRE(widget1->getPosition() == tgui::Vector2f(90, 0));
+
+        layout->setJustifyContent(tgui::FlexLayout::JustifyContent::SpaceBetween);
+        REQUIRE(widget1->getPosition() == tgui::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == tgui::Vector2f(200, 0));
+        REQUIRE(widget3->getPosition() == tgui::Vector2f(500, 0));
+
+        layout->setJustifyContent(tgui::FlexLayout::JustifyContent::SpaceAround);
+        REQUIRE(widget1->getPosition() == tgui::Vector2f(30, 0));
+        REQUIRE(widget2->getPosition() == tgui::Vector2f(200, 0));
+        REQUIRE(widget3->getPosition() == tgui::Vector2f(470, 0));
+
+        layout->setJustifyContent(tgui::FlexLayout::JustifyContent::SpaceEvenly);
+        REQUIRE(widget1->getPosition() == tgui::Vector2f(45, 0));
+        REQUIRE(widget2->getPosition() == tgui::Vector2f(200, 0));
+        REQUIRE(widget3->getPosition() == tgui::Vector2f(455, 0));
+
+        // Growing children leave no free space to distribute
+        layout->setItemGrow(widget3, 1);
+        REQUIRE(widget1->getPosition() == tgui::Vector2f(0, 0));
+        REQUIRE(widget3->getSize() == tgui::Vector2f(280, 100));
+    }
+
+    SECTION("AlignItems")
+    {
+        layout->setAlignItems(tgui::FlexLayout::AlignItems::Start);
+        REQUIRE(widget1->getSize() == tgui::Vector2f(100, 50));
+        REQUIRE(widget3->getSize() == tgui::Vector2f(100, 30));
+        REQUIRE(widget3->getPosition() == tgui::Vector2f(320, 0));
+
+        layout->setAlignItems(tgui::FlexLayout::AlignItems::Center);
+        REQUIRE(widget1->getPosition() == tgui::Vector2f(0, 25));
+        REQUIRE(widget3->getPosition() == tgui::Vector2f(320, 35));
+
+        layout->setAlignItems(tgui::FlexLayout::AlignItems::End);
+        REQUIRE(widget1->getPosition() == tgui::Vector2f(0, 50));
+        REQUIRE(widget3->getPosition() == tgui::Vector2f(320, 70));
+    }
+
+    SECTION("Wrap")
+    {
+        layout->setSize({320, 200});
+        layout->setWrap(true);
+        REQUIRE(widget1->getPosition() == tgui::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == tgui::Vector2f(110, 0));
+        REQUIRE(widget3->getPosition() == tgui::Vector2f(0, 60));
+        REQUIRE(widget1->getSize() == tgui::Vector2f(100, 50));
+        REQUIRE(widget3->getSize() == tgui::Vector2f(100, 30));
+
+        // Free space is distributed per line
+        layout->setItemGrow(widget3, 1);
+        REQUIRE(widget3->getSize() == tgui::Vector2f(320, 30));
+        REQUIRE(widget2->getSize() == tgui::Vector2f(200, 50));
+
+        layout->setSize({150, 200});
+        REQUIRE(widget1->getPosition() == tgui::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == tgui::Vector2f(0, 60));
+        REQUIRE(widget3->getPosition() == tgui::Vector2f(0, 120));
+        REQUIRE(widget2->getSize() == tgui::Vector2f(150, 50));
+
+        // Resizing the layout back gives the original result, as children keep their preferred sizes
+        layout->setSize({320, 200});
+        REQUIRE(widget2->getPosition() == tgui::Vector2f(110, 0));
+        REQUIRE(widget3->getPosition() == tgui::Vector2f(0, 60));
+        REQUIRE(widget2->getSize() == tgui::Vector2f(200, 50));
+        REQUIRE(widget3->getSize() == tgui::Vector2f(320, 30));
+    }
+
+    SECTION("Column")
+    {
+        layout->setSize({100, 300});
+        layout->setDirection(tgui::FlexLayout::Direction::Column);
+        layout->setItemGrow(widget2, 1);
+        REQUIRE(widget1->getPosition() == tgui::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == tgui::Vector2f(0, 60));
+        REQUIRE(widget3->getPosition() == tgui::Vector2f(0, 270));
+        REQUIRE(widget1->getSize() == tgui::Vector2f(100, 50));
+        REQUIRE(widget2->getSize() == tgui::Vector2f(100, 200));
+        REQUIRE(widget3->getSize() == tgui::Vector2f(100, 30));
+    }
+
+    SECTION("Preferred size")
+    {
+        // Resizing a child from outside the layout changes its preferred size
+        widget1->setSize({150, 40});
+        REQUIRE(layout->getItemPreferredSize(widget1) == tgui::Vector2f(150, 40));
+        REQUIRE(widget1->getSize() == tgui::Vector2f(150, 100));
+        REQUIRE(widget2->getPosition() == tgui::Vector2f(160, 0));
+
+        layout->remove(widget1);
+        REQUIRE(widget2->getPosition() == tgui::Vector2f(0, 0));
+
+        // A removed widget no longer influences the layout
+        widget1->setSize({300, 300});
+        REQUIRE(widget2->getPosition() == tgui::Vector2f(0, 0));
+
+        // The children no longer fit and shrink relative to their preferred width
+        layout->insert(0, widget1);
+        REQUIRE(layout->getItemPreferredSize(widget1) == tgui::Vector2f(300, 300));
+        REQUIRE(widget1->getSize() == tgui::Vector2f(290, 100));
+        REQUIRE(widget2->getPosition() == tgui::Vector2f(300, 0));
+    }
+
+    SECTION("Copying")
+    {
+        layout->setItemGrow(widget2, 1);
+
+        auto layoutCopy = tgui::FlexLayout::copy(layout);
+        REQUIRE(layoutCopy->getItemGrow(layoutCopy->get(1)) == 1);
+
+        // Changing the children of the copy doesn't affect the original layout
+        layoutCopy->get(0)->setSize({200, 50});
+        REQUIRE(layoutCopy->get(1)->getSize() == tgui::Vector2f(280, 100));
+        REQUIRE(widget2->getSize() == tgui::Vector2f(380, 100));
+
+        layoutCopy = nullptr;
+        widget1->setSize({150, 50});
+        REQUIRE(widget2->getSize() == tgui::Vector2f(330, 100));
+    }
+
+    SECTION("Batched updates")
+    {
+        layout->removeAllWidgets();
+
+        layout->beginUpdate();
+        for (unsigned int i = 0; i < 10; ++i)
+            layout->add(tgui::ClickableWidget::create({50, 20}));
+        REQUIRE(layout->get(9)->getPosition() == tgui::Vector2f(0, 0));
+        layout->endUpdate();
+
+        REQUIRE(layout->get(9)->getPosition() == tgui::Vector2f(540, 0));
+        REQUIRE(layout->get(9)->getSize() == tgui::Vector2f(50, 100));
+    }
+
+    SECTION("Saving and loading from file")
+    {
+        layout->setDirection(tgui::FlexLayout::Direction::Column);
+        layout->setWrap(true);
+        layout->setJustifyContent(tgui::FlexLayout::JustifyContent::SpaceEvenly);
+        layout->setAlignItems(tgui::FlexLayout::AlignItems::Center);
+        layout->setItemGrow(widget1, 1);
+        layout->setItemShrink(widget2, 2);
+        layout->setItemBasis(widget3, 25);
+
+        testSavingWidget("FlexLayout", layout, false);
+    }
+}
@@ -76,6 +76,35 @@ TEST_CASE("[Grid]")
         REQUIRE(grid->getWidget(1, 5) == nullptr);
     }
 
+    SECTION("Batched updates")
+    {
+        grid->setAutoSize(true);
+
+        unsigned int sizeChangeCount = 0;
+        grid->onSizeChange([&]{ ++sizeChangeCount; });
+
+        auto widget1 = tgui::ClickableWidget::create({100, 50});
+        auto widget2 = tgui::ClickableWidget::create({20, 10});
+
+        grid->beginUpdate();
+        grid->addWidget(widget1, 0, 0);
+        grid->addWidget(widget2, 1, 1, tgui::Grid::Alignment::UpperLeft, {1, 2, 3, 4});
+        widget2->setSize(30, 20);
+        REQUIRE(sizeChangeCount == 0);
+        REQUIRE(grid->getSize() == tgui::Vector2f(0, 0));
+
+        grid->endUpdate();
+        REQUIRE(sizeChangeCount == 1);
+        REQUIRE(grid->getSize() == tgui::Vector2f(134, 76));
+        REQUIRE(widget1->getPosition() == tgui::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == tgui::Vector2f(101, 52));
+
+        // Ending an empty batch doesn't reposition the widgets
+        grid->beginUpdate();
+        grid->endUpdate();
+        REQUIRE(sizeChangeCount == 1);
+    }
+
     SECTION("Borders")
     {
         auto widget = tgui::ClickableWidget::create({40, 30});
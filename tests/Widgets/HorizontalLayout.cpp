@@ -109,6 +109,49 @@ TEST_CASE("[HorizontalLayout]")
         }
     }
 
+    SECTION("Batched updates")
+    {
+        REQUIRE(!layout->isUpdating());
+
+        auto button1 = tgui::Button::create();
+        auto button2 = tgui::Button::create();
+        layout->add(button1);
+        REQUIRE(button1->getFullSize() == tgui::Vector2f(800, 1000));
+
+        layout->beginUpdate();
+        layout->beginUpdate();
+        REQUIRE(layout->isUpdating());
+
+        layout->add(button2);
+        layout->getRenderer()->setPadding({10});
+        REQUIRE(button1->getFullSize() == tgui::Vector2f(800, 1000));
+
+        layout->endUpdate();
+        REQUIRE(layout->isUpdating());
+        REQUIRE(button1->getFullSize() == tgui::Vector2f(800, 1000));
+
+        layout->endUpdate();
+        REQUIRE(!layout->isUpdating());
+        REQUIRE(button1->getPosition() == tgui::Vector2f(0, 0));
+        REQUIRE(button2->getPosition() == tgui::Vector2f(395, 0));
+        REQUIRE(button1->getFullSize() == tgui::Vector2f(385, 980));
+        REQUIRE(button2->getFullSize() == tgui::Vector2f(385, 980));
+
+        // Changes after the batch are applied immediately again
+        layout->remove(button2);
+        REQUIRE(button1->getFullSize() == tgui::Vector2f(780, 980));
+
+        // Adding many widgets in a batch only resizes the existing widgets once
+        unsigned int sizeChangeCount = 0;
+        button1->onSizeChange([&]{ ++sizeChangeCount; });
+        layout->beginUpdate();
+        for (unsigned int i = 0; i < 10; ++i)
+            layout->add(tgui::Button::create());
+        layout->endUpdate();
+        REQUIRE(sizeChangeCount == 1);
+        REQUIRE(layout->get(10)->getPosition().x > layout->get(9)->getPosition().x);
+    }
+
     SECTION("Order")
     {
         REQUIRE(layout->get(0) == nullptr);
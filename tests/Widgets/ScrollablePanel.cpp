@@ -129,6 +129,89 @@ TEST_CASE("[ScrollablePanel]")
         REQUIRE(panel->getScrollbarWidth() == 15);
     }
 
+    SECTION("Virtual items")
+    {
+        panel->setSize({200, 100});
+
+        unsigned int createCount = 0;
+        unsigned int bindCount = 0;
+        panel->setVirtualItems(1000,
+            [](std::size_t){ return 30.f; },
+            [&]{ ++createCount; return tgui::ClickableWidget::create(); },
+            [&](const tgui::Widget::Ptr& widget, std::size_t index){ ++bindCount; widget->setUserData(index); });
+
+        REQUIRE(panel->isVirtualized());
+        REQUIRE(panel->getVirtualItemCount() == 1000);
+        REQUIRE(panel->getVirtualOverscan() == 2);
+        REQUIRE(panel->getContentSize().y == 30000);
+        REQUIRE(panel->getVirtualItemPosition(100) == 3000);
+
+        // Only 4 items are visible, 2 more are created below them
+        REQUIRE(panel->getWidgets().size() == 6);
+        REQUIRE(createCount == 6);
+        REQUIRE(bindCount == 6);
+        REQUIRE(panel->getVirtualItemWidget(6) == nullptr);
+        REQUIRE(panel->getVirtualItemWidget(5)->getUserData<std::size_t>() == 5);
+        REQUIRE(panel->getVirtualItemWidget(5)->getPosition() == tgui::Vector2f(0, 150));
+        REQUIRE(panel->getVirtualItemWidget(5)->getSize() == tgui::Vector2f(200 - panel->getScrollbarWidth(), 30));
+
+        // Widgets are recycled while scrolling
+        panel->setVerticalScrollbarValue(3000);
+        REQUIRE(panel->getWidgets().size() == 8);
+        REQUIRE(createCount == 8);
+        REQUIRE(bindCount == 14);
+        REQUIRE(panel->getVirtualItemWidget(97) == nullptr);
+        REQUIRE(panel->getVirtualItemWidget(98)->getUserData<std::size_t>() == 98);
+        REQUIRE(panel->getVirtualItemWidget(105)->getUserData<std::size_t>() == 105);
+        REQUIRE(panel->getVirtualItemWidget(105)->getPosition() == tgui::Vector2f(0, 3150));
+
+        // Scrolling a bit only binds the items that became visible
+        panel->setVerticalScrollbarValue(3030);
+        REQUIRE(panel->getWidgets().size() == 8);
+        REQUIRE(createCount == 8);
+        REQUIRE(bindCount == 15);
+
+        panel->setVirtualOverscan(0);
+        REQUIRE(panel->getWidgets().size() == 4);
+        REQUIRE(panel->getVirtualItemWidget(101) != nullptr);
+        REQUIRE(panel->getVirtualItemWidget(100) == nullptr);
+
+        panel->setVirtualItemCount(10);
+        REQUIRE(panel->getContentSize().y == 300);
+        REQUIRE(panel->getVerticalScrollbarValue() == 200);
+        REQUIRE(panel->getVirtualItemWidget(9)->getUserData<std::size_t>() == 9);
+        REQUIRE(panel->getWidgets().size() == 4);
+
+        // The copied panel creates its own widgets
+        auto panelCopy = tgui::ScrollablePanel::copy(panel);
+        REQUIRE(panelCopy->isVirtualized());
+        REQUIRE(panelCopy->getWidgets().size() == 4);
+        REQUIRE(panelCopy->getVirtualItemWidget(9) != panel->getVirtualItemWidget(9));
+        REQUIRE(panelCopy->getVirtualItemWidget(9)->getUserData<std::size_t>() == 9);
+
+        bindCount = 0;
+        panel->refreshVirtualItems();
+        REQUIRE(bindCount == 4);
+
+        panel->removeVirtualItems();
+        REQUIRE(!panel->isVirtualized());
+        REQUIRE(panel->getWidgets().empty());
+        REQUIRE(panel->getVirtualItemCount() == 0);
+
+        // Items can have different heights and jumping far ahead in a long list only creates the visible widgets
+        panel->setVirtualItems(100000,
+            [](std::size_t index){ return static_cast<float>(40 + (index % 5) * 10); },
+            []{ return tgui::ClickableWidget::create(); },
+            [](const tgui::Widget::Ptr& widget, std::size_t index){ widget->setUserData(index); });
+        REQUIRE(panel->getContentSize().y == 6000000);
+        REQUIRE(panel->getVirtualItemPosition(12) == 690);
+
+        panel->setVerticalScrollbarValue(3000000);
+        REQUIRE(panel->getVirtualItemWidget(50000) != nullptr);
+        REQUIRE(panel->getVirtualItemWidget(50000)->getPosition() == tgui::Vector2f(0, 3000000));
+        REQUIRE(panel->getWidgets().size() <= 6);
+    }
+
     SECTION("Events / Signals")
     {
         unsigned int mousePressedCount = 0;